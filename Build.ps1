@@ -201,9 +201,9 @@ function CompileWindowsHost {
     Write-Output "[93mCompiling Windows Executable...[0m"
 
     if ($Configuration -eq "Debug") {
-        cl.exe /c /nologo /DDEBUG /std:c++17 /Zi /diagnostics:caret /EHsc /I"..\..\packages\$DirectX12Version\build\native\include" /I"..\..\..\Libs\" /Yu"WindowsCommon.h" /FpWindowsCommon.PCH /TP /Tp"..\..\..\main.compilationunit"
+        cl.exe /c /nologo /DDEBUG /std:c++17 /Zi /diagnostics:caret /EHsc /I"..\..\packages\$DirectX12Version\build\native\include" /I"..\..\..\..\Common\Libs\" /Yu"WindowsCommon.h" /FpWindowsCommon.PCH /TP /Tp"..\..\..\main.compilationunit"
     } else {
-        cl.exe /c /nologo /std:c++17 /O2 /Zi /diagnostics:caret /EHsc /I"..\..\packages\$DirectX12Version\build\native\include" /I"..\..\..\Libs\" /Yu"WindowsCommon.h" /FpWindowsCommon.PCH /TP /Tp"..\..\..\main.compilationunit"
+        cl.exe /c /nologo /std:c++17 /O2 /Zi /diagnostics:caret /EHsc /I"..\..\packages\$DirectX12Version\build\native\include" /I"..\..\..\..\Common\Libs\" /Yu"WindowsCommon.h" /FpWindowsCommon.PCH /TP /Tp"..\..\..\main.compilationunit"
     }
 
     if (-Not $?)
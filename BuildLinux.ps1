@@ -0,0 +1,98 @@
+$OriginalProgressPreference = $ProgressPreference
+$ProgressPreference = "SilentlyContinue"
+
+$LinuxHostSourceFolder = "./src/Host/Linux/"
+$TempFolder = "./build/temp/Linux"
+$OutputFolder = "./build/Linux"
+
+$Configuration = "Release"
+
+if ($args.length -gt 0 -And $args[0] -eq "debug")
+{
+    $Configuration = "Debug"
+}
+
+if (-not(Test-Path -Path $TempFolder))
+{
+    New-Item -Path $TempFolder -ItemType "directory" | Out-Null
+}
+
+if (-not(Test-Path -Path $OutputFolder))
+{
+    New-Item -Path $OutputFolder -ItemType "directory" | Out-Null
+}
+
+function ShowErrorMessage
+{
+    Write-Output "[91mError: Build has failed![0m"
+}
+
+function FindNetHostFolder
+{
+    # The nethost static library is shipped with the dotnet SDK app host pack
+    $dotnetRoot = Split-Path -Parent (Get-Command dotnet).Source
+
+    if (Test-Path -Path Env:DOTNET_ROOT)
+    {
+        $dotnetRoot = $Env:DOTNET_ROOT
+    }
+
+    $appHostPack = Get-ChildItem -Path "$dotnetRoot/packs/Microsoft.NETCore.App.Host.linux-x64" -Directory | Where-Object { $_.Name -like "6.*" } | Sort-Object Name | Select-Object -Last 1
+
+    if ($appHostPack -eq $null)
+    {
+        Write-Output "[91mError: Cannot find the linux-x64 app host pack![0m"
+        Exit 1
+    }
+
+    return "$($appHostPack.FullName)/runtimes/linux-x64/native"
+}
+
+function CompileDotnet
+{
+    Push-Location $TempFolder
+    Write-Output "[93mCompiling CoreEngine Library...[0m"
+    dotnet build --nologo -c $Configuration -v Q -o "." "../../../src/CoreEngine"
+
+    if(-Not $?)
+    {
+        Pop-Location
+        ShowErrorMessage
+        Exit 1
+    }
+
+    Pop-Location
+}
+
+function CompileLinuxHost
+{
+    $netHostFolder = FindNetHostFolder
+
+    Write-Output "[93mCompiling Linux Executable...[0m"
+
+    if ($Configuration -eq "Debug") {
+        g++ -std=c++17 -g -DDEBUG -x c++ "$($LinuxHostSourceFolder)main.compilationunit" -o "$TempFolder/CoreEngine" -L"$netHostFolder" -l:libnethost.a -ldl -lpthread
+    } else {
+        g++ -std=c++17 -O2 -g -x c++ "$($LinuxHostSourceFolder)main.compilationunit" -o "$TempFolder/CoreEngine" -L"$netHostFolder" -l:libnethost.a -ldl -lpthread
+    }
+
+    if (-Not $?)
+    {
+        ShowErrorMessage
+        Exit 1
+    }
+}
+
+function CopyFiles
+{
+    Write-Output "[93mCopy files...[0m"
+    Copy-Item "$TempFolder/*" $OutputFolder -Recurse -Force
+}
+
+CompileDotnet
+CompileLinuxHost
+CopyFiles
+
+Write-Output "[92mSuccess: Compilation done.[0m"
+
+$ProgressPreference = $OriginalProgressPreference
@@ -0,0 +1,168 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Text.Json;
+using System.Threading;
+
+namespace CoreEngine.Diagnostics
+{
+    // Records the CPU zones of the engine threads and the GPU zones of the command queues during a
+    // capture and writes them to a Chrome trace file that can be opened in chrome://tracing or Perfetto.
+    // All timestamps use the Stopwatch clock, GPU timestamps must be converted with the queue calibration.
+    public static class Profiler
+    {
+        private const int cpuProcessId = 1;
+        private const int gpuProcessId = 2;
+
+        private readonly record struct TraceEvent(string Name, int ProcessId, int ThreadId, long StartTimestamp, long EndTimestamp);
+
+        private static readonly object syncObject = new object();
+        private static readonly List<TraceEvent> traceEvents = new List<TraceEvent>();
+        private static readonly Dictionary<(int, int), string> threadNames = new Dictionary<(int, int), string>();
+        private static readonly Dictionary<string, int> gpuTrackIds = new Dictionary<string, int>();
+
+        [ThreadStatic]
+        private static Stack<(string Name, long StartTimestamp)>? cpuZoneStack;
+
+        public static bool IsCapturing { get; private set; }
+
+        // Also identifies the capture, it changes each time a capture begins
+        public static long CaptureStartTimestamp { get; private set; }
+
+        public static void BeginCapture()
+        {
+            lock (syncObject)
+            {
+                traceEvents.Clear();
+                threadNames.Clear();
+                gpuTrackIds.Clear();
+
+                CaptureStartTimestamp = Stopwatch.GetTimestamp();
+                IsCapturing = true;
+            }
+        }
+
+        public static void EndCapture(string path)
+        {
+            lock (syncObject)
+            {
+                IsCapturing = false;
+                WriteChromeTrace(path);
+
+                traceEvents.Clear();
+            }
+        }
+
+        // The zone stack is kept outside of captures so that zones opened before a capture stay balanced
+        public static void BeginCpuZone(string name)
+        {
+            if (cpuZoneStack == null)
+            {
+                cpuZoneStack = new Stack<(string, long)>();
+            }
+
+            cpuZoneStack.Push((name, Stopwatch.GetTimestamp()));
+        }
+
+        public static void EndCpuZone()
+        {
+            if (cpuZoneStack == null || !cpuZoneStack.TryPop(out var cpuZone))
+            {
+                return;
+            }
+
+            if (IsCapturing)
+            {
+                var thread = Thread.CurrentThread;
+                AddEvent(new TraceEvent(cpuZone.Name, cpuProcessId, thread.ManagedThreadId, cpuZone.StartTimestamp, Stopwatch.GetTimestamp()), thread.Name ?? $"Thread {thread.ManagedThreadId}");
+            }
+        }
+
+        public static void AddGpuZone(string trackName, string name, long startTimestamp, long endTimestamp)
+        {
+            if (!IsCapturing)
+            {
+                return;
+            }
+
+            lock (syncObject)
+            {
+                if (!gpuTrackIds.TryGetValue(trackName, out var trackId))
+                {
+                    trackId = gpuTrackIds.Count + 1;
+                    gpuTrackIds.Add(trackName, trackId);
+                }
+
+                AddEvent(new TraceEvent(name, gpuProcessId, trackId, startTimestamp, endTimestamp), trackName);
+            }
+        }
+
+        private static void AddEvent(in TraceEvent traceEvent, string threadName)
+        {
+            lock (syncObject)
+            {
+                // GPU zones are read back a few frames later so they can start before the capture
+                if (!IsCapturing || traceEvent.StartTimestamp < CaptureStartTimestamp)
+                {
+                    return;
+                }
+
+                traceEvents.Add(traceEvent);
+                threadNames.TryAdd((traceEvent.ProcessId, traceEvent.ThreadId), threadName);
+            }
+        }
+
+        private static void WriteChromeTrace(string path)
+        {
+            using var stream = File.Create(path);
+            using var writer = new Utf8JsonWriter(stream);
+
+            writer.WriteStartObject();
+            writer.WriteString("displayTimeUnit", "ms");
+            writer.WriteStartArray("traceEvents");
+
+            WriteMetadataEvent(writer, "process_name", cpuProcessId, 0, "CPU");
+            WriteMetadataEvent(writer, "process_name", gpuProcessId, 0, "GPU");
+
+            foreach (var threadName in threadNames)
+            {
+                WriteMetadataEvent(writer, "thread_name", threadName.Key.Item1, threadName.Key.Item2, threadName.Value);
+            }
+
+            foreach (var traceEvent in traceEvents)
+            {
+                writer.WriteStartObject();
+                writer.WriteString("name", traceEvent.Name);
+                writer.WriteString("cat", traceEvent.ProcessId == cpuProcessId ? "cpu" : "gpu");
+                writer.WriteString("ph", "X");
+                writer.WriteNumber("pid", traceEvent.ProcessId);
+                writer.WriteNumber("tid", traceEvent.ThreadId);
+                writer.WriteNumber("ts", ConvertToMicroseconds(traceEvent.StartTimestamp - CaptureStartTimestamp));
+                writer.WriteNumber("dur", ConvertToMicroseconds(traceEvent.EndTimestamp - traceEvent.StartTimestamp));
+                writer.WriteEndObject();
+            }
+
+            writer.WriteEndArray();
+            writer.WriteEndObject();
+        }
+
+        private static void WriteMetadataEvent(Utf8JsonWriter writer, string name, int processId, int threadId, string value)
+        {
+            writer.WriteStartObject();
+            writer.WriteString("name", name);
+            writer.WriteString("ph", "M");
+            writer.WriteNumber("pid", processId);
+            writer.WriteNumber("tid", threadId);
+            writer.WriteStartObject("args");
+            writer.WriteString("name", value);
+            writer.WriteEndObject();
+            writer.WriteEndObject();
+        }
+
+        private static double ConvertToMicroseconds(long duration)
+        {
+            return (double)duration / Stopwatch.Frequency * 1000000.0;
+        }
+    }
+}
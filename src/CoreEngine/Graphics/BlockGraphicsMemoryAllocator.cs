@@ -16,6 +16,7 @@ namespace CoreEngine.Graphics
         public GraphicsHeap GraphicsHeap { get; }
         public ulong SizeInBytes { get;}
         public ulong CurrentOffset { get; set; }
+        public int AllocationCount { get; set; }
         
         public ulong AvailableMemory 
         { 
@@ -101,7 +102,24 @@ namespace CoreEngine.Graphics
 
         public void FreeMemory(in GraphicsMemoryAllocation allocation)
         {
-            //this.AllocatedMemory -= (ulong)allocation.SizeInBytes;
+            foreach (var graphicsHeap in this.graphicsHeaps)
+            {
+                if (graphicsHeap.GraphicsHeap.NativePointer != allocation.GraphicsHeap.NativePointer || graphicsHeap.AllocationCount == 0)
+                {
+                    continue;
+                }
+
+                this.AllocatedMemory -= (ulong)allocation.SizeInBytes;
+                graphicsHeap.AllocationCount--;
+
+                // Allocations are freed once the GPU is done with them so an empty block can be reused from the start
+                if (graphicsHeap.AllocationCount == 0)
+                {
+                    graphicsHeap.CurrentOffset = 0;
+                }
+
+                return;
+            }
         }
 
         public void Reset(uint frameNumber)
@@ -109,6 +127,28 @@ namespace CoreEngine.Graphics
 
         }
 
+        public ulong Trim()
+        {
+            var releasedMemory = 0ul;
+
+            // The first block is kept so that small allocations don't recreate a heap
+            for (var i = this.graphicsHeaps.Count - 1; i > 0; i--)
+            {
+                var graphicsHeap = this.graphicsHeaps[i];
+
+                if (graphicsHeap.AllocationCount == 0)
+                {
+                    this.graphicsManager.ScheduleDeleteGraphicsHeap(graphicsHeap.GraphicsHeap);
+                    this.graphicsHeaps.RemoveAt(i);
+
+                    this.TotalMemory -= graphicsHeap.SizeInBytes;
+                    releasedMemory += graphicsHeap.SizeInBytes;
+                }
+            }
+
+            return releasedMemory;
+        }
+
         private void AllocateGraphicsHeap(ulong sizeInBytes)
         {
             var graphicsHeap = this.graphicsManager.CreateGraphicsHeap(this.heapType, sizeInBytes, this.label);
@@ -134,6 +174,7 @@ namespace CoreEngine.Graphics
 
                 this.AllocatedMemory += (ulong)sizeInBytes;
                 graphicsHeap.CurrentOffset = alignedHeapOffset + (ulong)sizeInBytes;
+                graphicsHeap.AllocationCount++;
 
                 return allocation;
             }
@@ -0,0 +1,30 @@
+using System;
+
+namespace CoreEngine.Graphics
+{
+    public readonly struct CommandListBatch
+    {
+        public CommandListBatch(CommandQueue commandQueue, CommandList[] commandLists) : this(commandQueue, commandLists, Array.Empty<Fence>(), -1)
+        {
+        }
+
+        public CommandListBatch(CommandQueue commandQueue, CommandList[] commandLists, int batchIndexToWait) : this(commandQueue, commandLists, Array.Empty<Fence>(), batchIndexToWait)
+        {
+        }
+
+        public CommandListBatch(CommandQueue commandQueue, CommandList[] commandLists, Fence[] fencesToWait, int batchIndexToWait = -1)
+        {
+            this.CommandQueue = commandQueue;
+            this.CommandLists = commandLists;
+            this.FencesToWait = fencesToWait;
+            this.BatchIndexToWait = batchIndexToWait;
+        }
+
+        public CommandQueue CommandQueue { get; }
+        public CommandList[] CommandLists { get; }
+        public Fence[] FencesToWait { get; }
+
+        // Index of a previous batch of the same submission to wait for, -1 if none
+        public int BatchIndexToWait { get; }
+    }
+}
@@ -0,0 +1,20 @@
+namespace CoreEngine.Graphics
+{
+    public readonly struct GpuZone
+    {
+        public GpuZone(string name, CommandQueue commandQueue, int depth, ulong startTimestamp, ulong endTimestamp)
+        {
+            this.Name = name;
+            this.CommandQueue = commandQueue;
+            this.Depth = depth;
+            this.StartTimestamp = startTimestamp;
+            this.EndTimestamp = endTimestamp;
+        }
+
+        public string Name { get; }
+        public CommandQueue CommandQueue { get; }
+        public int Depth { get; }
+        public ulong StartTimestamp { get; }
+        public ulong EndTimestamp { get; }
+    }
+}
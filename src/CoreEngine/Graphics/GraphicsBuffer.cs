@@ -9,18 +9,17 @@ namespace CoreEngine.Graphics
         private readonly GraphicsManager graphicsManager;
         private bool isDisposed;
 
-        internal GraphicsBuffer(GraphicsManager graphicsManager, GraphicsMemoryAllocation graphicsMemoryAllocation, GraphicsMemoryAllocation? graphicsMemoryAllocation2, IntPtr nativePointer1, IntPtr? nativePointer2, uint sizeInBytes, GraphicsBufferUsage usage, bool isStatic, string label)
+        internal GraphicsBuffer(GraphicsManager graphicsManager, GraphicsMemoryAllocation[] graphicsMemoryAllocations, IntPtr[] nativePointers, uint sizeInBytes, GraphicsBufferUsage usage, bool isStatic, string label)
         {
             this.graphicsManager = graphicsManager;
-            this.NativePointer1 = nativePointer1;
-            this.NativePointer2 = nativePointer2;
+            this.NativePointers = nativePointers;
             this.SizeInBytes = sizeInBytes;
             this.IsStatic = isStatic;
             this.ResourceType = GraphicsResourceType.Buffer;
             this.Usage = usage;
             this.Label = label;
-            this.GraphicsMemoryAllocation = graphicsMemoryAllocation;
-            this.GraphicsMemoryAllocation2 = graphicsMemoryAllocation2;
+            this.GraphicsMemoryAllocations = graphicsMemoryAllocations;
+            this.ShaderResourceIndexes = new uint[nativePointers.Length];
         }
 
         public void Dispose()
@@ -42,23 +41,12 @@ namespace CoreEngine.Graphics
         { 
             get
             {
-                var result = this.NativePointer1;
-
-                if (!IsStatic && this.NativePointer2 != null && ((this.graphicsManager.CurrentFrameNumber % 2) == 1))
-                {
-                    result = this.NativePointer2.Value;
-                }
-
-                return result;
+                return this.NativePointers[this.graphicsManager.CurrentFrameIndex % this.NativePointers.Length];
             }
         }
 
-        public IntPtr NativePointer1
-        {
-            get;
-        }
-
-        public IntPtr? NativePointer2
+        // Non static buffers have one copy per frame in flight
+        public IntPtr[] NativePointers
         {
             get;
         }
@@ -68,26 +56,18 @@ namespace CoreEngine.Graphics
         public GraphicsBufferUsage Usage { get; }
         public GraphicsResourceType ResourceType { get; }
         public bool IsStatic { get; }
-        public GraphicsMemoryAllocation GraphicsMemoryAllocation { get; }
-        public GraphicsMemoryAllocation? GraphicsMemoryAllocation2 { get; }
+        public GraphicsMemoryAllocation GraphicsMemoryAllocation => this.GraphicsMemoryAllocations[0];
+        public GraphicsMemoryAllocation[] GraphicsMemoryAllocations { get; }
 
         public uint ShaderResourceIndex 
         { 
             get
             {
-                var result = this.ShaderResourceIndex1;
-
-                if (!IsStatic && this.ShaderResourceIndex2 != null && ((this.graphicsManager.CurrentFrameNumber % 2) == 1))
-                {
-                    result = this.ShaderResourceIndex2.Value;
-                }
-
-                return result;
+                return this.ShaderResourceIndexes[this.graphicsManager.CurrentFrameIndex % this.ShaderResourceIndexes.Length];
             }
         }
 
-        public uint ShaderResourceIndex1 { get; internal set;}
-        public uint? ShaderResourceIndex2 { get; internal set;}
+        internal uint[] ShaderResourceIndexes { get; set; }
 
         public string Label
         {
@@ -5,6 +5,9 @@ namespace CoreEngine.Graphics
         Gpu,
         Upload,
         ReadBack,
+
+        // Device local memory that the CPU can write directly, falls back to upload memory when the device doesn't have it
+        GpuUpload,
         TransientGpu
     }
 }
\ No newline at end of file
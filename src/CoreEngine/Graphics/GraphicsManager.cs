@@ -33,20 +33,32 @@ namespace CoreEngine.Graphics
         private List<GraphicsBuffer> graphicsBuffers = new List<GraphicsBuffer>();
         private List<Texture> textures = new List<Texture>();
         private List<PipelineState> pipelineStates = new List<PipelineState>();
+
+        // Command lists are recorded on several threads so the pipeline state collections are locked when they are accessed
+        private HashSet<IntPtr> compilingPipelineStates = new HashSet<IntPtr>();
+        private HashSet<IntPtr> skippedRenderPassCommandLists = new HashSet<IntPtr>();
         private List<Shader> shaders = new List<Shader>();
+        private List<IntPtr> shaderArchives = new List<IntPtr>();
         private List<QueryBuffer> queryBuffers = new List<QueryBuffer>();
         private List<SwapChain> swapChains = new List<SwapChain>();
         private List<GraphicsHeap> graphicsHeaps = new List<GraphicsHeap>();
 
-        private List<GraphicsBuffer>[] graphicsBuffersToDelete = new List<GraphicsBuffer>[2];
-        private List<Texture>[] texturesToDelete = new List<Texture>[2];
-        private List<PipelineState>[] pipelineStatesToDelete = new List<PipelineState>[2];
-        private List<Shader>[] shadersToDelete = new List<Shader>[2];
-        private List<QueryBuffer>[] queryBuffersToDelete = new List<QueryBuffer>[2];
-        private List<SwapChain>[] swapChainsToDelete = new List<SwapChain>[2];
-        private List<GraphicsHeap>[] graphicsHeapsToDelete = new List<GraphicsHeap>[2];
-
-        public GraphicsManager(IGraphicsService graphicsService, ResourcesManager resourcesManager)
+        private List<GraphicsBuffer>[] graphicsBuffersToDelete;
+        private List<Texture>[] texturesToDelete;
+        private List<PipelineState>[] pipelineStatesToDelete;
+        private List<Shader>[] shadersToDelete;
+        private List<QueryBuffer>[] queryBuffersToDelete;
+        private List<SwapChain>[] swapChainsToDelete;
+        private List<GraphicsHeap>[] graphicsHeapsToDelete;
+
+        private const int maxGpuZoneCount = 1024;
+        private readonly Dictionary<(string, IntPtr), uint> gpuZoneNameIds = new Dictionary<(string, IntPtr), uint>();
+        private readonly List<string> gpuZoneNames = new List<string>();
+        private readonly List<CommandQueue> gpuZoneCommandQueues = new List<CommandQueue>();
+        private readonly GraphicsGpuZone[] resolvedGpuZones = new GraphicsGpuZone[maxGpuZoneCount];
+        private readonly List<GpuZone> gpuZones = new List<GpuZone>();
+
+        public GraphicsManager(IGraphicsService graphicsService, ResourcesManager resourcesManager, int framesInFlightCount = 2)
         {
             if (graphicsService == null)
             {
@@ -59,32 +71,36 @@ namespace CoreEngine.Graphics
             }
 
             this.graphicsService = graphicsService;
+
+            // The host clamps the value to what it supports, it must be set before any swap chain is created
+            var hostFramesInFlightCount = this.graphicsService.SetFramesInFlightCount(framesInFlightCount);
+            this.FramesInFlightCount = (hostFramesInFlightCount > 0) ? hostFramesInFlightCount : framesInFlightCount;
+
             this.graphicsMemoryManager = new GraphicsMemoryManager(this, graphicsService);
             this.shaderResourceManager = new ShaderResourceManager(graphicsService);
 
             var graphicsAdapterName = this.graphicsService.GetGraphicsAdapterName().Replace("\0", "");
             this.graphicsAdapterName = (graphicsAdapterName != null) ? graphicsAdapterName : "Unknown Graphics Adapter";
 
-            graphicsBuffersToDelete[0] = new List<GraphicsBuffer>();
-            graphicsBuffersToDelete[1] = new List<GraphicsBuffer>();
-
-            texturesToDelete[0] = new List<Texture>();
-            texturesToDelete[1] = new List<Texture>();
+            // Resources released during a frame are deleted when the same frame slot is reused
+            this.graphicsBuffersToDelete = new List<GraphicsBuffer>[this.FramesInFlightCount];
+            this.texturesToDelete = new List<Texture>[this.FramesInFlightCount];
+            this.pipelineStatesToDelete = new List<PipelineState>[this.FramesInFlightCount];
+            this.shadersToDelete = new List<Shader>[this.FramesInFlightCount];
+            this.queryBuffersToDelete = new List<QueryBuffer>[this.FramesInFlightCount];
+            this.swapChainsToDelete = new List<SwapChain>[this.FramesInFlightCount];
+            this.graphicsHeapsToDelete = new List<GraphicsHeap>[this.FramesInFlightCount];
 
-            pipelineStatesToDelete[0] = new List<PipelineState>();
-            pipelineStatesToDelete[1] = new List<PipelineState>();
-
-            shadersToDelete[0] = new List<Shader>();
-            shadersToDelete[1] = new List<Shader>();
-
-            queryBuffersToDelete[0] = new List<QueryBuffer>();
-            queryBuffersToDelete[1] = new List<QueryBuffer>();
-
-            swapChainsToDelete[0] = new List<SwapChain>();
-            swapChainsToDelete[1] = new List<SwapChain>();
-
-            graphicsHeapsToDelete[0] = new List<GraphicsHeap>();
-            graphicsHeapsToDelete[1] = new List<GraphicsHeap>();
+            for (var i = 0; i < this.FramesInFlightCount; i++)
+            {
+                this.graphicsBuffersToDelete[i] = new List<GraphicsBuffer>();
+                this.texturesToDelete[i] = new List<Texture>();
+                this.pipelineStatesToDelete[i] = new List<PipelineState>();
+                this.shadersToDelete[i] = new List<Shader>();
+                this.queryBuffersToDelete[i] = new List<QueryBuffer>();
+                this.swapChainsToDelete[i] = new List<SwapChain>();
+                this.graphicsHeapsToDelete[i] = new List<GraphicsHeap>();
+            }
 
             this.resetCounterBuffer = CreateGraphicsBuffer<uint>(GraphicsHeapType.Upload, GraphicsBufferUsage.Storage, 1, isStatic: true, "ResetCounterBuffer");
             this.CopyDataToGraphicsBuffer<uint>(this.resetCounterBuffer, 0, new uint[] { 0 });
@@ -104,7 +120,6 @@ namespace CoreEngine.Graphics
             {
                 // TODO: Do something better here!
                 this.graphicsMemoryManager.Dispose();
-                this.shaderResourceManager.Dispose();
                 this.resetCounterBuffer.Dispose();
 
                 var tmpGraphicsBuffers = new GraphicsBuffer[this.graphicsBuffers.Count];
@@ -123,6 +138,9 @@ namespace CoreEngine.Graphics
                     DeleteTexture(tmpTextures[i]);
                 }
 
+                // The shader resources of the buffers and textures are released before the heap
+                this.shaderResourceManager.Dispose();
+
                 var tmpPipelineStates = new PipelineState[this.pipelineStates.Count];
                 this.pipelineStates.CopyTo(tmpPipelineStates);
 
@@ -139,6 +157,11 @@ namespace CoreEngine.Graphics
                     DeleteShader(tmpShaders[i]);
                 }
 
+                for (var i = 0; i < this.shaderArchives.Count; i++)
+                {
+                    this.graphicsService.CloseShaderArchive(this.shaderArchives[i]);
+                }
+
                 var tmpQueryBuffers = new QueryBuffer[this.queryBuffers.Count];
                 this.queryBuffers.CopyTo(tmpQueryBuffers);
 
@@ -172,6 +195,14 @@ namespace CoreEngine.Graphics
             set;
         }
 
+        public int FramesInFlightCount { get; }
+
+        // Zones of the last frame read back by the host, the timestamps are a few frames old
+        public IReadOnlyList<GpuZone> GpuZones => this.gpuZones;
+
+        // Slot of the current frame in the per frame resources
+        public int CurrentFrameIndex => (int)(this.CurrentFrameNumber % (uint)this.FramesInFlightCount);
+
         public ulong AllocatedGpuMemory 
         { 
             get
@@ -204,6 +235,22 @@ namespace CoreEngine.Graphics
             }
         }
 
+        public GraphicsMemoryBudget GpuMemoryBudget 
+        { 
+            get
+            {
+                return this.graphicsMemoryManager.GpuMemoryBudget;
+            }
+        }
+
+        public bool IsGpuMemoryOverBudget 
+        { 
+            get
+            {
+                return this.graphicsMemoryManager.IsGpuMemoryOverBudget;
+            }
+        }
+
         public CommandQueue CreateCommandQueue(CommandType queueType, string label)
         {
             var nativePointer = this.graphicsService.CreateCommandQueue((GraphicsServiceCommandType)queueType);
@@ -238,6 +285,11 @@ namespace CoreEngine.Graphics
             return this.graphicsService.GetCommandQueueTimestampFrequency(commandQueue.NativePointer);
         }
 
+        public GraphicsTimestampCalibration GetCommandQueueTimestampCalibration(in CommandQueue commandQueue)
+        {
+            return this.graphicsService.GetCommandQueueTimestampCalibration(commandQueue.NativePointer);
+        }
+
         public Fence ExecuteCommandLists(in CommandQueue commandQueue, ReadOnlySpan<CommandList> commandLists)
         {
             return ExecuteCommandLists(in commandQueue, commandLists, Array.Empty<Fence>());
@@ -249,15 +301,114 @@ namespace CoreEngine.Graphics
             // TODO: Refactor that code!
 
             var fencesToWaitArray = ArrayPool<GraphicsFence>.Shared.Rent(fencesToWait.Length);
-
-            CommandList? transitionCommandListBefore = null;
-            CommandList? transitionCommandListAfter = null;
+            var commandQueuesToWait = ArrayPool<CommandQueue>.Shared.Rent(fencesToWait.Length);
 
             for (var i = 0; i < fencesToWait.Length; i++)
             {
                 fencesToWaitArray[i] = new GraphicsFence(fencesToWait[i]);
+                commandQueuesToWait[i] = fencesToWait[i].CommandQueue;
+            }
+
+            var commandListsPointers = ArrayPool<IntPtr>.Shared.Rent(commandLists.Length + 2);
+            var commandListCount = PrepareCommandLists(commandQueue, commandLists, commandQueuesToWait.AsSpan(0, fencesToWait.Length), commandListsPointers, out var transitionCommandListBefore, out var transitionCommandListAfter);
+
+            var fenceValue = this.graphicsService.ExecuteCommandLists(commandQueue.NativePointer, commandListsPointers.AsSpan(0, commandListCount), fencesToWaitArray.AsSpan(0..fencesToWait.Length));
+            ArrayPool<IntPtr>.Shared.Return(commandListsPointers);
+            ArrayPool<GraphicsFence>.Shared.Return(fencesToWaitArray);
+            ArrayPool<CommandQueue>.Shared.Return(commandQueuesToWait, true);
+
+            ReleaseCommandLists(commandQueue, commandLists, transitionCommandListBefore, transitionCommandListAfter);
+            return new Fence(commandQueue, fenceValue);
+        }
+
+        public unsafe void ExecuteCommandLists(ReadOnlySpan<CommandListBatch> batches, Span<Fence> fences)
+        {
+            if (fences.Length < batches.Length)
+            {
+                throw new ArgumentException("The fences span must be at least as long as the batches span.", nameof(fences));
+            }
+
+            var commandListCount = 0;
+            var fenceCount = 0;
+
+            for (var i = 0; i < batches.Length; i++)
+            {
+                commandListCount += batches[i].CommandLists.Length + 2;
+                fenceCount += batches[i].FencesToWait.Length;
+            }
+
+            var commandListsPointers = ArrayPool<IntPtr>.Shared.Rent(commandListCount);
+            var fencesToWaitArray = ArrayPool<GraphicsFence>.Shared.Rent(fenceCount);
+            var commandQueuesToWait = ArrayPool<CommandQueue>.Shared.Rent(fenceCount + 1);
+            var transitionCommandLists = ArrayPool<CommandList?>.Shared.Rent(batches.Length * 2);
+            var graphicsBatches = ArrayPool<GraphicsCommandListBatch>.Shared.Rent(batches.Length);
+            var graphicsFences = ArrayPool<GraphicsFence>.Shared.Rent(batches.Length);
+
+            // All the batches are sent to the native side in one call, the pointers stored in the
+            // batches are slices of the pinned shared arrays
+            fixed (IntPtr* commandListsPointersPinned = commandListsPointers)
+            fixed (GraphicsFence* fencesToWaitPinned = fencesToWaitArray)
+            {
+                var commandListOffset = 0;
+                var fenceOffset = 0;
+
+                for (var i = 0; i < batches.Length; i++)
+                {
+                    var batch = batches[i];
+                    var commandQueuesToWaitCount = 0;
+
+                    for (var j = 0; j < batch.FencesToWait.Length; j++)
+                    {
+                        fencesToWaitArray[fenceOffset + j] = new GraphicsFence(batch.FencesToWait[j]);
+                        commandQueuesToWait[commandQueuesToWaitCount++] = batch.FencesToWait[j].CommandQueue;
+                    }
+
+                    if (batch.BatchIndexToWait >= 0)
+                    {
+                        if (batch.BatchIndexToWait >= i)
+                        {
+                            throw new ArgumentException("A batch can only wait for a previous batch.", nameof(batches));
+                        }
+
+                        commandQueuesToWait[commandQueuesToWaitCount++] = batches[batch.BatchIndexToWait].CommandQueue;
+                    }
+
+                    var batchCommandListCount = PrepareCommandLists(batch.CommandQueue, batch.CommandLists, commandQueuesToWait.AsSpan(0, commandQueuesToWaitCount), commandListsPointers.AsSpan(commandListOffset), out var transitionCommandListBefore, out var transitionCommandListAfter);
+                    transitionCommandLists[i * 2] = transitionCommandListBefore;
+                    transitionCommandLists[i * 2 + 1] = transitionCommandListAfter;
+
+                    graphicsBatches[i] = new GraphicsCommandListBatch(batch.CommandQueue.NativePointer, new IntPtr(commandListsPointersPinned + commandListOffset), batchCommandListCount, new IntPtr(fencesToWaitPinned + fenceOffset), batch.FencesToWait.Length, batch.BatchIndexToWait);
+
+                    commandListOffset += batchCommandListCount;
+                    fenceOffset += batch.FencesToWait.Length;
+                }
+
+                this.graphicsService.ExecuteCommandListBatches(graphicsBatches.AsSpan(0, batches.Length), graphicsFences.AsSpan(0, batches.Length));
+            }
+
+            for (var i = 0; i < batches.Length; i++)
+            {
+                ReleaseCommandLists(batches[i].CommandQueue, batches[i].CommandLists, transitionCommandLists[i * 2], transitionCommandLists[i * 2 + 1]);
+                fences[i] = new Fence(batches[i].CommandQueue, graphicsFences[i].Value);
+            }
+
+            ArrayPool<IntPtr>.Shared.Return(commandListsPointers);
+            ArrayPool<GraphicsFence>.Shared.Return(fencesToWaitArray);
+            ArrayPool<CommandQueue>.Shared.Return(commandQueuesToWait, true);
+            ArrayPool<CommandList?>.Shared.Return(transitionCommandLists, true);
+            ArrayPool<GraphicsCommandListBatch>.Shared.Return(graphicsBatches);
+            ArrayPool<GraphicsFence>.Shared.Return(graphicsFences);
+        }
 
-                var commandQueueToWait = fencesToWait[i].CommandQueue;
+        private int PrepareCommandLists(in CommandQueue commandQueue, ReadOnlySpan<CommandList> commandLists, ReadOnlySpan<CommandQueue> commandQueuesToWait, Span<IntPtr> commandListsPointers, out CommandList? transitionCommandListBefore, out CommandList? transitionCommandListAfter)
+        {
+            // Gpu buffers copied by the waited queues are transitioned by extra command lists executed before and after
+            transitionCommandListBefore = null;
+            transitionCommandListAfter = null;
+
+            for (var i = 0; i < commandQueuesToWait.Length; i++)
+            {
+                var commandQueueToWait = commandQueuesToWait[i];
 
                 for (var j = 0; j < commandQueueToWait.CurrentCopyBuffers.Count; j++)
                 {
@@ -275,26 +426,22 @@ namespace CoreEngine.Graphics
                 }
             }
 
-            var transitionCommandListCount = transitionCommandListBefore != null ? 2 : 0;
-            var transitionCommandListBeforeCount = transitionCommandListBefore != null ? 1 : 0;
-
-            var freeList = commandQueue.commandListFreeList;
-            var commandListsPointers = ArrayPool<IntPtr>.Shared.Rent(commandLists.Length + transitionCommandListCount);
+            var commandListCount = 0;
 
             if (transitionCommandListBefore != null)
             {
                 this.CommitCommandList(transitionCommandListBefore.Value);
-                commandListsPointers[0] = transitionCommandListBefore.Value.NativePointer;
+                commandListsPointers[commandListCount++] = transitionCommandListBefore.Value.NativePointer;
             }
             
             for (var i = 0; i < commandLists.Length; i++)
             {
-                commandListsPointers[i + transitionCommandListBeforeCount] = commandLists[i].NativePointer;
+                commandListsPointers[commandListCount++] = commandLists[i].NativePointer;
             }
 
-            for (var i = 0; i < fencesToWait.Length; i++)
+            for (var i = 0; i < commandQueuesToWait.Length; i++)
             {
-                var commandQueueToWait = fencesToWait[i].CommandQueue;
+                var commandQueueToWait = commandQueuesToWait[i];
 
                 for (var j = 0; j < commandQueueToWait.CurrentCopyBuffers.Count; j++)
                 {
@@ -317,29 +464,33 @@ namespace CoreEngine.Graphics
             if (transitionCommandListAfter != null)
             {
                 this.CommitCommandList(transitionCommandListAfter.Value);
-                commandListsPointers[commandLists.Length + transitionCommandListCount - 1] = transitionCommandListAfter.Value.NativePointer;
+                commandListsPointers[commandListCount++] = transitionCommandListAfter.Value.NativePointer;
             }
 
-            var fenceValue = this.graphicsService.ExecuteCommandLists(commandQueue.NativePointer, commandListsPointers.AsSpan(0..(commandLists.Length + transitionCommandListCount)), fencesToWaitArray.AsSpan(0..fencesToWait.Length));
-            ArrayPool<IntPtr>.Shared.Return(commandListsPointers);
-            ArrayPool<GraphicsFence>.Shared.Return(fencesToWaitArray);
+            return commandListCount;
+        }
 
-            if (transitionCommandListBefore != null)
-            {
-                freeList.Push(transitionCommandListBefore.Value);
-            }
-            
-            for (var i = 0; i < commandLists.Length; i++)
-            {
-                freeList.Push(commandLists[i]);
-            }
+        private static void ReleaseCommandLists(in CommandQueue commandQueue, ReadOnlySpan<CommandList> commandLists, CommandList? transitionCommandListBefore, CommandList? transitionCommandListAfter)
+        {
+            var freeList = commandQueue.commandListFreeList;
 
-            if (transitionCommandListAfter != null)
+            lock (freeList)
             {
-                freeList.Push(transitionCommandListAfter.Value);
-            }
+                if (transitionCommandListBefore != null)
+                {
+                    freeList.Push(transitionCommandListBefore.Value);
+                }
+                
+                for (var i = 0; i < commandLists.Length; i++)
+                {
+                    freeList.Push(commandLists[i]);
+                }
 
-            return new Fence(commandQueue, fenceValue);
+                if (transitionCommandListAfter != null)
+                {
+                    freeList.Push(transitionCommandListAfter.Value);
+                }
+            }
         }
 
         public void WaitForCommandQueueOnCpu(in Fence fenceToWait)
@@ -349,12 +500,22 @@ namespace CoreEngine.Graphics
 
         public CommandList CreateCommandList(in CommandQueue commandQueue, string label)
         {
-            // TODO: This code is not thread safe!
+            // NOTE: Command lists can be created and recorded from multiple threads
+            // but they need to be executed from one thread
             var freeList = commandQueue.commandListFreeList;
+            CommandList? freeCommandList = null;
+
+            lock (freeList)
+            {
+                if (freeList.Count > 0)
+                {
+                    freeCommandList = freeList.Pop();
+                }
+            }
 
-            if (freeList.Count > 0)
+            if (freeCommandList != null)
             {
-                var commandList = freeList.Pop();
+                var commandList = freeCommandList.Value;
                 this.graphicsService.ResetCommandList(commandList.NativePointer);
                 this.graphicsService.SetCommandListLabel(commandList.NativePointer, label);
 
@@ -399,36 +560,27 @@ namespace CoreEngine.Graphics
                 sizeInBytes += sizeof(uint);
             }
 
-            var allocation = this.graphicsMemoryManager.AllocateBuffer(heapType, (int)sizeInBytes);
-            var nativePointer1 = this.graphicsService.CreateGraphicsBuffer(allocation.GraphicsHeap.NativePointer, allocation.Offset, (HostServices.GraphicsBufferUsage)usage, (int)sizeInBytes);
-
-            if (nativePointer1 == IntPtr.Zero)
-            {
-                throw new InvalidOperationException("There was an error while creating the graphics buffer resource.");
-            }
-
-            this.graphicsService.SetGraphicsBufferLabel(nativePointer1, $"{label}{(isStatic ? string.Empty : "0") }");
-
-            IntPtr? nativePointer2 = null;
-            GraphicsMemoryAllocation? allocation2 = null;
+            var copyCount = isStatic ? 1 : this.FramesInFlightCount;
+            var allocations = new GraphicsMemoryAllocation[copyCount];
+            var nativePointers = new IntPtr[copyCount];
 
-            if (!isStatic)
+            for (var i = 0; i < copyCount; i++)
             {
-                allocation2 = this.graphicsMemoryManager.AllocateBuffer(heapType, (int)sizeInBytes);
-                nativePointer2 = this.graphicsService.CreateGraphicsBuffer(allocation2.Value.GraphicsHeap.NativePointer, allocation2.Value.Offset, (HostServices.GraphicsBufferUsage)usage, (int)sizeInBytes);
+                allocations[i] = this.graphicsMemoryManager.AllocateBuffer(heapType, (int)sizeInBytes);
+                nativePointers[i] = this.graphicsService.CreateGraphicsBuffer(allocations[i].GraphicsHeap.NativePointer, allocations[i].Offset, (HostServices.GraphicsBufferUsage)usage, (int)sizeInBytes);
 
-                if (nativePointer2.Value == IntPtr.Zero)
+                if (nativePointers[i] == IntPtr.Zero)
                 {
                     throw new InvalidOperationException("There was an error while creating the graphics buffer resource.");
                 }
 
-                this.graphicsService.SetGraphicsBufferLabel(nativePointer2.Value, $"{label}1");
+                this.graphicsService.SetGraphicsBufferLabel(nativePointers[i], $"{label}{(isStatic ? string.Empty : i.ToString(CultureInfo.InvariantCulture)) }");
             }
 
-            var graphicsBuffer = new GraphicsBuffer(this, allocation, allocation2, nativePointer1, nativePointer2, sizeInBytes, usage, isStatic, label);
+            var graphicsBuffer = new GraphicsBuffer(this, allocations, nativePointers, sizeInBytes, usage, isStatic, label);
             this.graphicsBuffers.Add(graphicsBuffer);
 
-            if (heapType == GraphicsHeapType.Gpu)
+            if (heapType == GraphicsHeapType.Gpu || heapType == GraphicsHeapType.GpuUpload)
             {
                 this.shaderResourceManager.CreateShaderResourceBuffer(graphicsBuffer, isWriteable: false);
 
@@ -449,7 +601,7 @@ namespace CoreEngine.Graphics
                 throw new ArgumentNullException(nameof(graphicsBuffer));
             }
 
-            if (graphicsBuffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Upload)
+            if (graphicsBuffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Upload && graphicsBuffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.GpuUpload)
             {
                 throw new InvalidOperationException($"Graphics buffer '{graphicsBuffer.Label}' is not an upload buffer.");
             }
@@ -490,7 +642,7 @@ namespace CoreEngine.Graphics
 
         internal void ScheduleDeleteGraphicsBuffer(GraphicsBuffer graphicsBuffer)
         {
-            this.graphicsBuffersToDelete[this.CurrentFrameNumber % 2].Add(graphicsBuffer);
+            this.graphicsBuffersToDelete[this.CurrentFrameIndex].Add(graphicsBuffer);
         }
 
         private void DeleteGraphicsBuffer(GraphicsBuffer graphicsBuffer)
@@ -500,20 +652,10 @@ namespace CoreEngine.Graphics
                 Logger.WriteMessage($"Deleting Graphics buffer {graphicsBuffer.Label}...");
             }
 
-            this.graphicsService.DeleteGraphicsBuffer(graphicsBuffer.NativePointer1);
-            this.graphicsMemoryManager.FreeAllocation(graphicsBuffer.GraphicsMemoryAllocation);
-
-            if (!graphicsBuffer.IsStatic)
+            for (var i = 0; i < graphicsBuffer.NativePointers.Length; i++)
             {
-                if (graphicsBuffer.NativePointer2 != null)
-                {
-                    this.graphicsService.DeleteGraphicsBuffer(graphicsBuffer.NativePointer2.Value);
-                }
-
-                if (graphicsBuffer.GraphicsMemoryAllocation2 != null)
-                {
-                    this.graphicsMemoryManager.FreeAllocation(graphicsBuffer.GraphicsMemoryAllocation2.Value);
-                }
+                this.graphicsService.DeleteGraphicsBuffer(graphicsBuffer.NativePointers[i]);
+                this.graphicsMemoryManager.FreeAllocation(graphicsBuffer.GraphicsMemoryAllocations[i]);
             }
 
             // TODO: Use something faster here
@@ -524,58 +666,48 @@ namespace CoreEngine.Graphics
         // TODO: Do not forget to find a way to delete the transient resource
         public Texture CreateTexture(GraphicsHeapType heapType, TextureFormat textureFormat, TextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount, bool isStatic, string label)
         {
-            var allocation = this.graphicsMemoryManager.AllocateTexture(heapType, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
-            var nativePointer1 = this.graphicsService.CreateTexture(allocation.GraphicsHeap.NativePointer, allocation.Offset, allocation.IsAliasable, (GraphicsTextureFormat)(int)textureFormat, (GraphicsTextureUsage)usage, width, height, faceCount, mipLevels, multisampleCount);
+            var copyCount = isStatic ? 1 : this.FramesInFlightCount;
+            var allocations = new GraphicsMemoryAllocation[copyCount];
+            var nativePointers = new IntPtr[copyCount];
 
-            if (nativePointer1 == IntPtr.Zero)
+            for (var i = 0; i < copyCount; i++)
             {
-                throw new InvalidOperationException("There was an error while creating the texture resource.");
-            }
+                allocations[i] = this.graphicsMemoryManager.AllocateTexture(heapType, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
+                nativePointers[i] = this.graphicsService.CreateTexture(allocations[i].GraphicsHeap.NativePointer, allocations[i].Offset, allocations[i].IsAliasable, (GraphicsTextureFormat)(int)textureFormat, (GraphicsTextureUsage)usage, width, height, faceCount, mipLevels, multisampleCount);
 
-            this.graphicsService.SetTextureLabel(nativePointer1, $"{label}{(isStatic ? string.Empty : "0") }");
-
-            IntPtr? nativePointer2 = null;
-            GraphicsMemoryAllocation? allocation2 = null;
-
-            if (!isStatic)
-            {
-                allocation2 = this.graphicsMemoryManager.AllocateTexture(heapType, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
-                nativePointer2 = this.graphicsService.CreateTexture(allocation2.Value.GraphicsHeap.NativePointer, allocation2.Value.Offset, allocation2.Value.IsAliasable, (GraphicsTextureFormat)(int)textureFormat, (GraphicsTextureUsage)usage, width, height, faceCount, mipLevels, multisampleCount);
-                
-                if (nativePointer2.Value == IntPtr.Zero)
+                if (nativePointers[i] == IntPtr.Zero)
                 {
                     throw new InvalidOperationException("There was an error while creating the texture resource.");
                 }
 
-                this.graphicsService.SetTextureLabel(nativePointer2.Value, $"{label}1");
+                this.graphicsService.SetTextureLabel(nativePointers[i], $"{label}{(isStatic ? string.Empty : i.ToString(CultureInfo.InvariantCulture)) }");
             }
 
-            var texture = new Texture(this, this.shaderResourceManager, allocation, allocation2, nativePointer1, nativePointer2, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount, isStatic, label);
+            var texture = new Texture(this, this.shaderResourceManager, allocations, nativePointers, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount, isStatic, label);
             this.textures.Add(texture);
 
             // TODO: Don't create the shader resources at once but only on demand?
             if (heapType == GraphicsHeapType.Gpu || heapType == GraphicsHeapType.TransientGpu)
             {
-                this.shaderResourceManager.CreateShaderResourceTexture(texture, isWriteable: false, mipLevel: 0, out var shaderResourceIndex1, out var shaderResourceIndex2);
-                texture.ShaderResourceIndex1 = shaderResourceIndex1;
-                texture.ShaderResourceIndex2 = shaderResourceIndex2;
+                this.shaderResourceManager.CreateShaderResourceTexture(texture, isWriteable: false, mipLevel: 0, texture.ShaderResourceIndexes);
 
                 if (usage == TextureUsage.ShaderWrite)
                 {
+                    Span<uint> shaderResourceIndexes = stackalloc uint[copyCount];
+
                     for (var i = 0; i < mipLevels; i++)
                     {
-                        this.shaderResourceManager.CreateShaderResourceTexture(texture, isWriteable: true, (uint)i, out shaderResourceIndex1, out shaderResourceIndex2);
-                        texture.WriteableShaderResourceIndex1[i] = shaderResourceIndex1;
+                        this.shaderResourceManager.CreateShaderResourceTexture(texture, isWriteable: true, (uint)i, shaderResourceIndexes);
 
-                        if (!texture.IsStatic && shaderResourceIndex2 != null)
+                        for (var j = 0; j < copyCount; j++)
                         {
-                            texture.WriteableShaderResourceIndex2[i] = shaderResourceIndex2.Value;
+                            texture.WriteableShaderResourceIndexes[j][i] = shaderResourceIndexes[j];
                         }
                     }
                 }
             }
             
-            if (allocation.IsAliasable)
+            if (allocations[0].IsAliasable)
             {
                 aliasableTextures.Add(texture);
             }
@@ -585,7 +717,7 @@ namespace CoreEngine.Graphics
 
         internal void ScheduleDeleteTexture(Texture texture)
         {
-            this.texturesToDelete[this.CurrentFrameNumber % 2].Add(texture);
+            this.texturesToDelete[this.CurrentFrameIndex].Add(texture);
         }
 
         public void DeleteTexture(Texture texture)
@@ -600,20 +732,10 @@ namespace CoreEngine.Graphics
                 Logger.WriteMessage($"Deleting Texture {texture.Label}...");
             }
 
-            this.graphicsService.DeleteTexture(texture.NativePointer1);
-            this.graphicsMemoryManager.FreeAllocation(texture.GraphicsMemoryAllocation);
-
-            if (!texture.IsStatic)
+            for (var i = 0; i < texture.NativePointers.Length; i++)
             {
-                if (texture.NativePointer2 != null)
-                {
-                    this.graphicsService.DeleteTexture(texture.NativePointer2.Value);
-                }
-
-                if (texture.GraphicsMemoryAllocation2 != null)
-                {
-                    this.graphicsMemoryManager.FreeAllocation(texture.GraphicsMemoryAllocation2.Value);
-                }
+                this.graphicsService.DeleteTexture(texture.NativePointers[i]);
+                this.graphicsMemoryManager.FreeAllocation(texture.GraphicsMemoryAllocations[i]);
             }
 
             this.shaderResourceManager.DeleteShaderResourceTexture(texture);
@@ -622,21 +744,21 @@ namespace CoreEngine.Graphics
             this.textures.Remove(texture);
         }
 
-        public SwapChain CreateSwapChain(in Window window, in CommandQueue commandQueue, int width, int height, TextureFormat textureFormat)
+        public SwapChain CreateSwapChain(in Window window, in CommandQueue commandQueue, int width, int height, TextureFormat textureFormat, PresentMode presentMode = PresentMode.Fifo, int backBufferCount = 0)
         {
             if (commandQueue.Type != CommandType.Present)
             {
                 throw new ArgumentException("Command queue used by the swap-chain should be a present queue.", nameof(commandQueue));
             }
 
-            var nativePointer = this.graphicsService.CreateSwapChain(window.NativePointer, commandQueue.NativePointer, width, height, (GraphicsTextureFormat)textureFormat);
+            var nativePointer = this.graphicsService.CreateSwapChain(window.NativePointer, commandQueue.NativePointer, width, height, (GraphicsTextureFormat)textureFormat, (GraphicsPresentMode)presentMode, backBufferCount);
 
             if (nativePointer == IntPtr.Zero)
             {
                 throw new InvalidOperationException("There was an error while creating the swap-chain.");
             }
 
-            var swapChain = new SwapChain(this, nativePointer, commandQueue, width, height, textureFormat);
+            var swapChain = new SwapChain(this, nativePointer, commandQueue, width, height, textureFormat, presentMode);
             this.swapChains.Add(swapChain);
             
             return swapChain;
@@ -662,7 +784,7 @@ namespace CoreEngine.Graphics
 
         internal void ScheduleDeleteSwapChain(SwapChain swapChain)
         {
-            this.swapChainsToDelete[this.CurrentFrameNumber % 2].Add(swapChain);
+            this.swapChainsToDelete[this.CurrentFrameIndex].Add(swapChain);
         }
 
         internal GraphicsHeap CreateGraphicsHeap(GraphicsHeapType heapType, ulong sizeInBytes, string label)
@@ -696,7 +818,7 @@ namespace CoreEngine.Graphics
 
         internal void ScheduleDeleteGraphicsHeap(in GraphicsHeap graphicsHeap)
         {
-            this.graphicsHeapsToDelete[this.CurrentFrameNumber % 2].Add(graphicsHeap);
+            this.graphicsHeapsToDelete[this.CurrentFrameIndex].Add(graphicsHeap);
         }
 
         public void ResizeSwapChain(SwapChain swapChain, int width, int height)
@@ -725,7 +847,7 @@ namespace CoreEngine.Graphics
             }
 
             var textureNativePointer = this.graphicsService.GetSwapChainBackBufferTexture(swapChain.NativePointer);
-            return new Texture(this, this.shaderResourceManager, new GraphicsMemoryAllocation(), null, textureNativePointer, null, swapChain.TextureFormat, TextureUsage.RenderTarget, swapChain.Width, swapChain.Height, 1, 1, 1, isStatic: true, "BackBuffer");
+            return new Texture(this, this.shaderResourceManager, new GraphicsMemoryAllocation[1], new IntPtr[] { textureNativePointer }, swapChain.TextureFormat, TextureUsage.RenderTarget, swapChain.Width, swapChain.Height, 1, 1, 1, isStatic: true, "BackBuffer");
         }
 
         public Fence PresentSwapChain(SwapChain swapChain)
@@ -751,25 +873,21 @@ namespace CoreEngine.Graphics
 
         public QueryBuffer CreateQueryBuffer(QueryBufferType queryBufferType, int length, string label)
         {
-            var nativePointer1 = this.graphicsService.CreateQueryBuffer((GraphicsQueryBufferType)queryBufferType, length);
+            var nativePointers = new IntPtr[this.FramesInFlightCount];
 
-            if (nativePointer1 == IntPtr.Zero)
+            for (var i = 0; i < nativePointers.Length; i++)
             {
-                throw new InvalidOperationException("There was an error while creating the query buffer resource.");
-            }
-
-            this.graphicsService.SetQueryBufferLabel(nativePointer1, label);
+                nativePointers[i] = this.graphicsService.CreateQueryBuffer((GraphicsQueryBufferType)queryBufferType, length);
 
-            IntPtr nativePointer2 = this.graphicsService.CreateQueryBuffer((GraphicsQueryBufferType)queryBufferType, length);
+                if (nativePointers[i] == IntPtr.Zero)
+                {
+                    throw new InvalidOperationException("There was an error while creating the query buffer resource.");
+                }
 
-            if (nativePointer2 == IntPtr.Zero)
-            {
-                throw new InvalidOperationException("There was an error while creating the query buffer resource.");
+                this.graphicsService.SetQueryBufferLabel(nativePointers[i], label);
             }
 
-            this.graphicsService.SetQueryBufferLabel(nativePointer2, label);
-
-            var queryBuffer = new QueryBuffer(this, nativePointer1, nativePointer2, length, label);
+            var queryBuffer = new QueryBuffer(this, nativePointers, length, label);
             this.queryBuffers.Add(queryBuffer);
 
             return queryBuffer;
@@ -792,11 +910,9 @@ namespace CoreEngine.Graphics
                 throw new ArgumentNullException(nameof(queryBuffer));
             }
 
-            this.graphicsService.DeleteQueryBuffer(queryBuffer.NativePointer1);
-
-            if (queryBuffer.NativePointer2 != null)
+            for (var i = 0; i < queryBuffer.NativePointers.Length; i++)
             {
-                this.graphicsService.DeleteQueryBuffer(queryBuffer.NativePointer2.Value);
+                this.graphicsService.DeleteQueryBuffer(queryBuffer.NativePointers[i]);
             }
 
             // TODO: Use something faster here
@@ -805,7 +921,7 @@ namespace CoreEngine.Graphics
 
         internal void ScheduleDeleteQueryBuffer(QueryBuffer queryBuffer)
         {
-            this.queryBuffersToDelete[this.CurrentFrameNumber % 2].Add(queryBuffer);
+            this.queryBuffersToDelete[this.CurrentFrameIndex].Add(queryBuffer);
         }
 
         internal Shader CreateShader(string? computeShaderFunction, ReadOnlySpan<byte> shaderByteCode, string label)
@@ -825,9 +941,43 @@ namespace CoreEngine.Graphics
             return shader;
         }
 
+        public bool OpenShaderArchive(string path)
+        {
+            var nativePointer = this.graphicsService.OpenShaderArchive(Path.GetFullPath(path));
+
+            if (nativePointer == IntPtr.Zero)
+            {
+                return false;
+            }
+
+            Logger.WriteMessage($"Opened shader archive '{path}'");
+            this.shaderArchives.Add(nativePointer);
+            return true;
+        }
+
+        internal Shader? CreateShaderFromArchive(string shaderName, string label)
+        {
+            for (var i = 0; i < this.shaderArchives.Count; i++)
+            {
+                var nativePointer = this.graphicsService.CreateShaderFromArchive(this.shaderArchives[i], shaderName);
+
+                if (nativePointer != IntPtr.Zero)
+                {
+                    this.graphicsService.SetShaderLabel(nativePointer, label);
+
+                    var shader = new Shader(this, nativePointer, label);
+                    this.shaders.Add(shader);
+
+                    return shader;
+                }
+            }
+
+            return null;
+        }
+
         internal void ScheduleDeletePipelineState(in PipelineState pipelineState)
         {
-            this.pipelineStatesToDelete[this.CurrentFrameNumber % 2].Add(pipelineState);
+            this.pipelineStatesToDelete[this.CurrentFrameIndex].Add(pipelineState);
         }
 
         private void DeletePipelineState(in PipelineState pipelineState)
@@ -839,8 +989,16 @@ namespace CoreEngine.Graphics
 
             this.graphicsService.DeletePipelineState(pipelineState.NativePointer);
 
+            lock (this.compilingPipelineStates)
+            {
+                this.compilingPipelineStates.Remove(pipelineState.NativePointer);
+            }
+
             // TODO: Use something faster here
-            this.pipelineStates.Remove(pipelineState);
+            lock (this.pipelineStates)
+            {
+                this.pipelineStates.Remove(pipelineState);
+            }
         }
 
         internal void ScheduleDeleteShader(Shader shader)
@@ -855,7 +1013,7 @@ namespace CoreEngine.Graphics
                 this.ScheduleDeletePipelineState(shader.ComputePipelineState.Value);
             }
 
-            this.shadersToDelete[this.CurrentFrameNumber % 2].Add(shader);
+            this.shadersToDelete[this.CurrentFrameIndex].Add(shader);
         }
 
         private void DeleteShader(Shader shader)
@@ -1010,6 +1168,11 @@ namespace CoreEngine.Graphics
                 throw new InvalidOperationException("The specified command list is not a render command list.");
             }
 
+            lock (this.skippedRenderPassCommandLists)
+            {
+                this.skippedRenderPassCommandLists.Remove(commandList.NativePointer);
+            }
+
             this.graphicsService.EndRenderPass(commandList.NativePointer);
         }
 
@@ -1028,57 +1191,195 @@ namespace CoreEngine.Graphics
             this.shaderResourceManager.SetShaderResourceHeap(in commandList);
             this.graphicsService.SetShader(commandList.NativePointer, shader.NativePointer);
 
-            if (renderPassDescriptor != null && !shader.PipelineStates.ContainsKey(renderPassDescriptor.Value))
+            // Render pipeline states are compiled on the host worker threads and the draws of the pass are skipped
+            // until they are ready. Compute results are read by the next passes so compute pipeline states are waited on.
+            if (renderPassDescriptor != null)
             {
-                Logger.WriteMessage($"Create Pipeline State for shader {shader.Label}...");
+                if (!CompilePipelineStateAsync(shader, renderPassDescriptor))
+                {
+                    lock (this.skippedRenderPassCommandLists)
+                    {
+                        this.skippedRenderPassCommandLists.Add(commandList.NativePointer);
+                    }
+
+                    return;
+                }
 
-                var nativePointer = this.graphicsService.CreatePipelineState(shader.NativePointer, renderPassDescriptor.Value);
+                PipelineState pipelineState;
 
-                if (nativePointer == IntPtr.Zero)
+                lock (shader)
                 {
-                    throw new InvalidOperationException("There was an error while creating the pipelinestate object.");
+                    pipelineState = shader.PipelineStates[renderPassDescriptor.Value];
                 }
 
-                this.graphicsService.SetPipelineStateLabel(nativePointer, $"{shader.Label}PSO");
+                this.graphicsService.SetPipelineState(commandList.NativePointer, pipelineState.NativePointer);
+            }
 
-                var pipelineState = new PipelineState(this, nativePointer, $"{shader.Label}PSO");
-                this.pipelineStates.Add(pipelineState);
-                shader.PipelineStates.Add(renderPassDescriptor.Value, pipelineState);
+            else if (commandList.Type == CommandType.Compute)
+            {
+                lock (shader)
+                {
+                    if (shader.ComputePipelineState == null)
+                    {
+                        CreatePipelineState(shader, null, isAsync: false);
+                    }
+                }
             }
 
-            else if (commandList.Type == CommandType.Compute && shader.ComputePipelineState == null)
+            if (renderPassDescriptor == null && shader.ComputePipelineState != null)
             {
-                Logger.WriteMessage($"Create Pipeline State for shader {shader.Label}...");
+                IsPipelineStateReady(shader.ComputePipelineState.Value, waitForCompletion: true);
+                this.graphicsService.SetPipelineState(commandList.NativePointer, shader.ComputePipelineState.Value.NativePointer);
+            }
+        }
 
-                var nativePointer = this.graphicsService.CreateComputePipelineState(shader.NativePointer);
+        // Starts the compilation of the pipeline state on the host worker threads and returns true when
+        // it is ready. A null render pass descriptor compiles the compute pipeline state of the shader.
+        public bool CompilePipelineStateAsync(Shader shader, in GraphicsRenderPassDescriptor? renderPassDescriptor)
+        {
+            if (shader == null)
+            {
+                throw new ArgumentNullException(nameof(shader));
+            }
 
-                if (nativePointer == IntPtr.Zero)
+            if (!shader.IsLoaded || shader.NativePointer == IntPtr.Zero)
+            {
+                return false;
+            }
+
+            PipelineState? pipelineState;
+
+            // The pipeline states of a shader are looked up and created by the recording threads
+            lock (shader)
+            {
+                pipelineState = shader.ComputePipelineState;
+
+                if (renderPassDescriptor != null && shader.PipelineStates.TryGetValue(renderPassDescriptor.Value, out var graphicsPipelineState))
                 {
-                    throw new InvalidOperationException("There was an error while creating the pipelinestate object.");
+                    pipelineState = graphicsPipelineState;
                 }
 
-                this.graphicsService.SetPipelineStateLabel(nativePointer, $"{shader.Label}PSO");
+                else if (renderPassDescriptor != null)
+                {
+                    pipelineState = null;
+                }
 
-                var pipelineState = new PipelineState(this, nativePointer, $"{shader.Label}PSO");
+                if (pipelineState == null)
+                {
+                    pipelineState = CreatePipelineState(shader, renderPassDescriptor, isAsync: true);
+                }
+            }
+
+            return IsPipelineStateReady(pipelineState.Value, waitForCompletion: false);
+        }
+
+        private PipelineState CreatePipelineState(Shader shader, in GraphicsRenderPassDescriptor? renderPassDescriptor, bool isAsync)
+        {
+            Logger.WriteMessage($"Create Pipeline State for shader {shader.Label}...");
+
+            IntPtr nativePointer;
+
+            if (isAsync)
+            {
+                nativePointer = this.graphicsService.CreatePipelineStateAsync(shader.NativePointer, renderPassDescriptor ?? default, renderPassDescriptor == null);
+            }
+
+            else if (renderPassDescriptor != null)
+            {
+                nativePointer = this.graphicsService.CreatePipelineState(shader.NativePointer, renderPassDescriptor.Value);
+            }
+
+            else
+            {
+                nativePointer = this.graphicsService.CreateComputePipelineState(shader.NativePointer);
+            }
+
+            if (nativePointer == IntPtr.Zero)
+            {
+                throw new InvalidOperationException("There was an error while creating the pipelinestate object.");
+            }
 
+            var pipelineState = new PipelineState(this, nativePointer, $"{shader.Label}PSO");
+            lock (this.pipelineStates)
+            {
                 this.pipelineStates.Add(pipelineState);
-                shader.ComputePipelineState = pipelineState;
             }
 
             if (renderPassDescriptor != null)
             {
-                this.graphicsService.SetPipelineState(commandList.NativePointer, shader.PipelineStates[renderPassDescriptor.Value].NativePointer);
+                shader.PipelineStates.Add(renderPassDescriptor.Value, pipelineState);
             }
 
-            else if (shader.ComputePipelineState != null)
+            else
             {
-                this.graphicsService.SetPipelineState(commandList.NativePointer, shader.ComputePipelineState.Value.NativePointer);
+                shader.ComputePipelineState = pipelineState;
+            }
+
+            // The label of a compiling pipeline state is set when it becomes ready
+            if (isAsync)
+            {
+                lock (this.compilingPipelineStates)
+                {
+                    this.compilingPipelineStates.Add(nativePointer);
+                }
+            }
+
+            else
+            {
+                this.graphicsService.SetPipelineStateLabel(nativePointer, pipelineState.Label);
+            }
+
+            return pipelineState;
+        }
+
+        private bool IsPipelineStateReady(in PipelineState pipelineState, bool waitForCompletion)
+        {
+            lock (this.compilingPipelineStates)
+            {
+                if (!this.compilingPipelineStates.Contains(pipelineState.NativePointer))
+                {
+                    return true;
+                }
+            }
+
+            // The wait is done without the lock so that the other recording threads are not blocked
+            if (!this.graphicsService.IsPipelineStateReady(pipelineState.NativePointer, waitForCompletion))
+            {
+                return false;
+            }
+
+            bool isRemoved;
+
+            lock (this.compilingPipelineStates)
+            {
+                isRemoved = this.compilingPipelineStates.Remove(pipelineState.NativePointer);
+            }
+
+            if (isRemoved)
+            {
+                this.graphicsService.SetPipelineStateLabel(pipelineState.NativePointer, pipelineState.Label);
+            }
+
+            return true;
+        }
+
+        private bool IsRenderPassSkipped(in CommandList commandList)
+        {
+            lock (this.skippedRenderPassCommandLists)
+            {
+                return this.skippedRenderPassCommandLists.Contains(commandList.NativePointer);
             }
         }
 
         // TODO: Do another overload to be able to specify a struct of uint instead?
         public void SetShaderParameterValues(in CommandList commandList, uint slot, ReadOnlySpan<uint> values)
         {
+            // The pipeline state of a skipped render pass is not bound so there is no layout for the values
+            if (IsRenderPassSkipped(commandList))
+            {
+                return;
+            }
+
             this.graphicsService.SetShaderParameterValues(commandList.NativePointer, slot, values);
         }
 
@@ -1124,6 +1425,11 @@ namespace CoreEngine.Graphics
                 throw new ArgumentOutOfRangeException(nameof(threadGroupCountZ));
             }
 
+            if (IsRenderPassSkipped(commandList))
+            {
+                return;
+            }
+
             this.graphicsService.DispatchMesh(commandList.NativePointer, threadGroupCountX, threadGroupCountY, threadGroupCountZ);
             this.cpuDrawCount++;
         }
@@ -1140,6 +1446,11 @@ namespace CoreEngine.Graphics
                 throw new ArgumentNullException(nameof(commandGraphicsBuffer));
             }
 
+            if (IsRenderPassSkipped(commandList))
+            {
+                return;
+            }
+
             this.graphicsService.ExecuteIndirect(commandList.NativePointer, maxCommandCount, commandGraphicsBuffer.NativePointer, commandBufferOffset);
         }
 
@@ -1179,6 +1490,36 @@ namespace CoreEngine.Graphics
             this.graphicsService.ResolveQueryData(commandList.NativePointer, queryBuffer.NativePointer, destinationBuffer.NativePointer, offsetAndLength.Offset, offsetAndLength.Length);
         }
 
+        public void BeginGpuZone(in CommandList commandList, string name)
+        {
+            if (name == null)
+            {
+                throw new ArgumentNullException(nameof(name));
+            }
+
+            uint nameId;
+
+            // Names are interned per command queue so the resolved zones know their queue
+            lock (this.gpuZoneNameIds)
+            {
+                if (!this.gpuZoneNameIds.TryGetValue((name, commandList.CommandQueue.NativePointer), out nameId))
+                {
+                    nameId = (uint)this.gpuZoneNames.Count;
+
+                    this.gpuZoneNameIds.Add((name, commandList.CommandQueue.NativePointer), nameId);
+                    this.gpuZoneNames.Add(name);
+                    this.gpuZoneCommandQueues.Add(commandList.CommandQueue);
+                }
+            }
+
+            this.graphicsService.BeginGpuZone(commandList.NativePointer, nameId, name);
+        }
+
+        public void EndGpuZone(in CommandList commandList)
+        {
+            this.graphicsService.EndGpuZone(commandList.NativePointer);
+        }
+
         public void MoveToNextFrame()
         {
             for (var i = 0; i < this.aliasableTextures.Count; i++)
@@ -1196,48 +1537,64 @@ namespace CoreEngine.Graphics
             this.cpuDispatchCount = 0;
 
             this.graphicsMemoryManager.Reset(this.CurrentFrameNumber);
+            ResolveGpuZones();
 
-            for (var i = 0; i < this.graphicsBuffersToDelete[this.CurrentFrameNumber % 2].Count; i++)
+            for (var i = 0; i < this.graphicsBuffersToDelete[this.CurrentFrameIndex].Count; i++)
             {
-                this.DeleteGraphicsBuffer(this.graphicsBuffersToDelete[this.CurrentFrameNumber % 2][i]);
+                this.DeleteGraphicsBuffer(this.graphicsBuffersToDelete[this.CurrentFrameIndex][i]);
             }
 
-            this.graphicsBuffersToDelete[this.CurrentFrameNumber % 2].Clear();
+            this.graphicsBuffersToDelete[this.CurrentFrameIndex].Clear();
 
-            for (var i = 0; i < this.queryBuffersToDelete[this.CurrentFrameNumber % 2].Count; i++)
+            for (var i = 0; i < this.queryBuffersToDelete[this.CurrentFrameIndex].Count; i++)
             {
-                this.DeleteQueryBuffer(this.queryBuffersToDelete[this.CurrentFrameNumber % 2][i]);
+                this.DeleteQueryBuffer(this.queryBuffersToDelete[this.CurrentFrameIndex][i]);
             }
 
-            this.queryBuffersToDelete[this.CurrentFrameNumber % 2].Clear();
+            this.queryBuffersToDelete[this.CurrentFrameIndex].Clear();
 
-            for (var i = 0; i < this.texturesToDelete[this.CurrentFrameNumber % 2].Count; i++)
+            for (var i = 0; i < this.texturesToDelete[this.CurrentFrameIndex].Count; i++)
             {
-                this.DeleteTexture(this.texturesToDelete[this.CurrentFrameNumber % 2][i]);
+                this.DeleteTexture(this.texturesToDelete[this.CurrentFrameIndex][i]);
             }
 
-            this.texturesToDelete[this.CurrentFrameNumber % 2].Clear();
+            this.texturesToDelete[this.CurrentFrameIndex].Clear();
 
-            for (var i = 0; i < this.pipelineStatesToDelete[this.CurrentFrameNumber % 2].Count; i++)
+            for (var i = 0; i < this.pipelineStatesToDelete[this.CurrentFrameIndex].Count; i++)
             {
-                this.DeletePipelineState(this.pipelineStatesToDelete[this.CurrentFrameNumber % 2][i]);
+                this.DeletePipelineState(this.pipelineStatesToDelete[this.CurrentFrameIndex][i]);
             }
 
-            this.pipelineStatesToDelete[this.CurrentFrameNumber % 2].Clear();
+            this.pipelineStatesToDelete[this.CurrentFrameIndex].Clear();
 
-            for (var i = 0; i < this.shadersToDelete[this.CurrentFrameNumber % 2].Count; i++)
+            for (var i = 0; i < this.shadersToDelete[this.CurrentFrameIndex].Count; i++)
             {
-                this.DeleteShader(this.shadersToDelete[this.CurrentFrameNumber % 2][i]);
+                this.DeleteShader(this.shadersToDelete[this.CurrentFrameIndex][i]);
             }
 
-            this.shadersToDelete[this.CurrentFrameNumber % 2].Clear();
+            this.shadersToDelete[this.CurrentFrameIndex].Clear();
 
-            for (var i = 0; i < this.graphicsHeapsToDelete[this.CurrentFrameNumber % 2].Count; i++)
+            for (var i = 0; i < this.graphicsHeapsToDelete[this.CurrentFrameIndex].Count; i++)
             {
-                this.DeleteGraphicsHeap(this.graphicsHeapsToDelete[this.CurrentFrameNumber % 2][i]);
+                this.DeleteGraphicsHeap(this.graphicsHeapsToDelete[this.CurrentFrameIndex][i]);
             }
 
-            this.graphicsHeapsToDelete[this.CurrentFrameNumber % 2].Clear();
+            this.graphicsHeapsToDelete[this.CurrentFrameIndex].Clear();
+        }
+
+        private void ResolveGpuZones()
+        {
+            var gpuZoneCount = this.graphicsService.ResolveGpuZones(this.resolvedGpuZones);
+            this.gpuZones.Clear();
+
+            lock (this.gpuZoneNameIds)
+            {
+                for (var i = 0; i < gpuZoneCount; i++)
+                {
+                    var gpuZone = this.resolvedGpuZones[i];
+                    this.gpuZones.Add(new GpuZone(this.gpuZoneNames[(int)gpuZone.NameId], this.gpuZoneCommandQueues[(int)gpuZone.NameId], (int)gpuZone.Depth, gpuZone.StartTimestamp, gpuZone.EndTimestamp));
+                }
+            }
         }
 
         private void InitResourceLoaders(ResourcesManager resourcesManager)
@@ -1,4 +1,5 @@
 using System;
+using CoreEngine.Diagnostics;
 using CoreEngine.HostServices;
 
 namespace CoreEngine.Graphics
@@ -7,6 +8,9 @@ namespace CoreEngine.Graphics
 
     public class GraphicsMemoryManager : IDisposable
     {
+        // Ratio of the budget above which the memory is trimmed, drivers start paging when the budget is exceeded
+        private const double memoryBudgetThreshold = 0.9;
+
         private readonly IGraphicsService graphicsService;
 
         private bool isDisposed;
@@ -15,6 +19,7 @@ namespace CoreEngine.Graphics
         private readonly IGraphicsMemoryAllocator globalTransientGpuMemoryAllocator;
         private readonly IGraphicsMemoryAllocator globalUploadMemoryAllocator;
         private readonly IGraphicsMemoryAllocator globalReadBackMemoryAllocator;
+        private readonly IGraphicsMemoryAllocator globalGpuUploadMemoryAllocator;
 
         public GraphicsMemoryManager(GraphicsManager graphicsManager, IGraphicsService graphicsService)
         {
@@ -26,6 +31,9 @@ namespace CoreEngine.Graphics
             this.globalTransientGpuMemoryAllocator = new TransientGraphicsMemoryAllocator(graphicsManager, GraphicsHeapType.Gpu, Utils.MegaBytesToBytes(128), "GlobalTransientGpuHeap");
             this.globalUploadMemoryAllocator = new BlockGraphicsMemoryAllocator(graphicsManager, GraphicsHeapType.Upload, Utils.MegaBytesToBytes(512), "GlobalUploadHeap");
             this.globalReadBackMemoryAllocator = new BlockGraphicsMemoryAllocator(graphicsManager, GraphicsHeapType.ReadBack, Utils.MegaBytesToBytes(32), "GlobalReadBackHeap");
+
+            // Without resizable BAR the device local host visible memory is only 256 MB so the blocks are kept small
+            this.globalGpuUploadMemoryAllocator = new BlockGraphicsMemoryAllocator(graphicsManager, GraphicsHeapType.GpuUpload, Utils.MegaBytesToBytes(16), "GlobalGpuUploadHeap");
         }
 
         public void Dispose()
@@ -42,6 +50,7 @@ namespace CoreEngine.Graphics
                 this.globalTransientGpuMemoryAllocator.Dispose();
                 this.globalUploadMemoryAllocator.Dispose();
                 this.globalReadBackMemoryAllocator.Dispose();
+                this.globalGpuUploadMemoryAllocator.Dispose();
 
                 this.isDisposed = true;
             }
@@ -53,6 +62,12 @@ namespace CoreEngine.Graphics
         public ulong TotalTransientGpuMemory => this.globalTransientGpuMemoryAllocator.TotalMemory;
         public ulong AllocatedCpuMemory => this.globalUploadMemoryAllocator.AllocatedMemory + this.globalReadBackMemoryAllocator.AllocatedMemory;
 
+        public GraphicsMemoryBudget GpuMemoryBudget { get; private set; }
+        public GraphicsMemoryBudget CpuMemoryBudget { get; private set; }
+
+        // Set when the GPU memory stays above the budget threshold after trimming, loaders can use it to reduce the quality of the resources
+        public bool IsGpuMemoryOverBudget { get; private set; }
+
         // TODO: Change that, currently we are just blindly sequentially allocate memory without freeing it
         public GraphicsMemoryAllocation AllocateBuffer(GraphicsHeapType heapType, int sizeInBytes)
         {
@@ -69,6 +84,11 @@ namespace CoreEngine.Graphics
                 memoryAllocator = this.globalReadBackMemoryAllocator;
             }
 
+            else if (heapType == GraphicsHeapType.GpuUpload)
+            {
+                memoryAllocator = this.globalGpuUploadMemoryAllocator;
+            }
+
             return memoryAllocator.AllocateMemory(allocationInfos.SizeInBytes, (ulong)allocationInfos.Alignment);
         }
 
@@ -103,6 +123,11 @@ namespace CoreEngine.Graphics
                 memoryAllocator = this.globalTransientGpuMemoryAllocator;
             }
 
+            else if (allocation.GraphicsHeap.Type == GraphicsHeapType.GpuUpload)
+            {
+                memoryAllocator = this.globalGpuUploadMemoryAllocator;
+            }
+
             memoryAllocator.FreeMemory(in allocation);
 
             //this.AllocatedGpuMemory -= (ulong)allocation.SizeInBytes;
@@ -117,6 +142,48 @@ namespace CoreEngine.Graphics
             this.globalTransientGpuMemoryAllocator.Reset(currentFrameNumber);
             this.globalUploadMemoryAllocator.Reset(currentFrameNumber);
             this.globalReadBackMemoryAllocator.Reset(currentFrameNumber);
+            this.globalGpuUploadMemoryAllocator.Reset(currentFrameNumber);
+
+            UpdateMemoryBudgets();
+        }
+
+        private void UpdateMemoryBudgets()
+        {
+            this.GpuMemoryBudget = this.graphicsService.GetMemoryBudget(GraphicsServiceHeapType.Gpu);
+            this.CpuMemoryBudget = this.graphicsService.GetMemoryBudget(GraphicsServiceHeapType.Upload);
+
+            if (IsAboveBudgetThreshold(this.CpuMemoryBudget))
+            {
+                var releasedMemory = this.globalUploadMemoryAllocator.Trim() + this.globalReadBackMemoryAllocator.Trim();
+
+                if (releasedMemory > 0)
+                {
+                    Logger.WriteMessage($"CPU memory budget exceeded, released {Utils.BytesToMegaBytes(releasedMemory)} MB", LogMessageTypes.Warning);
+                }
+            }
+
+            var isGpuMemoryOverBudget = IsAboveBudgetThreshold(this.GpuMemoryBudget);
+
+            if (isGpuMemoryOverBudget)
+            {
+                var releasedMemory = this.globalGpuMemoryAllocator.Trim() + this.globalTransientGpuMemoryAllocator.Trim() + this.globalGpuUploadMemoryAllocator.Trim();
+
+                if (releasedMemory > 0)
+                {
+                    Logger.WriteMessage($"GPU memory budget exceeded, released {Utils.BytesToMegaBytes(releasedMemory)} MB", LogMessageTypes.Warning);
+                }
+            }
+
+            if (isGpuMemoryOverBudget != this.IsGpuMemoryOverBudget)
+            {
+                Logger.WriteMessage($"GPU memory usage: {Utils.BytesToMegaBytes(this.GpuMemoryBudget.UsageInBytes)} MB (Budget: {Utils.BytesToMegaBytes(this.GpuMemoryBudget.BudgetInBytes)} MB)", isGpuMemoryOverBudget ? LogMessageTypes.Warning : LogMessageTypes.Normal);
+                this.IsGpuMemoryOverBudget = isGpuMemoryOverBudget;
+            }
+        }
+
+        private static bool IsAboveBudgetThreshold(in GraphicsMemoryBudget memoryBudget)
+        {
+            return memoryBudget.UsageInBytes > memoryBudget.BudgetInBytes * memoryBudgetThreshold;
         }
     }
 }
\ No newline at end of file
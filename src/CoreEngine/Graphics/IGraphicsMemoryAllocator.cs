@@ -10,5 +10,8 @@ namespace CoreEngine.Graphics
         GraphicsMemoryAllocation AllocateMemory(int sizeInBytes, ulong alignment);
         void FreeMemory(in GraphicsMemoryAllocation allocation);
         void Reset(uint frameNumber);
+
+        // Releases the heaps that have no allocation and returns the number of released bytes
+        ulong Trim();
     }
 }
\ No newline at end of file
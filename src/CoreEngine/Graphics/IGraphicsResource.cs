@@ -5,8 +5,7 @@ namespace CoreEngine.Graphics
     public interface IGraphicsResource
     {
         IntPtr NativePointer { get; }
-        IntPtr NativePointer1 { get; }
-        IntPtr? NativePointer2 { get; }
+        IntPtr[] NativePointers { get; }
         bool IsStatic { get; }
         GraphicsResourceType ResourceType { get; }
         string Label { get; }
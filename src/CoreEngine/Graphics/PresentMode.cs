@@ -0,0 +1,9 @@
+namespace CoreEngine.Graphics
+{
+    public enum PresentMode
+    {
+        Fifo,
+        Mailbox,
+        Immediate
+    }
+}
\ No newline at end of file
@@ -9,11 +9,10 @@ namespace CoreEngine.Graphics
         private readonly GraphicsManager graphicsManager;
         private bool isDisposed;
 
-        internal QueryBuffer(GraphicsManager graphicsManager, IntPtr nativePointer1, IntPtr nativePointer2, int length, string label)
+        internal QueryBuffer(GraphicsManager graphicsManager, IntPtr[] nativePointers, int length, string label)
         {
             this.graphicsManager = graphicsManager;
-            this.NativePointer1 = nativePointer1;
-            this.NativePointer2 = nativePointer2;
+            this.NativePointers = nativePointers;
             this.Length = length;
             this.ResourceType = GraphicsResourceType.QueryBuffer;
             this.Label = label;
@@ -38,23 +37,11 @@ namespace CoreEngine.Graphics
         { 
             get
             {
-                var result = this.NativePointer1;
-
-                if (this.NativePointer2 != null && ((this.graphicsManager.CurrentFrameNumber % 2) == 1))
-                {
-                    result = this.NativePointer2.Value;
-                }
-
-                return result;
+                return this.NativePointers[this.graphicsManager.CurrentFrameIndex % this.NativePointers.Length];
             }
         }
 
-        public IntPtr NativePointer1
-        {
-            get;
-        }
-
-        public IntPtr? NativePointer2
+        public IntPtr[] NativePointers
         {
             get;
         }
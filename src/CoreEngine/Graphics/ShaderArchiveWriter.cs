@@ -0,0 +1,360 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using CoreEngine.Diagnostics;
+
+namespace CoreEngine.Graphics
+{
+    // Packs the .shader files of a resource directory into one archive that the hosts memory map.
+    // The layout must stay in sync with ShaderArchive.h.
+    public static class ShaderArchiveWriter
+    {
+        public const string FileName = "Shaders.shaderarchive";
+
+        private const uint archiveMagic = 0x4B504853;
+        private const uint archiveVersion = 1;
+        private const int headerSize = 16;
+        private const int shaderEntrySize = 40;
+        private const int entryPointEntrySize = 48;
+        private const int byteCodeAlignment = 8;
+
+        private static readonly string[] stageEntryPoints = new string[] { "AmplificationMain", "MeshMain", "PixelMain", "ComputeMain" };
+        private const uint unknownStage = 0xFFFFFFFF;
+
+        private class ArchiveEntryPoint
+        {
+            public ArchiveEntryPoint(string name)
+            {
+                this.Name = name;
+            }
+
+            public string Name { get; }
+            public ArchiveRange Spirv { get; set; }
+            public ArchiveRange Dxil { get; set; }
+        }
+
+        private class ArchiveShader
+        {
+            public ArchiveShader(string name)
+            {
+                this.Name = name;
+                this.EntryPoints = new List<ArchiveEntryPoint>();
+            }
+
+            public string Name { get; }
+            public uint ParameterCount { get; set; }
+            public ArchiveRange RootSignature { get; set; }
+            public IList<ArchiveEntryPoint> EntryPoints { get; }
+        }
+
+        private readonly record struct ArchiveRange(ulong Offset, uint Length, ulong Hash);
+
+        // Returns the number of packed shaders, the archive is not written when there is no shader
+        public static int WriteShaderArchive(string resourceDirectory, string outputPath)
+        {
+            if (resourceDirectory == null)
+            {
+                throw new ArgumentNullException(nameof(resourceDirectory));
+            }
+
+            var shaderFiles = Directory.GetFiles(resourceDirectory, "*.shader", SearchOption.AllDirectories);
+            Array.Sort(shaderFiles, StringComparer.Ordinal);
+
+            var shaders = new List<ArchiveShader>();
+            using var byteCodeData = new MemoryStream();
+            var byteCodeRanges = new Dictionary<ulong, List<ArchiveRange>>();
+
+            foreach (var shaderFile in shaderFiles)
+            {
+                // Archive names are the resource paths used by the resources manager
+                var shaderName = "/" + Path.GetRelativePath(resourceDirectory, shaderFile).Replace('\\', '/');
+                var byteCodeDataLength = byteCodeData.Length;
+                var shader = ReadShaderFile(shaderName, File.ReadAllBytes(shaderFile), byteCodeData, byteCodeRanges);
+
+                if (shader == null)
+                {
+                    RemoveByteCode(byteCodeData, byteCodeRanges, byteCodeDataLength);
+                    Logger.WriteMessage($"Skipping invalid shader file '{shaderFile}'", LogMessageTypes.Warning);
+                    continue;
+                }
+
+                shaders.Add(shader);
+            }
+
+            if (shaders.Count == 0)
+            {
+                return 0;
+            }
+
+            var entryPointCount = 0;
+
+            foreach (var shader in shaders)
+            {
+                entryPointCount += shader.EntryPoints.Count;
+            }
+
+            using var names = new MemoryStream();
+            var namesOffset = (ulong)(headerSize + shaders.Count * shaderEntrySize + entryPointCount * entryPointEntrySize);
+            var byteCodeOffset = Utils.AlignValue(namesOffset + ComputeNamesSize(shaders), byteCodeAlignment);
+
+            using var archiveStream = new MemoryStream();
+            using var writer = new BinaryWriter(archiveStream);
+
+            writer.Write(archiveMagic);
+            writer.Write(archiveVersion);
+            writer.Write((uint)shaders.Count);
+            writer.Write((uint)entryPointCount);
+
+            var firstEntryPoint = 0u;
+
+            foreach (var shader in shaders)
+            {
+                var nameData = Encoding.UTF8.GetBytes(shader.Name);
+
+                writer.Write(ComputeContentHash(nameData));
+                writer.Write((uint)(namesOffset + (ulong)names.Length));
+                writer.Write((uint)nameData.Length);
+                writer.Write(shader.ParameterCount);
+                writer.Write(firstEntryPoint);
+                writer.Write((uint)shader.EntryPoints.Count);
+                writer.Write(shader.RootSignature.Length);
+                writer.Write(byteCodeOffset + shader.RootSignature.Offset);
+
+                names.Write(nameData);
+                firstEntryPoint += (uint)shader.EntryPoints.Count;
+            }
+
+            foreach (var shader in shaders)
+            {
+                foreach (var entryPoint in shader.EntryPoints)
+                {
+                    writer.Write(GetShaderStage(entryPoint.Name));
+                    writer.Write(entryPoint.Spirv.Length);
+                    writer.Write(byteCodeOffset + entryPoint.Spirv.Offset);
+                    writer.Write(entryPoint.Spirv.Hash);
+                    writer.Write(entryPoint.Dxil.Length);
+                    writer.Write(0u);
+                    writer.Write(byteCodeOffset + entryPoint.Dxil.Offset);
+                    writer.Write(entryPoint.Dxil.Hash);
+                }
+            }
+
+            writer.Write(names.ToArray());
+            writer.Write(new byte[byteCodeOffset - (ulong)archiveStream.Length]);
+            writer.Write(byteCodeData.ToArray());
+
+            // The archive can be mapped by a running engine so it is replaced in one step
+            var temporaryPath = outputPath + ".tmp";
+            File.WriteAllBytes(temporaryPath, archiveStream.ToArray());
+            File.Move(temporaryPath, outputPath, true);
+
+            return shaders.Count;
+        }
+
+        internal static ulong ComputeContentHash(ReadOnlySpan<byte> data)
+        {
+            var hash = 14695981039346656037ul;
+
+            for (var i = 0; i < data.Length; i++)
+            {
+                hash ^= data[i];
+                hash *= 1099511628211ul;
+            }
+
+            return hash;
+        }
+
+        private static ArchiveShader? ReadShaderFile(string shaderName, byte[] data, MemoryStream byteCodeData, Dictionary<ulong, List<ArchiveRange>> byteCodeRanges)
+        {
+            using var memoryStream = new MemoryStream(data);
+            using var reader = new BinaryReader(memoryStream);
+
+            // Truncated files end the stream before one of their fields
+            try
+            {
+                var shaderSignature = new string(reader.ReadChars(6));
+                var shaderVersion = reader.ReadInt32();
+
+                if (shaderSignature != "SHADER" || shaderVersion != 1)
+                {
+                    return null;
+                }
+
+                var shaderByteCodeLength = reader.ReadInt32();
+                var shaderByteCodeStart = memoryStream.Position;
+                var shaderByteCodeEnd = shaderByteCodeStart + shaderByteCodeLength;
+
+                if (shaderByteCodeLength < 0 || shaderByteCodeEnd > data.Length)
+                {
+                    return null;
+                }
+
+                var shader = new ArchiveShader(shaderName);
+
+                // The DXIL part is followed by the SPIR-V part, see CreateShader in the hosts
+                var spirvOffset = reader.ReadInt32();
+                var spirvStart = memoryStream.Position + spirvOffset;
+
+                if (spirvOffset < 0 || spirvStart > shaderByteCodeEnd)
+                {
+                    return null;
+                }
+
+                if (spirvOffset > 0)
+                {
+                    shader.ParameterCount = reader.ReadUInt32();
+                    var rootSignature = ReadByteCode(reader, spirvStart);
+
+                    if (rootSignature == null || !ReadEntryPoints(reader, shader, spirvStart, byteCodeData, byteCodeRanges, isSpirv: false))
+                    {
+                        return null;
+                    }
+
+                    shader.RootSignature = AddByteCode(rootSignature, byteCodeData, byteCodeRanges);
+                }
+
+                memoryStream.Position = spirvStart;
+
+                if (spirvStart < shaderByteCodeEnd)
+                {
+                    shader.ParameterCount = reader.ReadUInt32();
+
+                    if (!ReadEntryPoints(reader, shader, shaderByteCodeEnd, byteCodeData, byteCodeRanges, isSpirv: true))
+                    {
+                        return null;
+                    }
+                }
+
+                return shader;
+            }
+
+            catch (EndOfStreamException)
+            {
+                return null;
+            }
+        }
+
+        // Returns null when the byte code length goes past the end of its part of the shader file
+        private static byte[]? ReadByteCode(BinaryReader reader, long endPosition)
+        {
+            var length = reader.ReadInt32();
+
+            if (length < 0 || length > endPosition - reader.BaseStream.Position)
+            {
+                return null;
+            }
+
+            return reader.ReadBytes(length);
+        }
+
+        private static bool ReadEntryPoints(BinaryReader reader, ArchiveShader shader, long endPosition, MemoryStream byteCodeData, Dictionary<ulong, List<ArchiveRange>> byteCodeRanges, bool isSpirv)
+        {
+            var shaderTableCount = reader.ReadInt32();
+
+            for (var i = 0; i < shaderTableCount; i++)
+            {
+                var entryPointNameData = ReadByteCode(reader, endPosition);
+
+                if (entryPointNameData == null)
+                {
+                    return false;
+                }
+
+                var byteCode = ReadByteCode(reader, endPosition);
+
+                if (byteCode == null)
+                {
+                    return false;
+                }
+
+                var entryPointName = Encoding.UTF8.GetString(entryPointNameData);
+                var byteCodeRange = AddByteCode(byteCode, byteCodeData, byteCodeRanges);
+
+                ArchiveEntryPoint? entryPoint = null;
+
+                foreach (var existingEntryPoint in shader.EntryPoints)
+                {
+                    if (existingEntryPoint.Name == entryPointName)
+                    {
+                        entryPoint = existingEntryPoint;
+                    }
+                }
+
+                if (entryPoint == null)
+                {
+                    entryPoint = new ArchiveEntryPoint(entryPointName);
+                    shader.EntryPoints.Add(entryPoint);
+                }
+
+                if (isSpirv)
+                {
+                    entryPoint.Spirv = byteCodeRange;
+                }
+
+                else
+                {
+                    entryPoint.Dxil = byteCodeRange;
+                }
+            }
+
+            return true;
+        }
+
+        private static ArchiveRange AddByteCode(byte[] byteCode, MemoryStream byteCodeData, Dictionary<ulong, List<ArchiveRange>> byteCodeRanges)
+        {
+            var hash = ComputeContentHash(byteCode);
+
+            if (!byteCodeRanges.TryGetValue(hash, out var ranges))
+            {
+                ranges = new List<ArchiveRange>();
+                byteCodeRanges.Add(hash, ranges);
+            }
+
+            // The hash can collide so the byte code is compared before it is shared
+            foreach (var existingRange in ranges)
+            {
+                if (byteCodeData.GetBuffer().AsSpan((int)existingRange.Offset, (int)existingRange.Length).SequenceEqual(byteCode))
+                {
+                    return existingRange;
+                }
+            }
+
+            var range = new ArchiveRange((ulong)byteCodeData.Length, (uint)byteCode.Length, hash);
+            byteCodeData.Write(byteCode);
+            byteCodeData.Write(new byte[Utils.AlignValue((ulong)byteCodeData.Length, byteCodeAlignment) - (ulong)byteCodeData.Length]);
+
+            ranges.Add(range);
+            return range;
+        }
+
+        // Removes the byte code added after the specified length by a rejected shader file
+        private static void RemoveByteCode(MemoryStream byteCodeData, Dictionary<ulong, List<ArchiveRange>> byteCodeRanges, long length)
+        {
+            foreach (var ranges in byteCodeRanges.Values)
+            {
+                ranges.RemoveAll(range => range.Offset >= (ulong)length);
+            }
+
+            byteCodeData.SetLength(length);
+        }
+
+        private static ulong ComputeNamesSize(IList<ArchiveShader> shaders)
+        {
+            var result = 0ul;
+
+            foreach (var shader in shaders)
+            {
+                result += (ulong)Encoding.UTF8.GetByteCount(shader.Name);
+            }
+
+            return result;
+        }
+
+        private static uint GetShaderStage(string entryPointName)
+        {
+            var stage = Array.IndexOf(stageEntryPoints, entryPointName);
+            return stage != -1 ? (uint)stage : unknownStage;
+        }
+    }
+}
@@ -35,6 +35,21 @@ namespace CoreEngine.Graphics
                 throw new ArgumentException("Resource is not a Shader resource.", nameof(resource));
             }
 
+            var computeFunction = (!resource.Parameters.IsEmpty) ? resource.Parameters.Span[0] : null;
+            var label = $"{Path.GetFileNameWithoutExtension(shader.Path)}Shader";
+
+            // Archived shaders are only used for the first load of the default entry points, hot reloads always use the updated file
+            if (shader.NativePointer == IntPtr.Zero && computeFunction == null)
+            {
+                var archivedShader = this.graphicsManager.CreateShaderFromArchive(shader.Path, label);
+
+                if (archivedShader != null)
+                {
+                    shader.NativePointer = archivedShader.NativePointer;
+                    return shader;
+                }
+            }
+
             using var memoryStream = new MemoryStream(data);
             using var reader = new BinaryReader(memoryStream);
 
@@ -48,16 +63,14 @@ namespace CoreEngine.Graphics
             }
 
             var shaderByteCodeLength = reader.ReadInt32();
-            var shaderByteCode = reader.ReadBytes(shaderByteCodeLength);
+            var shaderByteCode = new ReadOnlySpan<byte>(data, (int)memoryStream.Position, shaderByteCodeLength);
 
             if (shader.NativePointer != IntPtr.Zero)
             {
                 shader.Dispose();
             }
 
-            var computeFunction = (!resource.Parameters.IsEmpty) ? resource.Parameters.Span[0] : null;
-
-            var createdShader = this.graphicsManager.CreateShader(computeFunction, shaderByteCode, $"{Path.GetFileNameWithoutExtension(shader.Path)}Shader");
+            var createdShader = this.graphicsManager.CreateShader(computeFunction, shaderByteCode, label);
             shader.NativePointer = createdShader.NativePointer;
 
             return shader;
@@ -9,8 +9,10 @@ namespace CoreEngine.Graphics
     public class ShaderResourceManager : IDisposable
     {
         private readonly IGraphicsService graphicsService;
-        private readonly ShaderResourceHeap shaderResourceHeap;
+        private ShaderResourceHeap shaderResourceHeap;
         private readonly Queue<uint> availableIndexes;
+        private GraphicsShaderResourceWrite[] pendingWrites;
+        private int pendingWriteCount;
         private uint currentIndex;
         private bool isDisposed;
 
@@ -18,13 +20,15 @@ namespace CoreEngine.Graphics
         {
             this.graphicsService = graphicsService;
             this.availableIndexes = new Queue<uint>();
+            this.pendingWrites = new GraphicsShaderResourceWrite[256];
 
-            var heapLength = 10000ul;
+            var heapLength = 4096ul;
             var heapLabel = "ShaderResourceHeap";
 
+            // The host can create a smaller heap than requested when the device limits are lower
             var nativePointer = this.graphicsService.CreateShaderResourceHeap(heapLength);
             this.graphicsService.SetShaderResourceHeapLabel(nativePointer, heapLabel);
-            this.shaderResourceHeap = new ShaderResourceHeap(nativePointer, heapLength, heapLabel);
+            this.shaderResourceHeap = new ShaderResourceHeap(nativePointer, this.graphicsService.GetShaderResourceHeapLength(nativePointer), heapLabel);
         }
 
         public void Dispose()
@@ -42,7 +46,7 @@ namespace CoreEngine.Graphics
             }
         }
 
-        public void CreateShaderResourceTexture(Texture texture, bool isWriteable, uint mipLevel, out uint shaderResourceIndex1, out uint? shaderResourceIndex2)
+        public void CreateShaderResourceTexture(Texture texture, bool isWriteable, uint mipLevel, Span<uint> shaderResourceIndexes)
         {
             if (texture is null)
             {
@@ -51,22 +55,16 @@ namespace CoreEngine.Graphics
 
             if (texture.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Gpu && texture.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.TransientGpu)
             {
-                shaderResourceIndex1 = 0;
-                shaderResourceIndex2 = 0;
+                shaderResourceIndexes.Clear();
                 return;
             }
 
-            var index = GetIndex();
-
-            this.graphicsService.CreateShaderResourceTexture(this.shaderResourceHeap.NativePointer, index, texture.NativePointer1, isWriteable: isWriteable, mipLevel: mipLevel);
-            shaderResourceIndex1 = index;
-            shaderResourceIndex2 = null;
-
-            if (texture.NativePointer2 != null)
+            for (var i = 0; i < texture.NativePointers.Length; i++)
             {
-                index = GetIndex();
-                this.graphicsService.CreateShaderResourceTexture(this.shaderResourceHeap.NativePointer, index, texture.NativePointer2.Value, isWriteable: isWriteable, mipLevel: mipLevel);
-                shaderResourceIndex2 = index;
+                var index = GetIndex();
+
+                AddPendingWrite(new GraphicsShaderResourceWrite(index, texture.NativePointers[i], isTexture: true, isWriteable, mipLevel));
+                shaderResourceIndexes[i] = index;
             }
         }
 
@@ -77,36 +75,32 @@ namespace CoreEngine.Graphics
                 throw new ArgumentNullException(nameof(texture));
             }
 
-            this.availableIndexes.Enqueue(texture.ShaderResourceIndex1);
-
-            if (texture.ShaderResourceIndex2 != null)
+            if (texture.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Gpu && texture.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.TransientGpu)
             {
-                this.availableIndexes.Enqueue(texture.ShaderResourceIndex2.Value);
+                return;
             }
 
-            for (var i = 0; i < texture.MipLevels; i++)
+            // A pending write to a released slot must not be applied after the slot is deleted
+            FlushPendingWrites();
+
+            for (var i = 0; i < texture.ShaderResourceIndexes.Length; i++)
             {
-                // TODO: Those tests are really bad
-                if (texture.ShaderResourceIndexes1[i] != 0)
-                {
-                    this.availableIndexes.Enqueue(texture.ShaderResourceIndexes1[i]);
-                }
+                ReleaseTextureIndex(texture.ShaderResourceIndexes[i]);
 
-                if (!texture.IsStatic && texture.ShaderResourceIndex2 != null && texture.ShaderResourceIndexes2[i] != 0)
+                for (var j = 0; j < texture.MipShaderResourceIndexes[i].Length; j++)
                 {
-                    this.availableIndexes.Enqueue(texture.ShaderResourceIndexes2[i]);
+                    // TODO: Those tests are really bad
+                    if (texture.MipShaderResourceIndexes[i][j] != 0)
+                    {
+                        ReleaseTextureIndex(texture.MipShaderResourceIndexes[i][j]);
+                    }
                 }
-            }
 
-            if (texture.Usage == TextureUsage.ShaderWrite)
-            {
-                for (var i = 0; i < texture.MipLevels; i++)
+                if (texture.Usage == TextureUsage.ShaderWrite)
                 {
-                    this.availableIndexes.Enqueue(texture.WriteableShaderResourceIndex1[i]);
-
-                    if (!texture.IsStatic && texture.ShaderResourceIndex2 != null)
+                    for (var j = 0; j < texture.WriteableShaderResourceIndexes[i].Length; j++)
                     {
-                        this.availableIndexes.Enqueue(texture.WriteableShaderResourceIndex2[i]);
+                        ReleaseTextureIndex(texture.WriteableShaderResourceIndexes[i][j]);
                     }
                 }
             }
@@ -119,22 +113,17 @@ namespace CoreEngine.Graphics
                 throw new ArgumentNullException(nameof(buffer));
             }
 
-            if (buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Gpu && buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.TransientGpu)
+            if (buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Gpu && buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.TransientGpu && buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.GpuUpload)
             {
                 return;
             }
 
-            var index = GetIndex();
-
-            this.graphicsService.CreateShaderResourceBuffer(this.shaderResourceHeap.NativePointer, index, buffer.NativePointer1, isWriteable);
-            buffer.ShaderResourceIndex1 = index;
-
-            if (buffer.NativePointer2 != null)
+            for (var i = 0; i < buffer.NativePointers.Length; i++)
             {
-                index = GetIndex();
+                var index = GetIndex();
 
-                this.graphicsService.CreateShaderResourceBuffer(this.shaderResourceHeap.NativePointer, index, buffer.NativePointer2.Value, isWriteable);
-                buffer.ShaderResourceIndex2 = index;
+                AddPendingWrite(new GraphicsShaderResourceWrite(index, buffer.NativePointers[i], isTexture: false, isWriteable, mipLevel: 0));
+                buffer.ShaderResourceIndexes[i] = index;
             }
         }
 
@@ -145,21 +134,23 @@ namespace CoreEngine.Graphics
                 throw new ArgumentNullException(nameof(buffer));
             }
 
-            if (buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Gpu && buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.TransientGpu)
+            if (buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.Gpu && buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.TransientGpu && buffer.GraphicsMemoryAllocation.GraphicsHeap.Type != GraphicsHeapType.GpuUpload)
             {
                 return;
             }
 
-            this.availableIndexes.Enqueue(buffer.ShaderResourceIndex1);
+            FlushPendingWrites();
 
-            if (buffer.ShaderResourceIndex2 != null)
+            for (var i = 0; i < buffer.ShaderResourceIndexes.Length; i++)
             {
-                this.availableIndexes.Enqueue(buffer.ShaderResourceIndex2.Value);
+                this.graphicsService.DeleteShaderResourceBuffer(this.shaderResourceHeap.NativePointer, buffer.ShaderResourceIndexes[i]);
+                this.availableIndexes.Enqueue(buffer.ShaderResourceIndexes[i]);
             }
         }
 
         public void SetShaderResourceHeap(in CommandList commandList)
         {
+            FlushPendingWrites();
             this.graphicsService.SetShaderResourceHeap(commandList.NativePointer, this.shaderResourceHeap.NativePointer);
         }
 
@@ -169,8 +160,54 @@ namespace CoreEngine.Graphics
             {
                 return this.availableIndexes.Dequeue();
             }
+
+            if (this.currentIndex >= this.shaderResourceHeap.Length)
+            {
+                GrowShaderResourceHeap();
+            }
             
             return currentIndex++;
         }
+
+        // The descriptors are sent to the host in one call before the heap is used by a command list
+        private void AddPendingWrite(GraphicsShaderResourceWrite write)
+        {
+            if (this.pendingWriteCount == this.pendingWrites.Length)
+            {
+                Array.Resize(ref this.pendingWrites, this.pendingWrites.Length * 2);
+            }
+
+            this.pendingWrites[this.pendingWriteCount++] = write;
+        }
+
+        private void FlushPendingWrites()
+        {
+            if (this.pendingWriteCount > 0)
+            {
+                this.graphicsService.CreateShaderResources(this.shaderResourceHeap.NativePointer, this.pendingWrites.AsSpan(0, this.pendingWriteCount));
+                this.pendingWriteCount = 0;
+            }
+        }
+
+        private void ReleaseTextureIndex(uint index)
+        {
+            this.graphicsService.DeleteShaderResourceTexture(this.shaderResourceHeap.NativePointer, index);
+            this.availableIndexes.Enqueue(index);
+        }
+
+        private void GrowShaderResourceHeap()
+        {
+            var nativePointer = this.shaderResourceHeap.NativePointer;
+
+            this.graphicsService.ResizeShaderResourceHeap(nativePointer, this.shaderResourceHeap.Length * 2);
+            var heapLength = this.graphicsService.GetShaderResourceHeapLength(nativePointer);
+
+            if (heapLength <= this.shaderResourceHeap.Length)
+            {
+                throw new InvalidOperationException($"The shader resource heap is full, the device limit of {heapLength} descriptors is reached.");
+            }
+
+            this.shaderResourceHeap = new ShaderResourceHeap(nativePointer, heapLength, this.shaderResourceHeap.Label);
+        }
     }
 }
\ No newline at end of file
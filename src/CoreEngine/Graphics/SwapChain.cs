@@ -7,7 +7,7 @@ namespace CoreEngine.Graphics
         private readonly GraphicsManager graphicsManager;
         private bool isDisposed;
 
-        internal SwapChain(GraphicsManager graphicsManager, IntPtr nativePointer, CommandQueue commandQueue, int width, int height, TextureFormat textureFormat)
+        internal SwapChain(GraphicsManager graphicsManager, IntPtr nativePointer, CommandQueue commandQueue, int width, int height, TextureFormat textureFormat, PresentMode presentMode)
         {
             this.graphicsManager = graphicsManager;
             this.NativePointer = nativePointer;
@@ -15,6 +15,7 @@ namespace CoreEngine.Graphics
             this.Width = width;
             this.Height = height;
             this.TextureFormat = textureFormat;
+            this.PresentMode = presentMode;
         }
 
         public void Dispose()
@@ -37,5 +38,6 @@ namespace CoreEngine.Graphics
         public int Width { get; internal set; }
         public int Height { get; internal set; }
         public TextureFormat TextureFormat { get; }
+        public PresentMode PresentMode { get; }
     }
 }
\ No newline at end of file
@@ -9,14 +9,12 @@ namespace CoreEngine.Graphics
         private readonly ShaderResourceManager shaderResourceManager;
         private bool isDisposed;
 
-        internal Texture(GraphicsManager graphicsManager, ShaderResourceManager shaderResourceManager, GraphicsMemoryAllocation graphicsMemoryAllocation, GraphicsMemoryAllocation? graphicsMemoryAllocation2, IntPtr nativePointer1, IntPtr? nativePointer2, TextureFormat textureFormat, TextureUsage usage, int width, int height, int faceCount, int mipLevels, int multiSampleCount, bool isStatic, string label) : base(0, string.Empty)
+        internal Texture(GraphicsManager graphicsManager, ShaderResourceManager shaderResourceManager, GraphicsMemoryAllocation[] graphicsMemoryAllocations, IntPtr[] nativePointers, TextureFormat textureFormat, TextureUsage usage, int width, int height, int faceCount, int mipLevels, int multiSampleCount, bool isStatic, string label) : base(0, string.Empty)
         {
             this.graphicsManager = graphicsManager;
             this.shaderResourceManager = shaderResourceManager;
-            this.GraphicsMemoryAllocation = graphicsMemoryAllocation;
-            this.GraphicsMemoryAllocation2 = graphicsMemoryAllocation2;
-            this.NativePointer1 = nativePointer1;
-            this.NativePointer2 = nativePointer2;
+            this.GraphicsMemoryAllocations = graphicsMemoryAllocations;
+            this.NativePointers = nativePointers;
             this.TextureFormat = textureFormat;
             this.Usage = usage;
             this.Width = width;
@@ -28,10 +26,15 @@ namespace CoreEngine.Graphics
             this.IsStatic = isStatic;
             this.IsLoaded = true;
             this.Label = label;
-            this.ShaderResourceIndexes1 = new uint[mipLevels];
-            this.ShaderResourceIndexes2 = new uint[mipLevels];
-            this.WriteableShaderResourceIndex1 = new uint[mipLevels];
-            this.WriteableShaderResourceIndex2 = new uint[mipLevels];
+            this.ShaderResourceIndexes = new uint[nativePointers.Length];
+            this.MipShaderResourceIndexes = new uint[nativePointers.Length][];
+            this.WriteableShaderResourceIndexes = new uint[nativePointers.Length][];
+
+            for (var i = 0; i < nativePointers.Length; i++)
+            {
+                this.MipShaderResourceIndexes[i] = new uint[mipLevels];
+                this.WriteableShaderResourceIndexes[i] = new uint[mipLevels];
+            }
         }
 
         internal Texture(GraphicsManager graphicsManager, ShaderResourceManager shaderResourceManager, int width, int height, uint resourceId, string path, string label) : base(resourceId, path)
@@ -45,10 +48,11 @@ namespace CoreEngine.Graphics
             this.ResourceType = GraphicsResourceType.Texture;
             this.IsStatic = true;
             this.Label = label;
-            this.ShaderResourceIndexes1 = Array.Empty<uint>();
-            this.ShaderResourceIndexes2 = Array.Empty<uint>();
-            this.WriteableShaderResourceIndex1 = Array.Empty<uint>();
-            this.WriteableShaderResourceIndex2 = Array.Empty<uint>();
+            this.GraphicsMemoryAllocations = new GraphicsMemoryAllocation[1];
+            this.NativePointers = new IntPtr[1];
+            this.ShaderResourceIndexes = new uint[1];
+            this.MipShaderResourceIndexes = new uint[][] { Array.Empty<uint>() };
+            this.WriteableShaderResourceIndexes = new uint[][] { Array.Empty<uint>() };
         }
 
         public void Dispose()
@@ -70,24 +74,12 @@ namespace CoreEngine.Graphics
         { 
             get
             {
-                var result = this.NativePointer1;
-
-                if (!IsStatic && this.NativePointer2 != null && ((this.graphicsManager.CurrentFrameNumber % 2) == 1))
-                {
-                    result = this.NativePointer2.Value;
-                }
-
-                return result;
+                return this.NativePointers[this.CurrentCopyIndex];
             }
         }
 
-        public IntPtr NativePointer1
-        {
-            get;
-            set;
-        }
-
-        public IntPtr? NativePointer2
+        // Non static textures have one copy per frame in flight
+        public IntPtr[] NativePointers
         {
             get;
             set;
@@ -102,27 +94,19 @@ namespace CoreEngine.Graphics
         public int MultiSampleCount { get; internal set; }
         public GraphicsResourceType ResourceType { get; }
         public bool IsStatic { get; }
-        public GraphicsMemoryAllocation GraphicsMemoryAllocation { get; }
-        public GraphicsMemoryAllocation? GraphicsMemoryAllocation2 { get; }
+        public GraphicsMemoryAllocation GraphicsMemoryAllocation => this.GraphicsMemoryAllocations[0];
+        public GraphicsMemoryAllocation[] GraphicsMemoryAllocations { get; }
 
         // TODO: Refactor the whole API for shader indexes
         public uint ShaderResourceIndex 
         { 
             get
             {
-                var result = this.ShaderResourceIndex1;
-
-                if (!IsStatic && this.ShaderResourceIndex2 != null && ((this.graphicsManager.CurrentFrameNumber % 2) == 1))
-                {
-                    result = this.ShaderResourceIndex2.Value;
-                }
-
-                return result;
+                return this.ShaderResourceIndexes[this.CurrentCopyIndex];
             }
         }
 
-        public uint ShaderResourceIndex1 { get; internal set; }
-        public uint? ShaderResourceIndex2 { get; internal set; }
+        internal uint[] ShaderResourceIndexes { get; set; }
 
         public uint GetShaderResourceIndex(uint mipLevel)
         {
@@ -133,55 +117,37 @@ namespace CoreEngine.Graphics
 
             // TODO: Check for errors
 
-            if (!IsStatic && ((this.graphicsManager.CurrentFrameNumber % 2) == 1))
+            var copyIndex = this.CurrentCopyIndex;
+            var result = this.MipShaderResourceIndexes[copyIndex][mipLevel];
+
+            if (result == 0)
             {
-                var result2 = this.ShaderResourceIndexes2[mipLevel];
+                Span<uint> shaderResourceIndexes = stackalloc uint[this.NativePointers.Length];
+                this.shaderResourceManager.CreateShaderResourceTexture(this, isWriteable: false, mipLevel, shaderResourceIndexes);
 
-                if (result2 == 0)
+                for (var i = 0; i < shaderResourceIndexes.Length; i++)
                 {
-                    this.shaderResourceManager.CreateShaderResourceTexture(this, isWriteable: false, mipLevel, out var shaderResourceIndex1, out var shaderResourceIndex2);
-
-                    this.ShaderResourceIndexes1[mipLevel] = shaderResourceIndex1;
-                    this.ShaderResourceIndexes2[mipLevel] = shaderResourceIndex2!.Value;
-
-                    result2 = shaderResourceIndex2.Value;
+                    this.MipShaderResourceIndexes[i][mipLevel] = shaderResourceIndexes[i];
                 }
 
-                return result2;
-            }
-
-            var result = this.ShaderResourceIndexes1[mipLevel];
-
-            if (result == 0)
-            {
-                this.shaderResourceManager.CreateShaderResourceTexture(this, isWriteable: false, mipLevel, out var shaderResourceIndex1, out var _);
-
-                this.ShaderResourceIndexes1[mipLevel] = shaderResourceIndex1;
-                result = shaderResourceIndex1;
+                result = shaderResourceIndexes[copyIndex];
             }
 
             return result;
         }
 
-        internal uint[] ShaderResourceIndexes1 { get; set; }
-        internal uint[] ShaderResourceIndexes2 { get; set; }
+        // Indexed by copy then by mip level, mip level 0 uses ShaderResourceIndexes
+        internal uint[][] MipShaderResourceIndexes { get; set; }
 
         public uint GetWriteableShaderResourceIndex(uint mipLevel)
         {
             // TODO: Check for errors
-
-            var result = this.WriteableShaderResourceIndex1[mipLevel];
-
-            if (!IsStatic && this.WriteableShaderResourceIndex2[mipLevel] != 0 && ((this.graphicsManager.CurrentFrameNumber % 2) == 1))
-            {
-                result = this.WriteableShaderResourceIndex2[mipLevel];
-            }
-
-            return result;
+            return this.WriteableShaderResourceIndexes[this.CurrentCopyIndex][mipLevel];
         }
 
-        internal uint[] WriteableShaderResourceIndex1 { get; set; }
-        internal uint[] WriteableShaderResourceIndex2 { get; set; }
+        internal uint[][] WriteableShaderResourceIndexes { get; set; }
+
+        private int CurrentCopyIndex => this.graphicsManager.CurrentFrameIndex % this.NativePointers.Length;
 
         public string Label
         {
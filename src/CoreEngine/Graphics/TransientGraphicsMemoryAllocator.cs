@@ -67,6 +67,12 @@ namespace CoreEngine.Graphics
             // this.GraphicsHeap = ((frameNumber % 2) == 1) ? this.GraphicsHeap1 : this.GraphicsHeap0;
         }
 
+        public ulong Trim()
+        {
+            // The ring heap is used by every frame so it is never released
+            return 0;
+        }
+
         public GraphicsHeap GraphicsHeap { get; private set; }
         public ulong CurrentOffset { get; private set; }
         public ulong StartOffset { get; private set; }
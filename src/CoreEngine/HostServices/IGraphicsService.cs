@@ -12,7 +12,8 @@ namespace CoreEngine.HostServices
     {
         Gpu,
         Upload,
-        ReadBack
+        ReadBack,
+        GpuUpload
     }
 
     public enum GraphicsServiceCommandType
@@ -80,6 +81,13 @@ namespace CoreEngine.HostServices
         GraphicsPipelineStats
     }
 
+    public enum GraphicsPresentMode
+    {
+        Fifo,
+        Mailbox,
+        Immediate
+    }
+
     public enum GraphicsPrimitiveType
     {
         Triangle,
@@ -105,6 +113,51 @@ namespace CoreEngine.HostServices
         public int Alignment { get; }
     }
 
+    public readonly struct GraphicsMemoryBudget
+    {
+        public GraphicsMemoryBudget(ulong budgetInBytes, ulong usageInBytes)
+        {
+            this.BudgetInBytes = budgetInBytes;
+            this.UsageInBytes = usageInBytes;
+        }
+
+        // Memory the process can use before the OS or the driver starts paging
+        public ulong BudgetInBytes { get; }
+        public ulong UsageInBytes { get; }
+    }
+
+    public readonly struct GraphicsGpuZone
+    {
+        public GraphicsGpuZone(uint nameId, uint depth, ulong startTimestamp, ulong endTimestamp)
+        {
+            this.NameId = nameId;
+            this.Depth = depth;
+            this.StartTimestamp = startTimestamp;
+            this.EndTimestamp = endTimestamp;
+        }
+
+        public uint NameId { get; }
+        public uint Depth { get; }
+        public ulong StartTimestamp { get; }
+        public ulong EndTimestamp { get; }
+    }
+
+    public readonly struct GraphicsTimestampCalibration
+    {
+        public GraphicsTimestampCalibration(ulong gpuTimestamp, ulong cpuTimestamp, ulong maxDeviation)
+        {
+            this.GpuTimestamp = gpuTimestamp;
+            this.CpuTimestamp = cpuTimestamp;
+            this.MaxDeviation = maxDeviation;
+        }
+
+        // GPU timestamp sampled at the same time as the CPU timestamp, the CPU timestamp uses
+        // the Stopwatch clock and the max deviation is in nanoseconds
+        public ulong GpuTimestamp { get; }
+        public ulong CpuTimestamp { get; }
+        public ulong MaxDeviation { get; }
+    }
+
     public readonly struct GraphicsFence
     {
         public GraphicsFence(Fence fence)
@@ -117,6 +170,46 @@ namespace CoreEngine.HostServices
         public ulong Value { get; }
     }
 
+    public readonly struct GraphicsCommandListBatch
+    {
+        public GraphicsCommandListBatch(IntPtr commandQueuePointer, IntPtr commandLists, int commandListsLength, IntPtr fencesToWait, int fencesToWaitLength, int batchIndexToWait)
+        {
+            this.CommandQueuePointer = commandQueuePointer;
+            this.CommandLists = commandLists;
+            this.CommandListsLength = commandListsLength;
+            this.FencesToWait = fencesToWait;
+            this.FencesToWaitLength = fencesToWaitLength;
+            this.BatchIndexToWait = batchIndexToWait;
+        }
+
+        public IntPtr CommandQueuePointer { get; }
+        public IntPtr CommandLists { get; }
+        public int CommandListsLength { get; }
+        public IntPtr FencesToWait { get; }
+        public int FencesToWaitLength { get; }
+
+        // Index of a previous batch of the same call to wait for, -1 if none
+        public int BatchIndexToWait { get; }
+    }
+
+    public readonly struct GraphicsShaderResourceWrite
+    {
+        public GraphicsShaderResourceWrite(uint index, IntPtr resourcePointer, bool isTexture, bool isWriteable, uint mipLevel)
+        {
+            this.Index = index;
+            this.ResourcePointer = resourcePointer;
+            this.IsTexture = isTexture ? 1 : 0;
+            this.IsWriteable = isWriteable ? 1 : 0;
+            this.MipLevel = mipLevel;
+        }
+
+        public uint Index { get; }
+        public IntPtr ResourcePointer { get; }
+        public int IsTexture { get; }
+        public int IsWriteable { get; }
+        public uint MipLevel { get; }
+    }
+
     public readonly struct GraphicsRenderPassDescriptor : IEquatable<GraphicsRenderPassDescriptor>
     {
         public GraphicsRenderPassDescriptor(RenderPassDescriptor renderPassDescriptor)
@@ -276,16 +369,20 @@ namespace CoreEngine.HostServices
 
         // GraphicsAdapterInfos GetGraphicsAdapterInfos();
         string GetGraphicsAdapterName();
+        int SetFramesInFlightCount(int framesInFlightCount);
 
         GraphicsAllocationInfos GetBufferAllocationInfos(int sizeInBytes);
         GraphicsAllocationInfos GetTextureAllocationInfos(GraphicsTextureFormat textureFormat, GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+        GraphicsMemoryBudget GetMemoryBudget(GraphicsServiceHeapType heapType);
 
         IntPtr CreateCommandQueue(GraphicsServiceCommandType commandQueueType);
         void SetCommandQueueLabel(IntPtr commandQueuePointer, string label);
         void DeleteCommandQueue(IntPtr commandQueuePointer);
         void ResetCommandQueue(IntPtr commandQueuePointer);
         ulong GetCommandQueueTimestampFrequency(IntPtr commandQueuePointer);
+        GraphicsTimestampCalibration GetCommandQueueTimestampCalibration(IntPtr commandQueuePointer);
         ulong ExecuteCommandLists(IntPtr commandQueuePointer, ReadOnlySpan<IntPtr> commandLists, ReadOnlySpan<GraphicsFence> fencesToWait);
+        void ExecuteCommandListBatches(ReadOnlySpan<GraphicsCommandListBatch> batches, Span<GraphicsFence> fences);
         void WaitForCommandQueueOnCpu(GraphicsFence fenceToWait);
  
         IntPtr CreateCommandList(IntPtr commandQueuePointer);
@@ -300,12 +397,15 @@ namespace CoreEngine.HostServices
 
         // TODO: Try to make a cache system for transient resources that are always created with the same descriptors
         IntPtr CreateShaderResourceHeap(ulong length);
+        ulong GetShaderResourceHeapLength(IntPtr shaderResourceHeapPointer);
+        void ResizeShaderResourceHeap(IntPtr shaderResourceHeapPointer, ulong length);
         void SetShaderResourceHeapLabel(IntPtr shaderResourceHeapPointer, string label);
         void DeleteShaderResourceHeap(IntPtr shaderResourceHeapPointer);
         void CreateShaderResourceTexture(IntPtr shaderResourceHeapPointer, uint index, IntPtr texturePointer, bool isWriteable, uint mipLevel);
         void DeleteShaderResourceTexture(IntPtr shaderResourceHeapPointer, uint index);
         void CreateShaderResourceBuffer(IntPtr shaderResourceHeapPointer, uint index, IntPtr bufferPointer, bool isWriteable);
         void DeleteShaderResourceBuffer(IntPtr shaderResourceHeapPointer, uint index);
+        void CreateShaderResources(IntPtr shaderResourceHeapPointer, ReadOnlySpan<GraphicsShaderResourceWrite> writes);
         // TODO: UAV
 
         // TODO: Move make aliasable into a separate method
@@ -322,7 +422,7 @@ namespace CoreEngine.HostServices
 
         // TODO: Add Sample object create/update/delete
 
-        IntPtr CreateSwapChain(IntPtr windowPointer, IntPtr commandQueuePointer, int width, int height, GraphicsTextureFormat textureFormat);
+        IntPtr CreateSwapChain(IntPtr windowPointer, IntPtr commandQueuePointer, int width, int height, GraphicsTextureFormat textureFormat, GraphicsPresentMode presentMode, int backBufferCount);
         void DeleteSwapChain(IntPtr swapChainPointer);
         void ResizeSwapChain(IntPtr swapChainPointer, int width, int height);
         IntPtr GetSwapChainBackBufferTexture(IntPtr swapChainPointer);
@@ -335,11 +435,16 @@ namespace CoreEngine.HostServices
         void DeleteQueryBuffer(IntPtr queryBufferPointer);
 
         IntPtr CreateShader(string? computeShaderFunction, ReadOnlySpan<byte> shaderByteCode);
+        IntPtr CreateShaderFromArchive(IntPtr shaderArchivePointer, string shaderName);
         void SetShaderLabel(IntPtr shaderPointer, string label);
         void DeleteShader(IntPtr shaderPointer);
+        IntPtr OpenShaderArchive(string path);
+        void CloseShaderArchive(IntPtr shaderArchivePointer);
 
         IntPtr CreateComputePipelineState(IntPtr shaderPointer);
         IntPtr CreatePipelineState(IntPtr shaderPointer, GraphicsRenderPassDescriptor renderPassDescriptor);
+        IntPtr CreatePipelineStateAsync(IntPtr shaderPointer, GraphicsRenderPassDescriptor renderPassDescriptor, bool isComputePipelineState);
+        bool IsPipelineStateReady(IntPtr pipelineStatePointer, bool waitForCompletion);
         void SetPipelineStateLabel(IntPtr pipelineStatePointer, string label);
         void DeletePipelineState(IntPtr pipelineStatePointer);
 
@@ -382,6 +487,9 @@ namespace CoreEngine.HostServices
         void BeginQuery(IntPtr commandListPointer, IntPtr queryBufferPointer, int index);
         void EndQuery(IntPtr commandListPointer, IntPtr queryBufferPointer, int index);
         void ResolveQueryData(IntPtr commandListPointer, IntPtr queryBufferPointer, IntPtr destinationBufferPointer, int startIndex, int endIndex);
+        void BeginGpuZone(IntPtr commandListPointer, uint nameId, string name);
+        void EndGpuZone(IntPtr commandListPointer);
+        int ResolveGpuZones(Span<GraphicsGpuZone> gpuZones);
     }
     #pragma warning restore EPS05 
 }
\ No newline at end of file
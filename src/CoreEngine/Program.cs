@@ -38,7 +38,20 @@ public static class Program
         var sceneQueue = new GraphicsSceneQueue();
         var sceneManager = new GraphicsSceneManager(sceneQueue);
 
-        using var graphicsManager = new GraphicsManager(hostPlatform.GraphicsService, resourcesManager);
+        // TODO: Get the config from the host
+        var framesInFlightCount = 2;
+
+        if (int.TryParse(Utils.GetCommandLineOptionValue("--frames-in-flight"), out var framesInFlightOption))
+        {
+            framesInFlightCount = framesInFlightOption;
+        }
+
+        using var graphicsManager = new GraphicsManager(hostPlatform.GraphicsService, resourcesManager, framesInFlightCount);
+
+        // TODO: Get the config from the host using hardcoded values for the moment
+        graphicsManager.OpenShaderArchive($"../Resources/{ShaderArchiveWriter.FileName}");
+        graphicsManager.OpenShaderArchive($"./Resources/{ShaderArchiveWriter.FileName}");
+
         using var renderManager = new RenderManager(window, nativeUIManager, graphicsManager, resourcesManager, sceneQueue);
 
         var pluginManager = new PluginManager();
@@ -80,10 +93,24 @@ public static class Program
             Logger.EndAction();
         }
 
+        // The CPU and GPU zones of the first frames are written to a Chrome trace file
+        var tracePath = Utils.GetCommandLineOptionValue("--trace");
+        var traceFrameCount = 120;
+
+        if (int.TryParse(Utils.GetCommandLineOptionValue("--trace-frames"), out var traceFramesOption))
+        {
+            traceFrameCount = traceFramesOption;
+        }
+
         if (coreEngineApp != null)
         {
             var appStatus = new AppStatus() { IsActive = true, IsRunning = true };
 
+            if (!string.IsNullOrEmpty(tracePath))
+            {
+                Profiler.BeginCapture();
+            }
+
             while (appStatus.IsRunning)
             {
                 // TODO: How to reduce latency? Implement a sleep function that analyse the timing of the update and present 
@@ -103,16 +130,34 @@ public static class Program
                 appStatus = nativeUIManager.ProcessSystemMessages();
                 context.IsAppActive = appStatus.IsActive;
 
+                Profiler.BeginCpuZone("Update");
                 systemManagerContainer.PreUpdateSystemManagers(context);
                 // TODO: Compute correct delta time
                 coreEngineApp.OnUpdate(context, 1.0f / 60.0f);
                 systemManagerContainer.PostUpdateSystemManagers(context);
+                Profiler.EndCpuZone();
                 
                 renderManager.Render();
+
+                if (Profiler.IsCapturing && --traceFrameCount <= 0)
+                {
+                    EndTraceCapture(tracePath!);
+                }
+            }
+
+            if (Profiler.IsCapturing)
+            {
+                EndTraceCapture(tracePath!);
             }
         }
 
         Logger.WriteMessage("Exiting");
     }
     #pragma warning restore EPS05 
+
+    private static void EndTraceCapture(string tracePath)
+    {
+        Profiler.EndCapture(tracePath);
+        Logger.WriteMessage($"Trace written to '{tracePath}'", LogMessageTypes.Success);
+    }
 }
@@ -303,12 +303,11 @@ namespace CoreEngine.Rendering
 
             var copyCommandList = this.graphicsManager.CreateCommandList(this.renderManager.CopyCommandQueue, "DebugRendererCopy");
 
-            var startCopyQueryIndex = this.renderManager.InsertQueryTimestamp(copyCommandList);
+            this.graphicsManager.BeginGpuZone(copyCommandList, "DebugRendererCopy");
             this.graphicsManager.CopyDataToGraphicsBuffer<DebugPrimitive>(copyCommandList, this.primitiveBuffer, this.cpuPrimitiveBuffer, this.currentLinePrimitiveCount + this.currentCubePrimitiveCount + this.currentSpherePrimitiveCount);
-            var endCopyQueryIndex = this.renderManager.InsertQueryTimestamp(copyCommandList);
+            this.graphicsManager.EndGpuZone(copyCommandList);
 
             this.graphicsManager.CommitCommandList(copyCommandList);
-            this.renderManager.AddGpuTiming("DebugRendererCopy", QueryBufferType.CopyTimestamp, startCopyQueryIndex, endCopyQueryIndex);
 
             return copyCommandList;
         }
@@ -320,7 +319,7 @@ namespace CoreEngine.Rendering
             var renderTarget = new RenderTargetDescriptor(renderTargetTexture, null, BlendOperation.None);
             var renderPassDescriptor = new RenderPassDescriptor(renderTarget, depthTexture, DepthBufferOperation.CompareGreater, backfaceCulling: true, PrimitiveType.Line);
 
-            var startQueryIndex = this.renderManager.InsertQueryTimestamp(renderCommandList);
+            this.graphicsManager.BeginGpuZone(renderCommandList, "DebugRenderer");
             this.graphicsManager.BeginRenderPass(renderCommandList, renderPassDescriptor, this.shader);
 
             if (this.currentLinePrimitiveCount > 0)
@@ -342,10 +341,9 @@ namespace CoreEngine.Rendering
             }
 
             this.graphicsManager.EndRenderPass(renderCommandList);
-            var endQueryIndex = this.renderManager.InsertQueryTimestamp(renderCommandList);
+            this.graphicsManager.EndGpuZone(renderCommandList);
 
             this.graphicsManager.CommitCommandList(renderCommandList);
-            this.renderManager.AddGpuTiming("DebugRenderer", QueryBufferType.Timestamp, startQueryIndex, endQueryIndex);
 
             return renderCommandList;
         }
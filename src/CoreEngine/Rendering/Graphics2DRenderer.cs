@@ -166,12 +166,11 @@ namespace CoreEngine.Rendering
             var commandListName = "Graphics2DRenderer_Copy";
             var copyCommandList = this.graphicsManager.CreateCommandList(this.renderManager.CopyCommandQueue, commandListName);
 
-            var startCopyQueryIndex = this.renderManager.InsertQueryTimestamp(in copyCommandList);
+            this.graphicsManager.BeginGpuZone(copyCommandList, commandListName);
             this.graphicsManager.CopyDataToGraphicsBuffer<RectangleSurface>(copyCommandList, this.rectangleSurfacesGraphicsBuffer, this.cpuRectangleSurfacesGraphicsBuffer, this.currentSurfaceCount);
-            var endCopyQueryIndex = this.renderManager.InsertQueryTimestamp(in copyCommandList);
+            this.graphicsManager.EndGpuZone(copyCommandList);
 
             this.graphicsManager.CommitCommandList(copyCommandList);
-            this.renderManager.AddGpuTiming(commandListName, QueryBufferType.CopyTimestamp, startCopyQueryIndex, endCopyQueryIndex);
 
             return copyCommandList;
         }
@@ -185,7 +184,7 @@ namespace CoreEngine.Rendering
             // var renderTarget = new RenderTargetDescriptor(renderTargetTexture, Vector4.Zero, BlendOperation.AlphaBlending);
             var renderPassDescriptor = new RenderPassDescriptor(renderTarget, null, DepthBufferOperation.None, backfaceCulling: true, PrimitiveType.Triangle);
 
-            var startQueryIndex = this.renderManager.InsertQueryTimestamp(in renderCommandList);
+            this.graphicsManager.BeginGpuZone(renderCommandList, commandListName);
             this.graphicsManager.BeginRenderPass(renderCommandList, renderPassDescriptor, this.shader);
 
             this.graphicsManager.SetShaderParameterValues(renderCommandList, 0, new uint[] { (uint)this.currentSurfaceCount, this.rectangleSurfacesGraphicsBuffer.ShaderResourceIndex });
@@ -193,9 +192,8 @@ namespace CoreEngine.Rendering
             this.graphicsManager.DispatchMesh(renderCommandList, MathUtils.ComputeGroupThreads(this.currentSurfaceCount, maxSurfaceCountPerThreadGroup), 1, 1);
 
             this.graphicsManager.EndRenderPass(renderCommandList);
-            var endQueryIndex = this.renderManager.InsertQueryTimestamp(in renderCommandList);
+            this.graphicsManager.EndGpuZone(renderCommandList);
             this.graphicsManager.CommitCommandList(renderCommandList);
-            this.renderManager.AddGpuTiming(commandListName, QueryBufferType.Timestamp, startQueryIndex, endQueryIndex);
             return renderCommandList;
         }
     }
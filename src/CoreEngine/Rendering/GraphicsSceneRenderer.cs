@@ -101,10 +101,7 @@ namespace CoreEngine.Rendering
         private readonly GraphicsBuffer meshInstanceVisibilityBuffer;
         private readonly GraphicsBuffer indirectCommandBuffer;
 
-        private readonly GraphicsBuffer cpuCamerasBuffer;
         private readonly GraphicsBuffer camerasBuffer;
-
-        private readonly GraphicsBuffer cpuLightsBuffer;
         private readonly GraphicsBuffer lightsBuffer;
 
         private readonly GraphicsBuffer cpuReadBackCounters; 
@@ -150,11 +147,9 @@ namespace CoreEngine.Rendering
 
             this.indirectCommandBuffer = this.graphicsManager.CreateGraphicsBuffer<DispatchMeshIndirectParam>(GraphicsHeapType.Gpu, GraphicsBufferUsage.IndirectCommands, maxMeshInstanceCount, isStatic: false, label: "IndirectCommandBuffer");
 
-            this.cpuCamerasBuffer = this.graphicsManager.CreateGraphicsBuffer<ShaderCamera>(GraphicsHeapType.Upload, GraphicsBufferUsage.Storage, 10000, isStatic: false, label: "ComputeCameras");
-            this.camerasBuffer = this.graphicsManager.CreateGraphicsBuffer<ShaderCamera>(GraphicsHeapType.Gpu, GraphicsBufferUsage.Storage, 10000, isStatic: false, label: "ComputeCameras");
-
-            this.cpuLightsBuffer = this.graphicsManager.CreateGraphicsBuffer<ShaderLight>(GraphicsHeapType.Upload, GraphicsBufferUsage.Storage, 10000, isStatic: false, label: "ComputeLights");
-            this.lightsBuffer = this.graphicsManager.CreateGraphicsBuffer<ShaderLight>(GraphicsHeapType.Gpu, GraphicsBufferUsage.Storage, 10000, isStatic: false, label: "ComputeLights");
+            // Cameras and lights are small and change every frame so they are written directly to GPU memory
+            this.camerasBuffer = this.graphicsManager.CreateGraphicsBuffer<ShaderCamera>(GraphicsHeapType.GpuUpload, GraphicsBufferUsage.Storage, 10000, isStatic: false, label: "ComputeCameras");
+            this.lightsBuffer = this.graphicsManager.CreateGraphicsBuffer<ShaderLight>(GraphicsHeapType.GpuUpload, GraphicsBufferUsage.Storage, 10000, isStatic: false, label: "ComputeLights");
 
             this.cpuReadBackCounters = this.graphicsManager.CreateGraphicsBuffer<uint>(GraphicsHeapType.ReadBack, GraphicsBufferUsage.Storage, 10, isStatic: false, "CpuReadbackCounters");
             this.cpuPipelineStatistics = this.graphicsManager.CreateGraphicsBuffer<ulong>(GraphicsHeapType.ReadBack, GraphicsBufferUsage.Storage, 2 * 14, isStatic: false, "CpuPipelineStatistics");
@@ -211,7 +206,6 @@ namespace CoreEngine.Rendering
             var scene = this.sceneQueue.WaitForNextScene();
             this.renderManager.OcclusionEnabled = scene.IsOcclusionCullingEnabled == 1u;
 
-            // TODO: Find a way to do that also on Vulkan
             var pipelineStatsData = this.graphicsManager.CopyDataFromGraphicsBuffer<ulong>(this.cpuPipelineStatistics);
             this.renderManager.MeshletCount = (int)pipelineStatsData[11] + (int)pipelineStatsData[25];
             this.renderManager.CulledMeshletCount = ((int)pipelineStatsData[12] + (int)pipelineStatsData[26]) / 32;
@@ -233,7 +227,7 @@ namespace CoreEngine.Rendering
             var commandListName = "CopySceneDataToGpu";
             var copyCommandList = this.graphicsManager.CreateCommandList(this.renderManager.CopyCommandQueue, commandListName);
 
-            var startQueryIndex = this.renderManager.InsertQueryTimestamp(copyCommandList);
+            this.graphicsManager.BeginGpuZone(copyCommandList, commandListName);
 
             if (this.isFirstRun)
             {
@@ -246,14 +240,12 @@ namespace CoreEngine.Rendering
             }
 
             ProcessGeometry(in copyCommandList);
-            ProcessCamera(in copyCommandList, scene);
-            ProcessLights(in copyCommandList, scene);
+            ProcessCamera(scene);
+            ProcessLights(scene);
 
-            var endQueryIndex = this.renderManager.InsertQueryTimestamp(copyCommandList);
+            this.graphicsManager.EndGpuZone(copyCommandList);
             this.graphicsManager.CommitCommandList(copyCommandList);
 
-            this.renderManager.AddGpuTiming(commandListName, QueryBufferType.CopyTimestamp, startQueryIndex, endQueryIndex);
-
             if (renderManager.logFrameTime)
             {
                 Logger.EndAction();
@@ -468,7 +460,7 @@ namespace CoreEngine.Rendering
             this.currentMeshInstanceCount = currentMeshInstanceIndex;
         }
 
-        private void ProcessCamera(in CommandList copyCommandList, GraphicsScene scene)
+        private void ProcessCamera(GraphicsScene scene)
         {
             var currentCameraIndex = 0u;
             ShaderCamera shaderCamera;
@@ -500,13 +492,12 @@ namespace CoreEngine.Rendering
             var cameraList = ArrayPool<ShaderCamera>.Shared.Rent(1);
             cameraList[currentCameraIndex++] = shaderCamera;
 
-            this.graphicsManager.CopyDataToGraphicsBuffer<ShaderCamera>(this.cpuCamerasBuffer, 0, cameraList.AsSpan().Slice(0, (int)currentCameraIndex));
-            this.graphicsManager.CopyDataToGraphicsBuffer<ShaderCamera>(copyCommandList, this.camerasBuffer, this.cpuCamerasBuffer, currentCameraIndex);
+            this.graphicsManager.CopyDataToGraphicsBuffer<ShaderCamera>(this.camerasBuffer, 0, cameraList.AsSpan().Slice(0, (int)currentCameraIndex));
 
             ArrayPool<ShaderCamera>.Shared.Return(cameraList);
         }
 
-        private void ProcessLights(in CommandList copyCommandList, GraphicsScene scene)
+        private void ProcessLights(GraphicsScene scene)
         {
             if (scene.Lights.Count == 0)
             {
@@ -535,8 +526,7 @@ namespace CoreEngine.Rendering
                 }
             }
 
-            this.graphicsManager.CopyDataToGraphicsBuffer<ShaderLight>(this.cpuLightsBuffer, 0, lightList.AsSpan().Slice(0, (int)currentLightIndex));
-            this.graphicsManager.CopyDataToGraphicsBuffer<ShaderLight>(copyCommandList, this.lightsBuffer, this.cpuLightsBuffer, currentLightIndex);
+            this.graphicsManager.CopyDataToGraphicsBuffer<ShaderLight>(this.lightsBuffer, 0, lightList.AsSpan().Slice(0, (int)currentLightIndex));
 
             this.renderManager.LightsCount = (int)currentLightIndex;
             ArrayPool<ShaderLight>.Shared.Return(lightList);
@@ -552,7 +542,7 @@ namespace CoreEngine.Rendering
             var computeRenderCommandList = this.graphicsManager.CreateCommandList(this.renderManager.ComputeCommandQueue, commandListName);
             this.graphicsManager.ResetIndirectCommandBuffer(computeRenderCommandList, indirectCommandBuffer);
             
-            var startQueryIndex = this.renderManager.InsertQueryTimestamp(in computeRenderCommandList);
+            this.graphicsManager.BeginGpuZone(computeRenderCommandList, commandListName);
             this.graphicsManager.SetShader(computeRenderCommandList, this.computeRenderCommandsShader);
 
             this.graphicsManager.SetShaderParameterValues(computeRenderCommandList, 0, new uint[]
@@ -578,14 +568,12 @@ namespace CoreEngine.Rendering
                 this.graphicsManager.DispatchCompute(computeRenderCommandList, MathUtils.ComputeGroupThreads(this.currentMeshInstanceCount, waveSize), 1, 1);
             }
 
-            var endQueryIndex = this.renderManager.InsertQueryTimestamp(in computeRenderCommandList);
+            this.graphicsManager.EndGpuZone(computeRenderCommandList);
 
             this.graphicsManager.SetGraphicsBufferBarrier(computeRenderCommandList, indirectCommandBuffer);
             this.graphicsManager.CopyDataToGraphicsBuffer<uint>(computeRenderCommandList, this.cpuReadBackCounters, indirectCommandBuffer, 1, isPostPass ? 1u * sizeof(uint) : 0u, indirectCommandBuffer.SizeInBytes - sizeof(uint)); 
             this.graphicsManager.CommitCommandList(computeRenderCommandList);
 
-            this.renderManager.AddGpuTiming(commandListName, QueryBufferType.Timestamp, startQueryIndex, endQueryIndex);
-
             return computeRenderCommandList;
         }
 
@@ -601,7 +589,7 @@ namespace CoreEngine.Rendering
             var renderTarget = new RenderTargetDescriptor(mainRenderTargetTexture, isPostPass ? null : Vector4.Zero, BlendOperation.None);
             var renderPassDescriptor = new RenderPassDescriptor(renderTarget, depthBuffer, isPostPass ? DepthBufferOperation.Write : DepthBufferOperation.ClearWrite, backfaceCulling: true, PrimitiveType.Triangle);
 
-            var startQueryIndex = this.renderManager.InsertQueryTimestamp(in renderCommandList);
+            this.graphicsManager.BeginGpuZone(renderCommandList, commandListName);
 
             this.graphicsManager.BeginRenderPass(renderCommandList, renderPassDescriptor, this.renderMeshInstanceShader);
             this.graphicsManager.ResetQueryBuffer(this.pipelineStatistics);
@@ -614,7 +602,7 @@ namespace CoreEngine.Rendering
 
             this.graphicsManager.EndQuery(renderCommandList, this.pipelineStatistics, isPostPass ? 1 : 0);
             this.graphicsManager.EndRenderPass(renderCommandList);
-            var endQueryIndex = this.renderManager.InsertQueryTimestamp(in renderCommandList);
+            this.graphicsManager.EndGpuZone(renderCommandList);
 
             if (isPostPass)
             {
@@ -622,7 +610,6 @@ namespace CoreEngine.Rendering
             }
 
             this.graphicsManager.CommitCommandList(renderCommandList);
-            this.renderManager.AddGpuTiming(commandListName, QueryBufferType.Timestamp, startQueryIndex, endQueryIndex);
 
             return renderCommandList;
         }
@@ -630,7 +617,7 @@ namespace CoreEngine.Rendering
         private CommandList CreateDepthPyramidCommandList(Texture depthPyramidBuffer, Texture depthBuffer)
         {
             var commandList = this.graphicsManager.CreateCommandList(this.renderManager.ComputeCommandQueue, "GenerateDepthPyramid");
-            var startQueryIndex = this.renderManager.InsertQueryTimestamp(in commandList);
+            this.graphicsManager.BeginGpuZone(commandList, "GenerateDepthPyramid");
             this.graphicsManager.SetShader(commandList, this.computeGenerateDepthPyramid);
 
             var currentWidth = depthPyramidBuffer.Width;
@@ -658,11 +645,9 @@ namespace CoreEngine.Rendering
             }
 
             this.graphicsManager.SetTextureBarrier(commandList, depthPyramidBuffer);
-            var endQueryIndex = this.renderManager.InsertQueryTimestamp(in commandList);
+            this.graphicsManager.EndGpuZone(commandList);
             this.graphicsManager.CommitCommandList(commandList);
 
-            this.renderManager.AddGpuTiming("GenerateDepthPyramid", QueryBufferType.Timestamp, startQueryIndex, endQueryIndex);
-
             return commandList;
         }
 
@@ -685,13 +670,20 @@ namespace CoreEngine.Rendering
 
             // TODO: Try to execute all the command lists except copy to the render command queue because the command lists are chained 
             // and cannot run in parallel
-            var copyFence = this.graphicsManager.ExecuteCommandLists(this.renderManager.CopyCommandQueue, new CommandList[] { copyCommandList });
+            var batches = new CommandListBatch[]
+            {
+                new CommandListBatch(this.renderManager.CopyCommandQueue, new CommandList[] { copyCommandList }),
+                new CommandListBatch(this.renderManager.ComputeCommandQueue, new CommandList[] { computeRenderCommandList }, 0),
+                new CommandListBatch(this.renderManager.RenderCommandQueue, new CommandList[] { renderGeometryCommandList }, 1),
+                new CommandListBatch(this.renderManager.ComputeCommandQueue, new CommandList[] { depthPyramidCommandList, postComputeRenderCommandList }, 2),
+                new CommandListBatch(this.renderManager.RenderCommandQueue, new CommandList[] { postRenderGeometryCommandList }, 3)
+            };
 
-            var computeFence = this.graphicsManager.ExecuteCommandLists(this.renderManager.ComputeCommandQueue, new CommandList[] { computeRenderCommandList }, new Fence[] { copyFence });
-            var renderFence = this.graphicsManager.ExecuteCommandLists(this.renderManager.RenderCommandQueue, new CommandList[] { renderGeometryCommandList }, new Fence[] { computeFence });
+            // The chained batches are sent in one call
+            var fences = new Fence[batches.Length];
+            this.graphicsManager.ExecuteCommandLists(batches, fences);
+            var postRenderFence = fences[batches.Length - 1];
 
-            var postComputeFence = this.graphicsManager.ExecuteCommandLists(this.renderManager.ComputeCommandQueue, new CommandList[] { depthPyramidCommandList, postComputeRenderCommandList }, new Fence[] { renderFence });
-            var postRenderFence = this.graphicsManager.ExecuteCommandLists(this.renderManager.RenderCommandQueue, new CommandList[] { postRenderGeometryCommandList }, new Fence[] { postComputeFence });
             //var postRenderFence = this.graphicsManager.ExecuteCommandLists(this.renderManager.RenderCommandQueue, new CommandList[] { computeRenderCommandList, renderGeometryCommandList, depthPyramidCommandList, postComputeRenderCommandList, postRenderGeometryCommandList }, new Fence[] { copyFence });
 
             // TODO: Submit render and debug command list at the same time
@@ -12,26 +12,6 @@ using CoreEngine.Inputs;
 
 namespace CoreEngine.Rendering
 {
-    public class GpuTiming
-    {
-        public GpuTiming(string name, QueryBufferType type, int startIndex, int endIndex)
-        {
-            this.Name = name;
-            this.StartIndex = startIndex;
-            this.EndIndex = endIndex;
-            this.Type = type;
-            this.StartTimestamp = 0;
-            this.EndTimestamp = 0;
-        }
-
-        public string Name { get; }
-        public int StartIndex { get; }
-        public int EndIndex { get; }
-        public QueryBufferType Type { get; }
-        public ulong StartTimestamp { get; set; }
-        public ulong EndTimestamp { get; set; }
-    }
-
     public class RenderManager : SystemManager, IDisposable
     {
         private readonly GraphicsManager graphicsManager;
@@ -49,18 +29,6 @@ namespace CoreEngine.Rendering
 
         private Shader computeDirectTransferShader;
 
-        private QueryBuffer globalQueryBuffer;
-        private GraphicsBuffer globalCpuQueryBuffer;
-        private int currentQueryIndex;
-
-        private QueryBuffer globalCopyQueryBuffer;
-        private GraphicsBuffer globalCpuCopyQueryBuffer;
-        private int currentCopyQueryIndex;
-
-        private List<GpuTiming> gpuTimings;
-        private List<GpuTiming>[] gpuTimingsList = new List<GpuTiming>[2];
-        private List<GpuTiming> currentGpuTimings;
-
         private Window window;
         private Vector2 currentWindowRenderSize;
         private SwapChain swapChain;
@@ -70,6 +38,11 @@ namespace CoreEngine.Rendering
 
         private Fence? presentFence;
 
+        // Queue calibrations of the current capture, GPU zone timestamps are converted to the Stopwatch clock
+        private long calibratedCaptureTimestamp;
+        private readonly Dictionary<IntPtr, (GraphicsTimestampCalibration Calibration, ulong Frequency)> commandQueueCalibrations = new Dictionary<IntPtr, (GraphicsTimestampCalibration, ulong)>();
+        private readonly Dictionary<IntPtr, (ulong StartTimestamp, ulong EndTimestamp, ulong Frequency)> gpuQueueSpans = new Dictionary<IntPtr, (ulong, ulong, ulong)>();
+
         // TODO: Each Render Manager should use their own Graphics Manager
         public RenderManager(Window window, NativeUIManager nativeUIManager, GraphicsManager graphicsManager, ResourcesManager resourcesManager, GraphicsSceneQueue graphicsSceneQueue)
         {
@@ -108,19 +81,6 @@ namespace CoreEngine.Rendering
 
             this.GraphicsSceneRenderer = new GraphicsSceneRenderer(this, this.graphicsManager, graphicsSceneQueue, resourcesManager, mainRenderTarget);
             this.Graphics2DRenderer = new Graphics2DRenderer(this, this.graphicsManager, resourcesManager);
-            
-            // TODO: TESTS: TO REMOVE
-            this.globalQueryBuffer = this.graphicsManager.CreateQueryBuffer(QueryBufferType.Timestamp, 1000, "RendererQueryBuffer");
-            this.globalCpuQueryBuffer = this.graphicsManager.CreateGraphicsBuffer<ulong>(GraphicsHeapType.ReadBack, Graphics.GraphicsBufferUsage.Storage, 1000, isStatic: false, "RendererCpuQueryBuffer");
-
-            this.globalCopyQueryBuffer = this.graphicsManager.CreateQueryBuffer(QueryBufferType.CopyTimestamp, 1000, "RendererCopyQueryBuffer");
-            this.globalCpuCopyQueryBuffer = this.graphicsManager.CreateGraphicsBuffer<ulong>(GraphicsHeapType.ReadBack, Graphics.GraphicsBufferUsage.Storage, 1000, isStatic: false, "RendererCpuCopyQueryBuffer");
-
-            this.gpuTimingsList[0] = new List<GpuTiming>();
-            this.gpuTimingsList[1] = new List<GpuTiming>();
-
-            this.gpuTimings = this.gpuTimingsList[0];
-            this.currentGpuTimings = new List<GpuTiming>(this.gpuTimings);
         }
 
         public void Dispose()
@@ -138,14 +98,6 @@ namespace CoreEngine.Rendering
                     this.graphicsManager.WaitForCommandQueueOnCpu(this.presentFence.Value);
                 }
 
-                this.globalCpuCopyQueryBuffer.Dispose();
-                this.globalCpuQueryBuffer.Dispose();
-
-                this.globalCopyQueryBuffer.Dispose();
-                this.globalQueryBuffer.Dispose();
-
-                this.globalCpuQueryBuffer.Dispose();
-
                 this.swapChain.Dispose();
 
                 this.computeDirectTransferShader.Dispose();
@@ -181,44 +133,28 @@ namespace CoreEngine.Rendering
             return new Vector2(this.swapChain.Width, this.swapChain.Height);
         }
 
-        public int InsertQueryTimestamp(in CommandList commandList)
-        {
-            if (commandList.Type == CommandType.Copy)
-            {
-                var queryIndex = this.currentCopyQueryIndex;
-                this.graphicsManager.EndQuery(commandList, this.globalCopyQueryBuffer, this.currentCopyQueryIndex++);
-
-                return queryIndex;
-            }
-
-            else
-            {
-                var queryIndex = this.currentQueryIndex;
-                this.graphicsManager.EndQuery(commandList, this.globalQueryBuffer, this.currentQueryIndex++);
-
-                return queryIndex;
-            }
-        }
-
-        public void AddGpuTiming(string name, QueryBufferType type, int startQueryIndex, int endQueryIndex)
-        {
-            this.gpuTimings.Add(new GpuTiming(name, type, startQueryIndex, endQueryIndex));
-        }
-
-        List<GpuTiming> previousGpuTiming = new List<GpuTiming>();
         internal bool logFrameTime;
 
         internal void WaitForSwapChainOnCpu()
         {
+            Profiler.BeginCpuZone("WaitForSwapChain");
             this.graphicsManager.WaitForSwapChainOnCpu(this.swapChain);
+            Profiler.EndCpuZone();
+
             this.stopwatch.Restart();
         }
 
         internal void Render()
         {
+            Profiler.BeginCpuZone("Render");
+
             // TODO: Rename that to Reset
             this.graphicsManager.MoveToNextFrame();
-            ResetGpuTimers();
+
+            if (Profiler.IsCapturing)
+            {
+                AddGpuZonesToCapture();
+            }
 
             if (this.graphicsManager.CurrentFrameNumber > 1)
             {
@@ -246,7 +182,9 @@ namespace CoreEngine.Rendering
                 Logger.BeginAction($"SceneRenderer (FrameSize: {this.currentFrameSize})");
             }
 
+            Profiler.BeginCpuZone("GraphicsSceneRenderer");
             var rendererfence = this.GraphicsSceneRenderer.Render(this.mainRenderTarget);
+            Profiler.EndCpuZone();
             
             if (logFrameTime)
             {
@@ -254,8 +192,57 @@ namespace CoreEngine.Rendering
             }
 
             DrawDebugMessages();
+
+            Profiler.BeginCpuZone("Graphics2DRenderer");
             var fence = this.Graphics2DRenderer.Render(this.mainRenderTarget, rendererfence);
+            Profiler.EndCpuZone();
+
+            Profiler.BeginCpuZone("PresentScreenBuffer");
             PresentScreenBuffer(this.mainRenderTarget, in fence);
+            Profiler.EndCpuZone();
+
+            Profiler.EndCpuZone();
+        }
+
+        private void AddGpuZonesToCapture()
+        {
+            // The calibration can wait for the GPU on some backends so it is only done once per capture
+            if (this.calibratedCaptureTimestamp != Profiler.CaptureStartTimestamp)
+            {
+                this.calibratedCaptureTimestamp = Profiler.CaptureStartTimestamp;
+                this.commandQueueCalibrations.Clear();
+            }
+
+            var gpuZones = this.graphicsManager.GpuZones;
+
+            for (var i = 0; i < gpuZones.Count; i++)
+            {
+                var gpuZone = gpuZones[i];
+                var commandQueue = gpuZone.CommandQueue;
+
+                if (!this.commandQueueCalibrations.TryGetValue(commandQueue.NativePointer, out var commandQueueCalibration))
+                {
+                    commandQueueCalibration = (this.graphicsManager.GetCommandQueueTimestampCalibration(commandQueue), this.graphicsManager.GetCommandQueueTimestampFrequency(commandQueue));
+                    this.commandQueueCalibrations.Add(commandQueue.NativePointer, commandQueueCalibration);
+                }
+
+                // Queues without timestamp support return an empty calibration
+                if (commandQueueCalibration.Calibration.GpuTimestamp == 0 || commandQueueCalibration.Frequency == 0)
+                {
+                    continue;
+                }
+
+                var startTimestamp = ConvertGpuTimestamp(gpuZone.StartTimestamp, commandQueueCalibration.Calibration, commandQueueCalibration.Frequency);
+                var endTimestamp = ConvertGpuTimestamp(gpuZone.EndTimestamp, commandQueueCalibration.Calibration, commandQueueCalibration.Frequency);
+
+                Profiler.AddGpuZone(commandQueue.Label, gpuZone.Name, startTimestamp, endTimestamp);
+            }
+        }
+
+        private static long ConvertGpuTimestamp(ulong gpuTimestamp, in GraphicsTimestampCalibration calibration, ulong frequency)
+        {
+            var gpuTicks = (long)(gpuTimestamp - calibration.GpuTimestamp);
+            return (long)calibration.CpuTimestamp + (long)((double)gpuTicks * Stopwatch.Frequency / frequency);
         }
 
         private void PresentScreenBuffer(Texture mainRenderTargetTexture, in Fence? fenceToWait)
@@ -265,27 +252,19 @@ namespace CoreEngine.Rendering
                 Logger.BeginAction("PresentScreenBuffer");
             }
 
-            var resolveCopyCountersCommandList = this.graphicsManager.CreateCommandList(this.CopyCommandQueue, "ResolveCopyCounters");
-            this.graphicsManager.ResolveQueryData(resolveCopyCountersCommandList, this.globalCopyQueryBuffer, this.globalCpuCopyQueryBuffer, 0..this.currentCopyQueryIndex);
-            this.graphicsManager.CommitCommandList(resolveCopyCountersCommandList);
-            this.graphicsManager.ExecuteCommandLists(this.CopyCommandQueue, new CommandList[] { resolveCopyCountersCommandList });
-
             var presentCommandList = this.graphicsManager.CreateCommandList(this.presentQueue, "PresentScreenBuffer");
             var backBufferTexture = this.graphicsManager.GetSwapChainBackBufferTexture(this.swapChain);
       
             var renderTarget = new RenderTargetDescriptor(backBufferTexture, null, BlendOperation.None);
             var renderPassDescriptor2 = new RenderPassDescriptor(renderTarget, null, DepthBufferOperation.None, true, PrimitiveType.Triangle);
             this.graphicsManager.BeginRenderPass(presentCommandList, renderPassDescriptor2, this.computeDirectTransferShader);
-            var startQueryIndex = InsertQueryTimestamp(in presentCommandList);
+            this.graphicsManager.BeginGpuZone(presentCommandList, "PresentScreenBuffer");
             this.graphicsManager.SetShaderParameterValues(presentCommandList, 0, new uint[] { mainRenderTargetTexture.ShaderResourceIndex });
             this.graphicsManager.DispatchMesh(presentCommandList, 1, 1, 1);
-            var endQueryIndex = InsertQueryTimestamp(in presentCommandList);
+            this.graphicsManager.EndGpuZone(presentCommandList);
             this.graphicsManager.EndRenderPass(presentCommandList);
-            this.graphicsManager.ResolveQueryData(presentCommandList, this.globalQueryBuffer, this.globalCpuQueryBuffer, 0..this.currentQueryIndex);
             this.graphicsManager.CommitCommandList(presentCommandList);
 
-            AddGpuTiming("PresentScreenBuffer", QueryBufferType.Timestamp, startQueryIndex, endQueryIndex);
-
             this.presentFence = this.graphicsManager.ExecuteCommandLists(this.presentQueue, new CommandList[] { presentCommandList }, fenceToWait.HasValue ? new Fence[] { fenceToWait.Value } : Array.Empty<Fence>());
             
             if (logFrameTime)
@@ -302,40 +281,6 @@ namespace CoreEngine.Rendering
             }
         }
 
-        private void ResetGpuTimers()
-        {
-            this.currentQueryIndex = 0;
-            this.currentCopyQueryIndex = 0;
-            this.gpuTimings = this.gpuTimingsList[(int)this.graphicsManager.CurrentFrameNumber % 2];
-            
-            this.currentGpuTimings.Clear();
-            this.currentGpuTimings.AddRange(this.gpuTimings);
-            this.gpuTimings.Clear();
-
-            this.graphicsManager.ResetQueryBuffer(this.globalQueryBuffer);
-            this.graphicsManager.ResetQueryBuffer(this.globalCopyQueryBuffer);
-
-            var queryData = this.graphicsManager.CopyDataFromGraphicsBuffer<ulong>(this.globalCpuQueryBuffer);
-            var queryCopyData = this.graphicsManager.CopyDataFromGraphicsBuffer<ulong>(this.globalCpuCopyQueryBuffer);
-
-            for (var i = 0; i < this.currentGpuTimings.Count; i++)
-            {
-                var gpuTiming = this.currentGpuTimings[i];
-
-                if (gpuTiming.Type == QueryBufferType.CopyTimestamp)
-                {
-                    gpuTiming.StartTimestamp = queryCopyData[gpuTiming.StartIndex];
-                    gpuTiming.EndTimestamp = queryCopyData[gpuTiming.EndIndex];
-                }
-
-                else
-                {
-                    gpuTiming.StartTimestamp = queryData[gpuTiming.StartIndex];
-                    gpuTiming.EndTimestamp = queryData[gpuTiming.EndIndex];
-                }
-            }
-        }
-
         #if DEBUG
         private readonly string compilationConfiguration = "Debug";
         #else
@@ -370,43 +315,56 @@ namespace CoreEngine.Rendering
             this.Graphics2DRenderer.DrawText($"    Lights: {this.LightsCount}", new Vector2(10, 370));
             this.Graphics2DRenderer.DrawText($"Gpu Pipeline:", new Vector2(10, 410));
 
-            var startGpuTimestamp = 0ul;
-            var endGpuTimestamp = 0ul;
-            var gpuExecutionTime = 0.0;
+            var gpuZones = this.graphicsManager.GpuZones;
 
-            // TODO: For the moment we only take the frequency of the render queue
-            // at each frame which is not good!
-            var renderQueueFrequency = this.graphicsManager.GetCommandQueueTimestampFrequency(this.RenderCommandQueue);
+            // Each queue has its own timestamp frequency and origin so the spans are computed per queue
+            this.gpuQueueSpans.Clear();
 
-            for (var i = 0; i < this.currentGpuTimings.Count; i++)
+            for (var i = 0; i < gpuZones.Count; i++)
             {
-                var gpuTiming = this.currentGpuTimings[i];
+                var gpuZone = gpuZones[i];
+                var commandQueue = gpuZone.CommandQueue;
 
-                if (startGpuTimestamp == 0ul)
+                if (!this.gpuQueueSpans.TryGetValue(commandQueue.NativePointer, out var gpuQueueSpan))
                 {
-                    startGpuTimestamp = gpuTiming.StartTimestamp;
+                    gpuQueueSpan = (ulong.MaxValue, 0ul, this.graphicsManager.GetCommandQueueTimestampFrequency(commandQueue));
                 }
 
-                if (gpuTiming.EndTimestamp > endGpuTimestamp)
+                gpuQueueSpan.StartTimestamp = Math.Min(gpuQueueSpan.StartTimestamp, gpuZone.StartTimestamp);
+                gpuQueueSpan.EndTimestamp = Math.Max(gpuQueueSpan.EndTimestamp, gpuZone.EndTimestamp);
+                this.gpuQueueSpans[commandQueue.NativePointer] = gpuQueueSpan;
+            }
+
+            var gpuExecutionTime = 0.0;
+
+            foreach (var gpuQueueSpan in this.gpuQueueSpans.Values)
+            {
+                if (gpuQueueSpan.Frequency > 0)
                 {
-                    endGpuTimestamp = gpuTiming.EndTimestamp;
+                    gpuExecutionTime = Math.Max(gpuExecutionTime, (gpuQueueSpan.EndTimestamp - gpuQueueSpan.StartTimestamp) / (double)gpuQueueSpan.Frequency * 1000.0);
                 }
+            }
 
-                var duration = (gpuTiming.EndTimestamp - gpuTiming.StartTimestamp) / (double)renderQueueFrequency * 1000.0;
-                var startTime = gpuTiming.StartTimestamp != 0 ? (gpuTiming.StartTimestamp - startGpuTimestamp) / (double)renderQueueFrequency * 1000.0 : 0;
+            for (var i = 0; i < gpuZones.Count; i++)
+            {
+                var gpuZone = gpuZones[i];
+                var gpuQueueSpan = this.gpuQueueSpans[gpuZone.CommandQueue.NativePointer];
 
-                this.Graphics2DRenderer.DrawText($"    {gpuTiming.Name}: {Utils.FormatDurationInMs(duration)} ({Utils.FormatDurationInMs(startTime)})", new Vector2(10, 450 + i * 40));
+                var duration = 0.0;
+                var startTime = 0.0;
 
-                gpuExecutionTime += duration;
+                if (gpuQueueSpan.Frequency > 0)
+                {
+                    duration = (gpuZone.EndTimestamp - gpuZone.StartTimestamp) / (double)gpuQueueSpan.Frequency * 1000.0;
+                    startTime = (gpuZone.StartTimestamp - gpuQueueSpan.StartTimestamp) / (double)gpuQueueSpan.Frequency * 1000.0;
+                }
+
+                this.Graphics2DRenderer.DrawText($"    {new string(' ', gpuZone.Depth * 4)}{gpuZone.Name}: {Utils.FormatDurationInMs(duration)} ({Utils.FormatDurationInMs(startTime)})", new Vector2(10, 450 + i * 40));
             }
 
-            gpuExecutionTime = (endGpuTimestamp - startGpuTimestamp) / (double)renderQueueFrequency * 1000.0;
             this.lastGpuDuration += gpuExecutionTime;
 
             this.Graphics2DRenderer.DrawText($"Gpu Frame Duration: {gpuExecutionTime.ToString("0.00", CultureInfo.InvariantCulture)} ms", new Vector2(10, 50));
-
-            this.previousGpuTiming.Clear();
-            this.previousGpuTiming.AddRange(this.currentGpuTimings);
         }
 
         private void InitResourceLoaders(ResourcesManager resourcesManager)
@@ -54,7 +54,7 @@ namespace CoreEngine.Rendering
         public override Resource CreateEmptyResource(uint resourceId, string path)
         {
             var texture = new Texture(this.graphicsManager, this.shaderResourceManager, 256, 256, resourceId, path, $"{Path.GetFileNameWithoutExtension(path)}Texture");
-            texture.NativePointer1 = this.emptyTexture.NativePointer1;
+            texture.NativePointers[0] = this.emptyTexture.NativePointers[0];
             return texture;
         }
 
@@ -85,7 +85,21 @@ namespace CoreEngine.Rendering
             texture.FaceCount = reader.ReadInt32();
             texture.MipLevels = reader.ReadInt32();
 
-            if (texture.NativePointer != IntPtr.Zero && texture.NativePointer1 != this.emptyTexture.NativePointer1)
+            // When the GPU memory is over budget the first mip level is dropped to avoid paging
+            var skippedMipLevels = 0;
+
+            if (this.graphicsManager.IsGpuMemoryOverBudget && texture.MipLevels > 1 && (texture.Width / 2) % 4 == 0 && (texture.Height / 2) % 4 == 0)
+            {
+                skippedMipLevels = 1;
+
+                texture.Width /= 2;
+                texture.Height /= 2;
+                texture.MipLevels -= skippedMipLevels;
+
+                Logger.WriteMessage($"Dropping the first mip level of texture '{resource.Path}' because the GPU memory is over budget", LogMessageTypes.Warning);
+            }
+
+            if (texture.NativePointer != IntPtr.Zero && texture.NativePointers[0] != this.emptyTexture.NativePointers[0])
             {
                 texture.Dispose();
             }
@@ -93,10 +107,8 @@ namespace CoreEngine.Rendering
             // TODO: Refactor that because normally it shouldn't be possible to continue using the texture object after the dispose
             // Event if it is working now because of the dispose only free the native resources
             var createdTexture = this.graphicsManager.CreateTexture(GraphicsHeapType.Gpu, texture.TextureFormat, TextureUsage.ShaderRead, texture.Width, texture.Height, texture.FaceCount, texture.MipLevels, 1, isStatic: true, label: $"{Path.GetFileNameWithoutExtension(texture.Path)}Texture");
-            texture.NativePointer1 = createdTexture.NativePointer1;
-            texture.NativePointer2 = createdTexture.NativePointer2;
-            texture.ShaderResourceIndex1 = createdTexture.ShaderResourceIndex1;
-            texture.ShaderResourceIndex2 = createdTexture.ShaderResourceIndex2;
+            texture.NativePointers = createdTexture.NativePointers;
+            texture.ShaderResourceIndexes = createdTexture.ShaderResourceIndexes;
 
             var copyCommandList = this.graphicsManager.CreateCommandList(this.renderManager.CopyCommandQueue, "TextureLoader");
 
@@ -105,6 +117,11 @@ namespace CoreEngine.Rendering
                 var textureWidth = texture.Width;
                 var textureHeight = texture.Height;
 
+                for (var j = 0; j < skippedMipLevels; j++)
+                {
+                    memoryStream.Seek(reader.ReadInt32(), SeekOrigin.Current);
+                }
+
                 for (var j = 0; j < texture.MipLevels; j++)
                 {
                     var textureDataLength = reader.ReadInt32();
@@ -1,3 +1,5 @@
+using System.Reflection;
+
 namespace CoreEngine
 {
     public static class Utils
@@ -65,6 +67,60 @@ namespace CoreEngine
 
         public static string[] GetCommandLineArguments()
         {
+            var args = ReadCommandLineArguments();
+
+            var index = args.IndexOf("--vulkan");
+            
+            if (index != -1)
+            {
+                args.RemoveAt(index);
+            }
+
+            index = args.IndexOf("--null");
+            
+            if (index != -1)
+            {
+                args.RemoveAt(index);
+            }
+
+            // Engine options
+            RemoveCommandLineOption(args, "--frames-in-flight");
+            RemoveCommandLineOption(args, "--trace");
+            RemoveCommandLineOption(args, "--trace-frames");
+
+            // Headless host options
+            RemoveCommandLineOption(args, "--frames");
+            RemoveCommandLineOption(args, "--width");
+            RemoveCommandLineOption(args, "--height");
+
+            return args.ToArray();
+        }
+
+        public static string? GetCommandLineOptionValue(string option)
+        {
+            var args = ReadCommandLineArguments();
+            var index = args.IndexOf(option);
+
+            if (index == -1 || index + 1 >= args.Count)
+            {
+                return null;
+            }
+
+            return args[index + 1];
+        }
+
+        private static List<string> ReadCommandLineArguments()
+        {
+            // When the runtime is hosted by the native Linux host, there is no entry assembly and the
+            // command line only contains the host path so the arguments are read from the process directly
+            if (OperatingSystem.IsLinux() && Assembly.GetEntryAssembly() == null && File.Exists("/proc/self/cmdline"))
+            {
+                var nativeArgs = new List<string>(File.ReadAllText("/proc/self/cmdline").Split('\0', StringSplitOptions.RemoveEmptyEntries));
+                nativeArgs.RemoveAt(0);
+
+                return nativeArgs;
+            }
+
             var commandLine = Environment.CommandLine;
 
             var startIndex = commandLine.IndexOf("\"", StringComparison.InvariantCulture);
@@ -84,15 +140,17 @@ namespace CoreEngine
                 args.RemoveAt(0);
             }
 
+            return args;
+        }
+
+        private static void RemoveCommandLineOption(List<string> args, string option)
+        {
+            var index = args.IndexOf(option);
 
-            var index = args.IndexOf("--vulkan");
-            
             if (index != -1)
             {
-                args.RemoveAt(index);
+                args.RemoveRange(index, Math.Min(2, args.Count - index));
             }
-
-            return args.ToArray();
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,236 @@
+#pragma once
+#include <stdint.h>
+#include <assert.h>
+#include <time.h>
+#include <atomic>
+#include <vector>
+#include "CoreEngine.h"
+
+using namespace std;
+
+static const uint32_t GpuZoneMaxFramesInFlightCount = 4;
+static const uint32_t GpuZoneMaxFrameCount = GpuZoneMaxFramesInFlightCount + 1;
+static const uint32_t GpuZoneMaxDepth = 16;
+static const uint32_t GpuZoneMaxCountPerFrame = 1024;
+static const uint32_t GpuZoneInvalidIndex = UINT32_MAX;
+
+// Host clock used to correlate the GPU timestamps with the CPU. It is the clock read by Stopwatch
+// in the engine: QueryPerformanceCounter on Windows and CLOCK_MONOTONIC in nanoseconds elsewhere.
+uint64_t GetHostTimestamp()
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+#endif
+}
+
+uint64_t GetHostTimestampFrequency()
+{
+#ifdef _WIN32
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return frequency.QuadPart;
+#else
+    return 1000000000;
+#endif
+}
+
+// Zones opened on a command list, each command list keeps its own stack
+struct GpuZoneStack
+{
+    uint32_t ZoneIndices[GpuZoneMaxDepth];
+    uint32_t Depth;
+};
+
+struct GpuZoneRecord
+{
+    uint32_t NameId;
+    uint32_t Depth;
+    bool IsEnded;
+};
+
+// CPU side bookkeeping of the GPU zones shared by the graphics services. Each frame slot owns a range
+// of 2 timestamp queries per zone (start and end). There is one more slot than frames in flight so a slot
+// is read back framesInFlightCount frames after it was recorded, once the CPU has waited for that frame.
+// The timestamps are then already available and the CPU never waits for the GPU.
+class GpuZoneProfiler
+{
+    public:
+        GpuZoneProfiler(uint32_t maxFramesInFlightCount);
+
+        // Must be called before any zone is recorded, the queries are allocated for the maximum count
+        void SetFramesInFlightCount(uint32_t framesInFlightCount);
+
+        uint32_t GetQueryCount() const;
+        uint32_t GetFrameQueryOffset(uint32_t frameIndex) const;
+        uint32_t GetFrameZoneCount(uint32_t frameIndex) const;
+        uint32_t GetCurrentFrameIndex() const;
+
+        // Returns the zone index used to compute the query indices or GpuZoneInvalidIndex when the
+        // frame is full, the zone must still be ended in that case
+        uint32_t BeginZone(GpuZoneStack* zoneStack, uint32_t nameId);
+        uint32_t EndZone(GpuZoneStack* zoneStack);
+
+        uint32_t GetStartQueryIndex(uint32_t zoneIndex) const;
+        uint32_t GetEndQueryIndex(uint32_t zoneIndex) const;
+
+        // Returns the slot that is going to be reused, its timestamps must be read before ResolveZones
+        uint32_t GetNextFrameIndex() const;
+
+        // Fills the zones of the next frame slot from its timestamps and makes it the current slot.
+        // Zones with unavailable timestamps (0) are skipped.
+        int ResolveZones(const uint64_t* frameTimestamps, GraphicsGpuZone* gpuZones, int gpuZonesLength);
+
+    private:
+        uint32_t maxFrameCount;
+        uint32_t frameCount;
+        uint32_t currentFrameIndex = 0;
+        vector<GpuZoneRecord> zoneRecords;
+        atomic<uint32_t> frameZoneCounts[GpuZoneMaxFrameCount];
+};
+
+GpuZoneProfiler::GpuZoneProfiler(uint32_t maxFramesInFlightCount)
+{
+    assert(maxFramesInFlightCount > 0 && maxFramesInFlightCount <= GpuZoneMaxFramesInFlightCount);
+
+    this->maxFrameCount = maxFramesInFlightCount + 1;
+    this->zoneRecords.resize(this->maxFrameCount * GpuZoneMaxCountPerFrame);
+
+    SetFramesInFlightCount(maxFramesInFlightCount);
+}
+
+void GpuZoneProfiler::SetFramesInFlightCount(uint32_t framesInFlightCount)
+{
+    assert(framesInFlightCount > 0 && framesInFlightCount + 1 <= this->maxFrameCount);
+
+    this->frameCount = framesInFlightCount + 1;
+    this->currentFrameIndex = 0;
+
+    for (uint32_t i = 0; i < GpuZoneMaxFrameCount; i++)
+    {
+        this->frameZoneCounts[i] = 0;
+    }
+}
+
+uint32_t GpuZoneProfiler::GetQueryCount() const
+{
+    return this->maxFrameCount * GpuZoneMaxCountPerFrame * 2;
+}
+
+uint32_t GpuZoneProfiler::GetFrameQueryOffset(uint32_t frameIndex) const
+{
+    return frameIndex * GpuZoneMaxCountPerFrame * 2;
+}
+
+uint32_t GpuZoneProfiler::GetFrameZoneCount(uint32_t frameIndex) const
+{
+    auto zoneCount = this->frameZoneCounts[frameIndex].load();
+    return zoneCount > GpuZoneMaxCountPerFrame ? GpuZoneMaxCountPerFrame : zoneCount;
+}
+
+uint32_t GpuZoneProfiler::GetCurrentFrameIndex() const
+{
+    return this->currentFrameIndex;
+}
+
+uint32_t GpuZoneProfiler::BeginZone(GpuZoneStack* zoneStack, uint32_t nameId)
+{
+    // Command lists can be recorded on several threads so the zone slots are allocated atomically
+    auto frameZoneIndex = this->frameZoneCounts[this->currentFrameIndex]++;
+    auto zoneIndex = GpuZoneInvalidIndex;
+
+    if (frameZoneIndex < GpuZoneMaxCountPerFrame && zoneStack->Depth < GpuZoneMaxDepth)
+    {
+        zoneIndex = this->currentFrameIndex * GpuZoneMaxCountPerFrame + frameZoneIndex;
+
+        auto& zoneRecord = this->zoneRecords[zoneIndex];
+        zoneRecord.NameId = nameId;
+        zoneRecord.Depth = zoneStack->Depth;
+        zoneRecord.IsEnded = false;
+    }
+
+    else if (frameZoneIndex < GpuZoneMaxCountPerFrame)
+    {
+        // The slot was reserved but it will never be ended
+        this->zoneRecords[this->currentFrameIndex * GpuZoneMaxCountPerFrame + frameZoneIndex].IsEnded = false;
+    }
+
+    if (zoneStack->Depth < GpuZoneMaxDepth)
+    {
+        zoneStack->ZoneIndices[zoneStack->Depth] = zoneIndex;
+    }
+
+    zoneStack->Depth++;
+    return zoneIndex;
+}
+
+uint32_t GpuZoneProfiler::EndZone(GpuZoneStack* zoneStack)
+{
+    assert(zoneStack->Depth > 0);
+    zoneStack->Depth--;
+
+    if (zoneStack->Depth >= GpuZoneMaxDepth)
+    {
+        return GpuZoneInvalidIndex;
+    }
+
+    auto zoneIndex = zoneStack->ZoneIndices[zoneStack->Depth];
+
+    if (zoneIndex != GpuZoneInvalidIndex)
+    {
+        this->zoneRecords[zoneIndex].IsEnded = true;
+    }
+
+    return zoneIndex;
+}
+
+uint32_t GpuZoneProfiler::GetStartQueryIndex(uint32_t zoneIndex) const
+{
+    return zoneIndex * 2;
+}
+
+uint32_t GpuZoneProfiler::GetEndQueryIndex(uint32_t zoneIndex) const
+{
+    return zoneIndex * 2 + 1;
+}
+
+uint32_t GpuZoneProfiler::GetNextFrameIndex() const
+{
+    return (this->currentFrameIndex + 1) % this->frameCount;
+}
+
+int GpuZoneProfiler::ResolveZones(const uint64_t* frameTimestamps, GraphicsGpuZone* gpuZones, int gpuZonesLength)
+{
+    auto frameIndex = GetNextFrameIndex();
+    auto zoneCount = GetFrameZoneCount(frameIndex);
+    auto firstZoneIndex = frameIndex * GpuZoneMaxCountPerFrame;
+    int resolvedZoneCount = 0;
+
+    for (uint32_t i = 0; i < zoneCount && resolvedZoneCount < gpuZonesLength; i++)
+    {
+        auto& zoneRecord = this->zoneRecords[firstZoneIndex + i];
+        auto startTimestamp = frameTimestamps[i * 2];
+        auto endTimestamp = frameTimestamps[i * 2 + 1];
+
+        if (!zoneRecord.IsEnded || startTimestamp == 0 || endTimestamp < startTimestamp)
+        {
+            continue;
+        }
+
+        auto& gpuZone = gpuZones[resolvedZoneCount++];
+        gpuZone.NameId = zoneRecord.NameId;
+        gpuZone.Depth = zoneRecord.Depth;
+        gpuZone.StartTimestamp = startTimestamp;
+        gpuZone.EndTimestamp = endTimestamp;
+    }
+
+    this->frameZoneCounts[frameIndex] = 0;
+    this->currentFrameIndex = frameIndex;
+
+    return resolvedZoneCount;
+}
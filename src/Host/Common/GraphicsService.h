@@ -5,7 +5,8 @@ enum GraphicsServiceHeapType : int
 {
     Gpu, 
     Upload, 
-    ReadBack
+    ReadBack, 
+    GpuUpload
 };
 
 enum GraphicsServiceCommandType : int
@@ -73,6 +74,13 @@ enum GraphicsQueryBufferType : int
     GraphicsPipelineStats
 };
 
+enum GraphicsPresentMode : int
+{
+    Fifo, 
+    Mailbox, 
+    Immediate
+};
+
 enum GraphicsPrimitiveType : int
 {
     Triangle, 
@@ -92,6 +100,27 @@ struct GraphicsAllocationInfos
     int Alignment;
 };
 
+struct GraphicsMemoryBudget
+{
+    unsigned long BudgetInBytes;
+    unsigned long UsageInBytes;
+};
+
+struct GraphicsGpuZone
+{
+    unsigned int NameId;
+    unsigned int Depth;
+    unsigned long StartTimestamp;
+    unsigned long EndTimestamp;
+};
+
+struct GraphicsTimestampCalibration
+{
+    unsigned long GpuTimestamp;
+    unsigned long CpuTimestamp;
+    unsigned long MaxDeviation;
+};
+
 struct NullableGraphicsAllocationInfos
 {
     int HasValue;
@@ -110,6 +139,25 @@ struct NullableGraphicsFence
     struct GraphicsFence Value;
 };
 
+struct GraphicsCommandListBatch
+{
+    void* CommandQueuePointer;
+    void** CommandLists;
+    int CommandListsLength;
+    struct GraphicsFence* FencesToWait;
+    int FencesToWaitLength;
+    int BatchIndexToWait;
+};
+
+struct GraphicsShaderResourceWrite
+{
+    unsigned int Index;
+    void* ResourcePointer;
+    int IsTexture;
+    int IsWriteable;
+    unsigned int MipLevel;
+};
+
 struct GraphicsRenderPassDescriptor
 {
     int IsRenderShader;
@@ -143,14 +191,18 @@ struct NullableGraphicsRenderPassDescriptor
 };
 
 typedef void (*GraphicsService_GetGraphicsAdapterNamePtr)(void* context, char* output);
+typedef int (*GraphicsService_SetFramesInFlightCountPtr)(void* context, int framesInFlightCount);
 typedef struct GraphicsAllocationInfos (*GraphicsService_GetBufferAllocationInfosPtr)(void* context, int sizeInBytes);
 typedef struct GraphicsAllocationInfos (*GraphicsService_GetTextureAllocationInfosPtr)(void* context, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+typedef struct GraphicsMemoryBudget (*GraphicsService_GetMemoryBudgetPtr)(void* context, enum GraphicsServiceHeapType heapType);
 typedef void* (*GraphicsService_CreateCommandQueuePtr)(void* context, enum GraphicsServiceCommandType commandQueueType);
 typedef void (*GraphicsService_SetCommandQueueLabelPtr)(void* context, void* commandQueuePointer, char* label);
 typedef void (*GraphicsService_DeleteCommandQueuePtr)(void* context, void* commandQueuePointer);
 typedef void (*GraphicsService_ResetCommandQueuePtr)(void* context, void* commandQueuePointer);
 typedef unsigned long (*GraphicsService_GetCommandQueueTimestampFrequencyPtr)(void* context, void* commandQueuePointer);
+typedef struct GraphicsTimestampCalibration (*GraphicsService_GetCommandQueueTimestampCalibrationPtr)(void* context, void* commandQueuePointer);
 typedef unsigned long (*GraphicsService_ExecuteCommandListsPtr)(void* context, void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength);
+typedef void (*GraphicsService_ExecuteCommandListBatchesPtr)(void* context, struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength);
 typedef void (*GraphicsService_WaitForCommandQueueOnCpuPtr)(void* context, struct GraphicsFence fenceToWait);
 typedef void* (*GraphicsService_CreateCommandListPtr)(void* context, void* commandQueuePointer);
 typedef void (*GraphicsService_SetCommandListLabelPtr)(void* context, void* commandListPointer, char* label);
@@ -161,12 +213,15 @@ typedef void* (*GraphicsService_CreateGraphicsHeapPtr)(void* context, enum Graph
 typedef void (*GraphicsService_SetGraphicsHeapLabelPtr)(void* context, void* graphicsHeapPointer, char* label);
 typedef void (*GraphicsService_DeleteGraphicsHeapPtr)(void* context, void* graphicsHeapPointer);
 typedef void* (*GraphicsService_CreateShaderResourceHeapPtr)(void* context, unsigned long length);
+typedef unsigned long (*GraphicsService_GetShaderResourceHeapLengthPtr)(void* context, void* shaderResourceHeapPointer);
+typedef void (*GraphicsService_ResizeShaderResourceHeapPtr)(void* context, void* shaderResourceHeapPointer, unsigned long length);
 typedef void (*GraphicsService_SetShaderResourceHeapLabelPtr)(void* context, void* shaderResourceHeapPointer, char* label);
 typedef void (*GraphicsService_DeleteShaderResourceHeapPtr)(void* context, void* shaderResourceHeapPointer);
 typedef void (*GraphicsService_CreateShaderResourceTexturePtr)(void* context, void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel);
 typedef void (*GraphicsService_DeleteShaderResourceTexturePtr)(void* context, void* shaderResourceHeapPointer, unsigned int index);
 typedef void (*GraphicsService_CreateShaderResourceBufferPtr)(void* context, void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable);
 typedef void (*GraphicsService_DeleteShaderResourceBufferPtr)(void* context, void* shaderResourceHeapPointer, unsigned int index);
+typedef void (*GraphicsService_CreateShaderResourcesPtr)(void* context, void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength);
 typedef void* (*GraphicsService_CreateGraphicsBufferPtr)(void* context, void* graphicsHeapPointer, unsigned long heapOffset, enum GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes);
 typedef void (*GraphicsService_SetGraphicsBufferLabelPtr)(void* context, void* graphicsBufferPointer, char* label);
 typedef void (*GraphicsService_DeleteGraphicsBufferPtr)(void* context, void* graphicsBufferPointer);
@@ -175,7 +230,7 @@ typedef void (*GraphicsService_ReleaseGraphicsBufferCpuPointerPtr)(void* context
 typedef void* (*GraphicsService_CreateTexturePtr)(void* context, void* graphicsHeapPointer, unsigned long heapOffset, int isAliasable, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
 typedef void (*GraphicsService_SetTextureLabelPtr)(void* context, void* texturePointer, char* label);
 typedef void (*GraphicsService_DeleteTexturePtr)(void* context, void* texturePointer);
-typedef void* (*GraphicsService_CreateSwapChainPtr)(void* context, void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat);
+typedef void* (*GraphicsService_CreateSwapChainPtr)(void* context, void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount);
 typedef void (*GraphicsService_DeleteSwapChainPtr)(void* context, void* swapChainPointer);
 typedef void (*GraphicsService_ResizeSwapChainPtr)(void* context, void* swapChainPointer, int width, int height);
 typedef void* (*GraphicsService_GetSwapChainBackBufferTexturePtr)(void* context, void* swapChainPointer);
@@ -186,10 +241,15 @@ typedef void (*GraphicsService_ResetQueryBufferPtr)(void* context, void* queryBu
 typedef void (*GraphicsService_SetQueryBufferLabelPtr)(void* context, void* queryBufferPointer, char* label);
 typedef void (*GraphicsService_DeleteQueryBufferPtr)(void* context, void* queryBufferPointer);
 typedef void* (*GraphicsService_CreateShaderPtr)(void* context, char* computeShaderFunction, void* shaderByteCode, int shaderByteCodeLength);
+typedef void* (*GraphicsService_CreateShaderFromArchivePtr)(void* context, void* shaderArchivePointer, char* shaderName);
 typedef void (*GraphicsService_SetShaderLabelPtr)(void* context, void* shaderPointer, char* label);
 typedef void (*GraphicsService_DeleteShaderPtr)(void* context, void* shaderPointer);
+typedef void* (*GraphicsService_OpenShaderArchivePtr)(void* context, char* path);
+typedef void (*GraphicsService_CloseShaderArchivePtr)(void* context, void* shaderArchivePointer);
 typedef void* (*GraphicsService_CreateComputePipelineStatePtr)(void* context, void* shaderPointer);
 typedef void* (*GraphicsService_CreatePipelineStatePtr)(void* context, void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor);
+typedef void* (*GraphicsService_CreatePipelineStateAsyncPtr)(void* context, void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState);
+typedef int (*GraphicsService_IsPipelineStateReadyPtr)(void* context, void* pipelineStatePointer, int waitForCompletion);
 typedef void (*GraphicsService_SetPipelineStateLabelPtr)(void* context, void* pipelineStatePointer, char* label);
 typedef void (*GraphicsService_DeletePipelineStatePtr)(void* context, void* pipelineStatePointer);
 typedef void (*GraphicsService_CopyDataToGraphicsBufferPtr)(void* context, void* commandListPointer, void* destinationGraphicsBufferPointer, void* sourceGraphicsBufferPointer, unsigned int sizeInBytes, unsigned int destinationOffsetInBytes, unsigned int sourceOffsetInBytes);
@@ -210,19 +270,26 @@ typedef void (*GraphicsService_ExecuteIndirectPtr)(void* context, void* commandL
 typedef void (*GraphicsService_BeginQueryPtr)(void* context, void* commandListPointer, void* queryBufferPointer, int index);
 typedef void (*GraphicsService_EndQueryPtr)(void* context, void* commandListPointer, void* queryBufferPointer, int index);
 typedef void (*GraphicsService_ResolveQueryDataPtr)(void* context, void* commandListPointer, void* queryBufferPointer, void* destinationBufferPointer, int startIndex, int endIndex);
+typedef void (*GraphicsService_BeginGpuZonePtr)(void* context, void* commandListPointer, unsigned int nameId, char* name);
+typedef void (*GraphicsService_EndGpuZonePtr)(void* context, void* commandListPointer);
+typedef int (*GraphicsService_ResolveGpuZonesPtr)(void* context, struct GraphicsGpuZone* gpuZones, int gpuZonesLength);
 
 struct GraphicsService
 {
     void* Context;
     GraphicsService_GetGraphicsAdapterNamePtr GraphicsService_GetGraphicsAdapterName;
+    GraphicsService_SetFramesInFlightCountPtr GraphicsService_SetFramesInFlightCount;
     GraphicsService_GetBufferAllocationInfosPtr GraphicsService_GetBufferAllocationInfos;
     GraphicsService_GetTextureAllocationInfosPtr GraphicsService_GetTextureAllocationInfos;
+    GraphicsService_GetMemoryBudgetPtr GraphicsService_GetMemoryBudget;
     GraphicsService_CreateCommandQueuePtr GraphicsService_CreateCommandQueue;
     GraphicsService_SetCommandQueueLabelPtr GraphicsService_SetCommandQueueLabel;
     GraphicsService_DeleteCommandQueuePtr GraphicsService_DeleteCommandQueue;
     GraphicsService_ResetCommandQueuePtr GraphicsService_ResetCommandQueue;
     GraphicsService_GetCommandQueueTimestampFrequencyPtr GraphicsService_GetCommandQueueTimestampFrequency;
+    GraphicsService_GetCommandQueueTimestampCalibrationPtr GraphicsService_GetCommandQueueTimestampCalibration;
     GraphicsService_ExecuteCommandListsPtr GraphicsService_ExecuteCommandLists;
+    GraphicsService_ExecuteCommandListBatchesPtr GraphicsService_ExecuteCommandListBatches;
     GraphicsService_WaitForCommandQueueOnCpuPtr GraphicsService_WaitForCommandQueueOnCpu;
     GraphicsService_CreateCommandListPtr GraphicsService_CreateCommandList;
     GraphicsService_SetCommandListLabelPtr GraphicsService_SetCommandListLabel;
@@ -233,12 +300,15 @@ struct GraphicsService
     GraphicsService_SetGraphicsHeapLabelPtr GraphicsService_SetGraphicsHeapLabel;
     GraphicsService_DeleteGraphicsHeapPtr GraphicsService_DeleteGraphicsHeap;
     GraphicsService_CreateShaderResourceHeapPtr GraphicsService_CreateShaderResourceHeap;
+    GraphicsService_GetShaderResourceHeapLengthPtr GraphicsService_GetShaderResourceHeapLength;
+    GraphicsService_ResizeShaderResourceHeapPtr GraphicsService_ResizeShaderResourceHeap;
     GraphicsService_SetShaderResourceHeapLabelPtr GraphicsService_SetShaderResourceHeapLabel;
     GraphicsService_DeleteShaderResourceHeapPtr GraphicsService_DeleteShaderResourceHeap;
     GraphicsService_CreateShaderResourceTexturePtr GraphicsService_CreateShaderResourceTexture;
     GraphicsService_DeleteShaderResourceTexturePtr GraphicsService_DeleteShaderResourceTexture;
     GraphicsService_CreateShaderResourceBufferPtr GraphicsService_CreateShaderResourceBuffer;
     GraphicsService_DeleteShaderResourceBufferPtr GraphicsService_DeleteShaderResourceBuffer;
+    GraphicsService_CreateShaderResourcesPtr GraphicsService_CreateShaderResources;
     GraphicsService_CreateGraphicsBufferPtr GraphicsService_CreateGraphicsBuffer;
     GraphicsService_SetGraphicsBufferLabelPtr GraphicsService_SetGraphicsBufferLabel;
     GraphicsService_DeleteGraphicsBufferPtr GraphicsService_DeleteGraphicsBuffer;
@@ -258,10 +328,15 @@ struct GraphicsService
     GraphicsService_SetQueryBufferLabelPtr GraphicsService_SetQueryBufferLabel;
     GraphicsService_DeleteQueryBufferPtr GraphicsService_DeleteQueryBuffer;
     GraphicsService_CreateShaderPtr GraphicsService_CreateShader;
+    GraphicsService_CreateShaderFromArchivePtr GraphicsService_CreateShaderFromArchive;
     GraphicsService_SetShaderLabelPtr GraphicsService_SetShaderLabel;
     GraphicsService_DeleteShaderPtr GraphicsService_DeleteShader;
+    GraphicsService_OpenShaderArchivePtr GraphicsService_OpenShaderArchive;
+    GraphicsService_CloseShaderArchivePtr GraphicsService_CloseShaderArchive;
     GraphicsService_CreateComputePipelineStatePtr GraphicsService_CreateComputePipelineState;
     GraphicsService_CreatePipelineStatePtr GraphicsService_CreatePipelineState;
+    GraphicsService_CreatePipelineStateAsyncPtr GraphicsService_CreatePipelineStateAsync;
+    GraphicsService_IsPipelineStateReadyPtr GraphicsService_IsPipelineStateReady;
     GraphicsService_SetPipelineStateLabelPtr GraphicsService_SetPipelineStateLabel;
     GraphicsService_DeletePipelineStatePtr GraphicsService_DeletePipelineState;
     GraphicsService_CopyDataToGraphicsBufferPtr GraphicsService_CopyDataToGraphicsBuffer;
@@ -282,4 +357,7 @@ struct GraphicsService
     GraphicsService_BeginQueryPtr GraphicsService_BeginQuery;
     GraphicsService_EndQueryPtr GraphicsService_EndQuery;
     GraphicsService_ResolveQueryDataPtr GraphicsService_ResolveQueryData;
+    GraphicsService_BeginGpuZonePtr GraphicsService_BeginGpuZone;
+    GraphicsService_EndGpuZonePtr GraphicsService_EndGpuZone;
+    GraphicsService_ResolveGpuZonesPtr GraphicsService_ResolveGpuZones;
 };
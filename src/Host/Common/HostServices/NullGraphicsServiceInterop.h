@@ -0,0 +1,588 @@
+#pragma once
+#include "../NullGraphicsService.h"
+
+void NullGraphicsServiceGetGraphicsAdapterNameInterop(void* context, char* output)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->GetGraphicsAdapterName(output);
+}
+
+int NullGraphicsServiceSetFramesInFlightCountInterop(void* context, int framesInFlightCount)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->SetFramesInFlightCount(framesInFlightCount);
+}
+
+struct GraphicsAllocationInfos NullGraphicsServiceGetBufferAllocationInfosInterop(void* context, int sizeInBytes)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetBufferAllocationInfos(sizeInBytes);
+}
+
+struct GraphicsAllocationInfos NullGraphicsServiceGetTextureAllocationInfosInterop(void* context, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetTextureAllocationInfos(textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
+}
+
+struct GraphicsMemoryBudget NullGraphicsServiceGetMemoryBudgetInterop(void* context, enum GraphicsServiceHeapType heapType)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetMemoryBudget(heapType);
+}
+
+void* NullGraphicsServiceCreateCommandQueueInterop(void* context, enum GraphicsServiceCommandType commandQueueType)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateCommandQueue(commandQueueType);
+}
+
+void NullGraphicsServiceSetCommandQueueLabelInterop(void* context, void* commandQueuePointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetCommandQueueLabel(commandQueuePointer, label);
+}
+
+void NullGraphicsServiceDeleteCommandQueueInterop(void* context, void* commandQueuePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteCommandQueue(commandQueuePointer);
+}
+
+void NullGraphicsServiceResetCommandQueueInterop(void* context, void* commandQueuePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ResetCommandQueue(commandQueuePointer);
+}
+
+unsigned long NullGraphicsServiceGetCommandQueueTimestampFrequencyInterop(void* context, void* commandQueuePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetCommandQueueTimestampFrequency(commandQueuePointer);
+}
+
+struct GraphicsTimestampCalibration NullGraphicsServiceGetCommandQueueTimestampCalibrationInterop(void* context, void* commandQueuePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetCommandQueueTimestampCalibration(commandQueuePointer);
+}
+
+unsigned long NullGraphicsServiceExecuteCommandListsInterop(void* context, void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->ExecuteCommandLists(commandQueuePointer, commandLists, commandListsLength, fencesToWait, fencesToWaitLength);
+}
+
+void NullGraphicsServiceExecuteCommandListBatchesInterop(void* context, struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ExecuteCommandListBatches(batches, batchesLength, fences, fencesLength);
+}
+
+void NullGraphicsServiceWaitForCommandQueueOnCpuInterop(void* context, struct GraphicsFence fenceToWait)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->WaitForCommandQueueOnCpu(fenceToWait);
+}
+
+void* NullGraphicsServiceCreateCommandListInterop(void* context, void* commandQueuePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateCommandList(commandQueuePointer);
+}
+
+void NullGraphicsServiceSetCommandListLabelInterop(void* context, void* commandListPointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetCommandListLabel(commandListPointer, label);
+}
+
+void NullGraphicsServiceDeleteCommandListInterop(void* context, void* commandListPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteCommandList(commandListPointer);
+}
+
+void NullGraphicsServiceResetCommandListInterop(void* context, void* commandListPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ResetCommandList(commandListPointer);
+}
+
+void NullGraphicsServiceCommitCommandListInterop(void* context, void* commandListPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CommitCommandList(commandListPointer);
+}
+
+void* NullGraphicsServiceCreateGraphicsHeapInterop(void* context, enum GraphicsServiceHeapType type, unsigned long sizeInBytes)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateGraphicsHeap(type, sizeInBytes);
+}
+
+void NullGraphicsServiceSetGraphicsHeapLabelInterop(void* context, void* graphicsHeapPointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetGraphicsHeapLabel(graphicsHeapPointer, label);
+}
+
+void NullGraphicsServiceDeleteGraphicsHeapInterop(void* context, void* graphicsHeapPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteGraphicsHeap(graphicsHeapPointer);
+}
+
+void* NullGraphicsServiceCreateShaderResourceHeapInterop(void* context, unsigned long length)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateShaderResourceHeap(length);
+}
+
+unsigned long NullGraphicsServiceGetShaderResourceHeapLengthInterop(void* context, void* shaderResourceHeapPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetShaderResourceHeapLength(shaderResourceHeapPointer);
+}
+
+void NullGraphicsServiceResizeShaderResourceHeapInterop(void* context, void* shaderResourceHeapPointer, unsigned long length)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ResizeShaderResourceHeap(shaderResourceHeapPointer, length);
+}
+
+void NullGraphicsServiceSetShaderResourceHeapLabelInterop(void* context, void* shaderResourceHeapPointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetShaderResourceHeapLabel(shaderResourceHeapPointer, label);
+}
+
+void NullGraphicsServiceDeleteShaderResourceHeapInterop(void* context, void* shaderResourceHeapPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteShaderResourceHeap(shaderResourceHeapPointer);
+}
+
+void NullGraphicsServiceCreateShaderResourceTextureInterop(void* context, void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CreateShaderResourceTexture(shaderResourceHeapPointer, index, texturePointer, isWriteable, mipLevel);
+}
+
+void NullGraphicsServiceDeleteShaderResourceTextureInterop(void* context, void* shaderResourceHeapPointer, unsigned int index)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteShaderResourceTexture(shaderResourceHeapPointer, index);
+}
+
+void NullGraphicsServiceCreateShaderResourceBufferInterop(void* context, void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CreateShaderResourceBuffer(shaderResourceHeapPointer, index, bufferPointer, isWriteable);
+}
+
+void NullGraphicsServiceDeleteShaderResourceBufferInterop(void* context, void* shaderResourceHeapPointer, unsigned int index)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteShaderResourceBuffer(shaderResourceHeapPointer, index);
+}
+
+void NullGraphicsServiceCreateShaderResourcesInterop(void* context, void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CreateShaderResources(shaderResourceHeapPointer, writes, writesLength);
+}
+
+void* NullGraphicsServiceCreateGraphicsBufferInterop(void* context, void* graphicsHeapPointer, unsigned long heapOffset, enum GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateGraphicsBuffer(graphicsHeapPointer, heapOffset, graphicsBufferUsage, sizeInBytes);
+}
+
+void NullGraphicsServiceSetGraphicsBufferLabelInterop(void* context, void* graphicsBufferPointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetGraphicsBufferLabel(graphicsBufferPointer, label);
+}
+
+void NullGraphicsServiceDeleteGraphicsBufferInterop(void* context, void* graphicsBufferPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteGraphicsBuffer(graphicsBufferPointer);
+}
+
+void* NullGraphicsServiceGetGraphicsBufferCpuPointerInterop(void* context, void* graphicsBufferPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetGraphicsBufferCpuPointer(graphicsBufferPointer);
+}
+
+void NullGraphicsServiceReleaseGraphicsBufferCpuPointerInterop(void* context, void* graphicsBufferPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ReleaseGraphicsBufferCpuPointer(graphicsBufferPointer);
+}
+
+void* NullGraphicsServiceCreateTextureInterop(void* context, void* graphicsHeapPointer, unsigned long heapOffset, int isAliasable, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateTexture(graphicsHeapPointer, heapOffset, isAliasable, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
+}
+
+void NullGraphicsServiceSetTextureLabelInterop(void* context, void* texturePointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetTextureLabel(texturePointer, label);
+}
+
+void NullGraphicsServiceDeleteTextureInterop(void* context, void* texturePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteTexture(texturePointer);
+}
+
+void* NullGraphicsServiceCreateSwapChainInterop(void* context, void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateSwapChain(windowPointer, commandQueuePointer, width, height, textureFormat, presentMode, backBufferCount);
+}
+
+void NullGraphicsServiceDeleteSwapChainInterop(void* context, void* swapChainPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteSwapChain(swapChainPointer);
+}
+
+void NullGraphicsServiceResizeSwapChainInterop(void* context, void* swapChainPointer, int width, int height)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ResizeSwapChain(swapChainPointer, width, height);
+}
+
+void* NullGraphicsServiceGetSwapChainBackBufferTextureInterop(void* context, void* swapChainPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->GetSwapChainBackBufferTexture(swapChainPointer);
+}
+
+unsigned long NullGraphicsServicePresentSwapChainInterop(void* context, void* swapChainPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->PresentSwapChain(swapChainPointer);
+}
+
+void NullGraphicsServiceWaitForSwapChainOnCpuInterop(void* context, void* swapChainPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->WaitForSwapChainOnCpu(swapChainPointer);
+}
+
+void* NullGraphicsServiceCreateQueryBufferInterop(void* context, enum GraphicsQueryBufferType queryBufferType, int length)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateQueryBuffer(queryBufferType, length);
+}
+
+void NullGraphicsServiceResetQueryBufferInterop(void* context, void* queryBufferPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ResetQueryBuffer(queryBufferPointer);
+}
+
+void NullGraphicsServiceSetQueryBufferLabelInterop(void* context, void* queryBufferPointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetQueryBufferLabel(queryBufferPointer, label);
+}
+
+void NullGraphicsServiceDeleteQueryBufferInterop(void* context, void* queryBufferPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteQueryBuffer(queryBufferPointer);
+}
+
+void* NullGraphicsServiceCreateShaderInterop(void* context, char* computeShaderFunction, void* shaderByteCode, int shaderByteCodeLength)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateShader(computeShaderFunction, shaderByteCode, shaderByteCodeLength);
+}
+
+void* NullGraphicsServiceCreateShaderFromArchiveInterop(void* context, void* shaderArchivePointer, char* shaderName)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateShaderFromArchive(shaderArchivePointer, shaderName);
+}
+
+void NullGraphicsServiceSetShaderLabelInterop(void* context, void* shaderPointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetShaderLabel(shaderPointer, label);
+}
+
+void NullGraphicsServiceDeleteShaderInterop(void* context, void* shaderPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeleteShader(shaderPointer);
+}
+
+void* NullGraphicsServiceOpenShaderArchiveInterop(void* context, char* path)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->OpenShaderArchive(path);
+}
+
+void NullGraphicsServiceCloseShaderArchiveInterop(void* context, void* shaderArchivePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CloseShaderArchive(shaderArchivePointer);
+}
+
+void* NullGraphicsServiceCreateComputePipelineStateInterop(void* context, void* shaderPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreateComputePipelineState(shaderPointer);
+}
+
+void* NullGraphicsServiceCreatePipelineStateInterop(void* context, void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreatePipelineState(shaderPointer, renderPassDescriptor);
+}
+
+void* NullGraphicsServiceCreatePipelineStateAsyncInterop(void* context, void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->CreatePipelineStateAsync(shaderPointer, renderPassDescriptor, isComputePipelineState);
+}
+
+int NullGraphicsServiceIsPipelineStateReadyInterop(void* context, void* pipelineStatePointer, int waitForCompletion)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->IsPipelineStateReady(pipelineStatePointer, waitForCompletion);
+}
+
+void NullGraphicsServiceSetPipelineStateLabelInterop(void* context, void* pipelineStatePointer, char* label)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetPipelineStateLabel(pipelineStatePointer, label);
+}
+
+void NullGraphicsServiceDeletePipelineStateInterop(void* context, void* pipelineStatePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DeletePipelineState(pipelineStatePointer);
+}
+
+void NullGraphicsServiceCopyDataToGraphicsBufferInterop(void* context, void* commandListPointer, void* destinationGraphicsBufferPointer, void* sourceGraphicsBufferPointer, unsigned int sizeInBytes, unsigned int destinationOffsetInBytes, unsigned int sourceOffsetInBytes)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CopyDataToGraphicsBuffer(commandListPointer, destinationGraphicsBufferPointer, sourceGraphicsBufferPointer, sizeInBytes, destinationOffsetInBytes, sourceOffsetInBytes);
+}
+
+void NullGraphicsServiceCopyDataToTextureInterop(void* context, void* commandListPointer, void* destinationTexturePointer, void* sourceGraphicsBufferPointer, enum GraphicsTextureFormat textureFormat, int width, int height, int slice, int mipLevel)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CopyDataToTexture(commandListPointer, destinationTexturePointer, sourceGraphicsBufferPointer, textureFormat, width, height, slice, mipLevel);
+}
+
+void NullGraphicsServiceCopyTextureInterop(void* context, void* commandListPointer, void* destinationTexturePointer, void* sourceTexturePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->CopyTexture(commandListPointer, destinationTexturePointer, sourceTexturePointer);
+}
+
+void NullGraphicsServiceTransitionGraphicsBufferToStateInterop(void* context, void* commandListPointer, void* graphicsBufferPointer, enum GraphicsResourceState resourceState)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->TransitionGraphicsBufferToState(commandListPointer, graphicsBufferPointer, resourceState);
+}
+
+void NullGraphicsServiceDispatchThreadsInterop(void* context, void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DispatchThreads(commandListPointer, threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+}
+
+void NullGraphicsServiceBeginRenderPassInterop(void* context, void* commandListPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->BeginRenderPass(commandListPointer, renderPassDescriptor);
+}
+
+void NullGraphicsServiceEndRenderPassInterop(void* context, void* commandListPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->EndRenderPass(commandListPointer);
+}
+
+void NullGraphicsServiceSetPipelineStateInterop(void* context, void* commandListPointer, void* pipelineStatePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetPipelineState(commandListPointer, pipelineStatePointer);
+}
+
+void NullGraphicsServiceSetTextureBarrierInterop(void* context, void* commandListPointer, void* texturePointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetTextureBarrier(commandListPointer, texturePointer);
+}
+
+void NullGraphicsServiceSetGraphicsBufferBarrierInterop(void* context, void* commandListPointer, void* graphicsBufferPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetGraphicsBufferBarrier(commandListPointer, graphicsBufferPointer);
+}
+
+void NullGraphicsServiceSetShaderResourceHeapInterop(void* context, void* commandListPointer, void* shaderResourceHeapPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetShaderResourceHeap(commandListPointer, shaderResourceHeapPointer);
+}
+
+void NullGraphicsServiceSetShaderInterop(void* context, void* commandListPointer, void* shaderPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetShader(commandListPointer, shaderPointer);
+}
+
+void NullGraphicsServiceSetShaderParameterValuesInterop(void* context, void* commandListPointer, unsigned int slot, unsigned int* values, int valuesLength)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->SetShaderParameterValues(commandListPointer, slot, values, valuesLength);
+}
+
+void NullGraphicsServiceDispatchMeshInterop(void* context, void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->DispatchMesh(commandListPointer, threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+}
+
+void NullGraphicsServiceExecuteIndirectInterop(void* context, void* commandListPointer, unsigned int maxCommandCount, void* commandGraphicsBufferPointer, unsigned int commandBufferOffset)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ExecuteIndirect(commandListPointer, maxCommandCount, commandGraphicsBufferPointer, commandBufferOffset);
+}
+
+void NullGraphicsServiceBeginQueryInterop(void* context, void* commandListPointer, void* queryBufferPointer, int index)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->BeginQuery(commandListPointer, queryBufferPointer, index);
+}
+
+void NullGraphicsServiceEndQueryInterop(void* context, void* commandListPointer, void* queryBufferPointer, int index)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->EndQuery(commandListPointer, queryBufferPointer, index);
+}
+
+void NullGraphicsServiceResolveQueryDataInterop(void* context, void* commandListPointer, void* queryBufferPointer, void* destinationBufferPointer, int startIndex, int endIndex)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->ResolveQueryData(commandListPointer, queryBufferPointer, destinationBufferPointer, startIndex, endIndex);
+}
+
+void NullGraphicsServiceBeginGpuZoneInterop(void* context, void* commandListPointer, unsigned int nameId, char* name)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->BeginGpuZone(commandListPointer, nameId, name);
+}
+
+void NullGraphicsServiceEndGpuZoneInterop(void* context, void* commandListPointer)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    contextObject->EndGpuZone(commandListPointer);
+}
+
+int NullGraphicsServiceResolveGpuZonesInterop(void* context, struct GraphicsGpuZone* gpuZones, int gpuZonesLength)
+{
+    auto contextObject = (NullGraphicsService*)context;
+    return contextObject->ResolveGpuZones(gpuZones, gpuZonesLength);
+}
+
+void InitNullGraphicsService(const NullGraphicsService* context, GraphicsService* service)
+{
+    service->Context = (void*)context;
+    service->GraphicsService_GetGraphicsAdapterName = NullGraphicsServiceGetGraphicsAdapterNameInterop;
+    service->GraphicsService_SetFramesInFlightCount = NullGraphicsServiceSetFramesInFlightCountInterop;
+    service->GraphicsService_GetBufferAllocationInfos = NullGraphicsServiceGetBufferAllocationInfosInterop;
+    service->GraphicsService_GetTextureAllocationInfos = NullGraphicsServiceGetTextureAllocationInfosInterop;
+    service->GraphicsService_GetMemoryBudget = NullGraphicsServiceGetMemoryBudgetInterop;
+    service->GraphicsService_CreateCommandQueue = NullGraphicsServiceCreateCommandQueueInterop;
+    service->GraphicsService_SetCommandQueueLabel = NullGraphicsServiceSetCommandQueueLabelInterop;
+    service->GraphicsService_DeleteCommandQueue = NullGraphicsServiceDeleteCommandQueueInterop;
+    service->GraphicsService_ResetCommandQueue = NullGraphicsServiceResetCommandQueueInterop;
+    service->GraphicsService_GetCommandQueueTimestampFrequency = NullGraphicsServiceGetCommandQueueTimestampFrequencyInterop;
+    service->GraphicsService_GetCommandQueueTimestampCalibration = NullGraphicsServiceGetCommandQueueTimestampCalibrationInterop;
+    service->GraphicsService_ExecuteCommandLists = NullGraphicsServiceExecuteCommandListsInterop;
+    service->GraphicsService_ExecuteCommandListBatches = NullGraphicsServiceExecuteCommandListBatchesInterop;
+    service->GraphicsService_WaitForCommandQueueOnCpu = NullGraphicsServiceWaitForCommandQueueOnCpuInterop;
+    service->GraphicsService_CreateCommandList = NullGraphicsServiceCreateCommandListInterop;
+    service->GraphicsService_SetCommandListLabel = NullGraphicsServiceSetCommandListLabelInterop;
+    service->GraphicsService_DeleteCommandList = NullGraphicsServiceDeleteCommandListInterop;
+    service->GraphicsService_ResetCommandList = NullGraphicsServiceResetCommandListInterop;
+    service->GraphicsService_CommitCommandList = NullGraphicsServiceCommitCommandListInterop;
+    service->GraphicsService_CreateGraphicsHeap = NullGraphicsServiceCreateGraphicsHeapInterop;
+    service->GraphicsService_SetGraphicsHeapLabel = NullGraphicsServiceSetGraphicsHeapLabelInterop;
+    service->GraphicsService_DeleteGraphicsHeap = NullGraphicsServiceDeleteGraphicsHeapInterop;
+    service->GraphicsService_CreateShaderResourceHeap = NullGraphicsServiceCreateShaderResourceHeapInterop;
+    service->GraphicsService_GetShaderResourceHeapLength = NullGraphicsServiceGetShaderResourceHeapLengthInterop;
+    service->GraphicsService_ResizeShaderResourceHeap = NullGraphicsServiceResizeShaderResourceHeapInterop;
+    service->GraphicsService_SetShaderResourceHeapLabel = NullGraphicsServiceSetShaderResourceHeapLabelInterop;
+    service->GraphicsService_DeleteShaderResourceHeap = NullGraphicsServiceDeleteShaderResourceHeapInterop;
+    service->GraphicsService_CreateShaderResourceTexture = NullGraphicsServiceCreateShaderResourceTextureInterop;
+    service->GraphicsService_DeleteShaderResourceTexture = NullGraphicsServiceDeleteShaderResourceTextureInterop;
+    service->GraphicsService_CreateShaderResourceBuffer = NullGraphicsServiceCreateShaderResourceBufferInterop;
+    service->GraphicsService_DeleteShaderResourceBuffer = NullGraphicsServiceDeleteShaderResourceBufferInterop;
+    service->GraphicsService_CreateShaderResources = NullGraphicsServiceCreateShaderResourcesInterop;
+    service->GraphicsService_CreateGraphicsBuffer = NullGraphicsServiceCreateGraphicsBufferInterop;
+    service->GraphicsService_SetGraphicsBufferLabel = NullGraphicsServiceSetGraphicsBufferLabelInterop;
+    service->GraphicsService_DeleteGraphicsBuffer = NullGraphicsServiceDeleteGraphicsBufferInterop;
+    service->GraphicsService_GetGraphicsBufferCpuPointer = NullGraphicsServiceGetGraphicsBufferCpuPointerInterop;
+    service->GraphicsService_ReleaseGraphicsBufferCpuPointer = NullGraphicsServiceReleaseGraphicsBufferCpuPointerInterop;
+    service->GraphicsService_CreateTexture = NullGraphicsServiceCreateTextureInterop;
+    service->GraphicsService_SetTextureLabel = NullGraphicsServiceSetTextureLabelInterop;
+    service->GraphicsService_DeleteTexture = NullGraphicsServiceDeleteTextureInterop;
+    service->GraphicsService_CreateSwapChain = NullGraphicsServiceCreateSwapChainInterop;
+    service->GraphicsService_DeleteSwapChain = NullGraphicsServiceDeleteSwapChainInterop;
+    service->GraphicsService_ResizeSwapChain = NullGraphicsServiceResizeSwapChainInterop;
+    service->GraphicsService_GetSwapChainBackBufferTexture = NullGraphicsServiceGetSwapChainBackBufferTextureInterop;
+    service->GraphicsService_PresentSwapChain = NullGraphicsServicePresentSwapChainInterop;
+    service->GraphicsService_WaitForSwapChainOnCpu = NullGraphicsServiceWaitForSwapChainOnCpuInterop;
+    service->GraphicsService_CreateQueryBuffer = NullGraphicsServiceCreateQueryBufferInterop;
+    service->GraphicsService_ResetQueryBuffer = NullGraphicsServiceResetQueryBufferInterop;
+    service->GraphicsService_SetQueryBufferLabel = NullGraphicsServiceSetQueryBufferLabelInterop;
+    service->GraphicsService_DeleteQueryBuffer = NullGraphicsServiceDeleteQueryBufferInterop;
+    service->GraphicsService_CreateShader = NullGraphicsServiceCreateShaderInterop;
+    service->GraphicsService_CreateShaderFromArchive = NullGraphicsServiceCreateShaderFromArchiveInterop;
+    service->GraphicsService_SetShaderLabel = NullGraphicsServiceSetShaderLabelInterop;
+    service->GraphicsService_DeleteShader = NullGraphicsServiceDeleteShaderInterop;
+    service->GraphicsService_OpenShaderArchive = NullGraphicsServiceOpenShaderArchiveInterop;
+    service->GraphicsService_CloseShaderArchive = NullGraphicsServiceCloseShaderArchiveInterop;
+    service->GraphicsService_CreateComputePipelineState = NullGraphicsServiceCreateComputePipelineStateInterop;
+    service->GraphicsService_CreatePipelineState = NullGraphicsServiceCreatePipelineStateInterop;
+    service->GraphicsService_CreatePipelineStateAsync = NullGraphicsServiceCreatePipelineStateAsyncInterop;
+    service->GraphicsService_IsPipelineStateReady = NullGraphicsServiceIsPipelineStateReadyInterop;
+    service->GraphicsService_SetPipelineStateLabel = NullGraphicsServiceSetPipelineStateLabelInterop;
+    service->GraphicsService_DeletePipelineState = NullGraphicsServiceDeletePipelineStateInterop;
+    service->GraphicsService_CopyDataToGraphicsBuffer = NullGraphicsServiceCopyDataToGraphicsBufferInterop;
+    service->GraphicsService_CopyDataToTexture = NullGraphicsServiceCopyDataToTextureInterop;
+    service->GraphicsService_CopyTexture = NullGraphicsServiceCopyTextureInterop;
+    service->GraphicsService_TransitionGraphicsBufferToState = NullGraphicsServiceTransitionGraphicsBufferToStateInterop;
+    service->GraphicsService_DispatchThreads = NullGraphicsServiceDispatchThreadsInterop;
+    service->GraphicsService_BeginRenderPass = NullGraphicsServiceBeginRenderPassInterop;
+    service->GraphicsService_EndRenderPass = NullGraphicsServiceEndRenderPassInterop;
+    service->GraphicsService_SetPipelineState = NullGraphicsServiceSetPipelineStateInterop;
+    service->GraphicsService_SetTextureBarrier = NullGraphicsServiceSetTextureBarrierInterop;
+    service->GraphicsService_SetGraphicsBufferBarrier = NullGraphicsServiceSetGraphicsBufferBarrierInterop;
+    service->GraphicsService_SetShaderResourceHeap = NullGraphicsServiceSetShaderResourceHeapInterop;
+    service->GraphicsService_SetShader = NullGraphicsServiceSetShaderInterop;
+    service->GraphicsService_SetShaderParameterValues = NullGraphicsServiceSetShaderParameterValuesInterop;
+    service->GraphicsService_DispatchMesh = NullGraphicsServiceDispatchMeshInterop;
+    service->GraphicsService_ExecuteIndirect = NullGraphicsServiceExecuteIndirectInterop;
+    service->GraphicsService_BeginQuery = NullGraphicsServiceBeginQueryInterop;
+    service->GraphicsService_EndQuery = NullGraphicsServiceEndQueryInterop;
+    service->GraphicsService_ResolveQueryData = NullGraphicsServiceResolveQueryDataInterop;
+    service->GraphicsService_BeginGpuZone = NullGraphicsServiceBeginGpuZoneInterop;
+    service->GraphicsService_EndGpuZone = NullGraphicsServiceEndGpuZoneInterop;
+    service->GraphicsService_ResolveGpuZones = NullGraphicsServiceResolveGpuZonesInterop;
+}
@@ -7,6 +7,12 @@ void VulkanGraphicsServiceGetGraphicsAdapterNameInterop(void* context, char* out
     contextObject->GetGraphicsAdapterName(output);
 }
 
+int VulkanGraphicsServiceSetFramesInFlightCountInterop(void* context, int framesInFlightCount)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->SetFramesInFlightCount(framesInFlightCount);
+}
+
 struct GraphicsAllocationInfos VulkanGraphicsServiceGetBufferAllocationInfosInterop(void* context, int sizeInBytes)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -19,6 +25,12 @@ struct GraphicsAllocationInfos VulkanGraphicsServiceGetTextureAllocationInfosInt
     return contextObject->GetTextureAllocationInfos(textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
 }
 
+struct GraphicsMemoryBudget VulkanGraphicsServiceGetMemoryBudgetInterop(void* context, enum GraphicsServiceHeapType heapType)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->GetMemoryBudget(heapType);
+}
+
 void* VulkanGraphicsServiceCreateCommandQueueInterop(void* context, enum GraphicsServiceCommandType commandQueueType)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -49,12 +61,24 @@ unsigned long VulkanGraphicsServiceGetCommandQueueTimestampFrequencyInterop(void
     return contextObject->GetCommandQueueTimestampFrequency(commandQueuePointer);
 }
 
+struct GraphicsTimestampCalibration VulkanGraphicsServiceGetCommandQueueTimestampCalibrationInterop(void* context, void* commandQueuePointer)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->GetCommandQueueTimestampCalibration(commandQueuePointer);
+}
+
 unsigned long VulkanGraphicsServiceExecuteCommandListsInterop(void* context, void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength)
 {
     auto contextObject = (VulkanGraphicsService*)context;
     return contextObject->ExecuteCommandLists(commandQueuePointer, commandLists, commandListsLength, fencesToWait, fencesToWaitLength);
 }
 
+void VulkanGraphicsServiceExecuteCommandListBatchesInterop(void* context, struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    contextObject->ExecuteCommandListBatches(batches, batchesLength, fences, fencesLength);
+}
+
 void VulkanGraphicsServiceWaitForCommandQueueOnCpuInterop(void* context, struct GraphicsFence fenceToWait)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -115,6 +139,18 @@ void* VulkanGraphicsServiceCreateShaderResourceHeapInterop(void* context, unsign
     return contextObject->CreateShaderResourceHeap(length);
 }
 
+unsigned long VulkanGraphicsServiceGetShaderResourceHeapLengthInterop(void* context, void* shaderResourceHeapPointer)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->GetShaderResourceHeapLength(shaderResourceHeapPointer);
+}
+
+void VulkanGraphicsServiceResizeShaderResourceHeapInterop(void* context, void* shaderResourceHeapPointer, unsigned long length)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    contextObject->ResizeShaderResourceHeap(shaderResourceHeapPointer, length);
+}
+
 void VulkanGraphicsServiceSetShaderResourceHeapLabelInterop(void* context, void* shaderResourceHeapPointer, char* label)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -151,6 +187,12 @@ void VulkanGraphicsServiceDeleteShaderResourceBufferInterop(void* context, void*
     contextObject->DeleteShaderResourceBuffer(shaderResourceHeapPointer, index);
 }
 
+void VulkanGraphicsServiceCreateShaderResourcesInterop(void* context, void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    contextObject->CreateShaderResources(shaderResourceHeapPointer, writes, writesLength);
+}
+
 void* VulkanGraphicsServiceCreateGraphicsBufferInterop(void* context, void* graphicsHeapPointer, unsigned long heapOffset, enum GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -199,10 +241,10 @@ void VulkanGraphicsServiceDeleteTextureInterop(void* context, void* texturePoint
     contextObject->DeleteTexture(texturePointer);
 }
 
-void* VulkanGraphicsServiceCreateSwapChainInterop(void* context, void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat)
+void* VulkanGraphicsServiceCreateSwapChainInterop(void* context, void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount)
 {
     auto contextObject = (VulkanGraphicsService*)context;
-    return contextObject->CreateSwapChain(windowPointer, commandQueuePointer, width, height, textureFormat);
+    return contextObject->CreateSwapChain(windowPointer, commandQueuePointer, width, height, textureFormat, presentMode, backBufferCount);
 }
 
 void VulkanGraphicsServiceDeleteSwapChainInterop(void* context, void* swapChainPointer)
@@ -265,6 +307,12 @@ void* VulkanGraphicsServiceCreateShaderInterop(void* context, char* computeShade
     return contextObject->CreateShader(computeShaderFunction, shaderByteCode, shaderByteCodeLength);
 }
 
+void* VulkanGraphicsServiceCreateShaderFromArchiveInterop(void* context, void* shaderArchivePointer, char* shaderName)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->CreateShaderFromArchive(shaderArchivePointer, shaderName);
+}
+
 void VulkanGraphicsServiceSetShaderLabelInterop(void* context, void* shaderPointer, char* label)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -277,6 +325,18 @@ void VulkanGraphicsServiceDeleteShaderInterop(void* context, void* shaderPointer
     contextObject->DeleteShader(shaderPointer);
 }
 
+void* VulkanGraphicsServiceOpenShaderArchiveInterop(void* context, char* path)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->OpenShaderArchive(path);
+}
+
+void VulkanGraphicsServiceCloseShaderArchiveInterop(void* context, void* shaderArchivePointer)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    contextObject->CloseShaderArchive(shaderArchivePointer);
+}
+
 void* VulkanGraphicsServiceCreateComputePipelineStateInterop(void* context, void* shaderPointer)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -289,6 +349,18 @@ void* VulkanGraphicsServiceCreatePipelineStateInterop(void* context, void* shade
     return contextObject->CreatePipelineState(shaderPointer, renderPassDescriptor);
 }
 
+void* VulkanGraphicsServiceCreatePipelineStateAsyncInterop(void* context, void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->CreatePipelineStateAsync(shaderPointer, renderPassDescriptor, isComputePipelineState);
+}
+
+int VulkanGraphicsServiceIsPipelineStateReadyInterop(void* context, void* pipelineStatePointer, int waitForCompletion)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->IsPipelineStateReady(pipelineStatePointer, waitForCompletion);
+}
+
 void VulkanGraphicsServiceSetPipelineStateLabelInterop(void* context, void* pipelineStatePointer, char* label)
 {
     auto contextObject = (VulkanGraphicsService*)context;
@@ -409,18 +481,40 @@ void VulkanGraphicsServiceResolveQueryDataInterop(void* context, void* commandLi
     contextObject->ResolveQueryData(commandListPointer, queryBufferPointer, destinationBufferPointer, startIndex, endIndex);
 }
 
+void VulkanGraphicsServiceBeginGpuZoneInterop(void* context, void* commandListPointer, unsigned int nameId, char* name)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    contextObject->BeginGpuZone(commandListPointer, nameId, name);
+}
+
+void VulkanGraphicsServiceEndGpuZoneInterop(void* context, void* commandListPointer)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    contextObject->EndGpuZone(commandListPointer);
+}
+
+int VulkanGraphicsServiceResolveGpuZonesInterop(void* context, struct GraphicsGpuZone* gpuZones, int gpuZonesLength)
+{
+    auto contextObject = (VulkanGraphicsService*)context;
+    return contextObject->ResolveGpuZones(gpuZones, gpuZonesLength);
+}
+
 void InitVulkanGraphicsService(const VulkanGraphicsService* context, GraphicsService* service)
 {
     service->Context = (void*)context;
     service->GraphicsService_GetGraphicsAdapterName = VulkanGraphicsServiceGetGraphicsAdapterNameInterop;
+    service->GraphicsService_SetFramesInFlightCount = VulkanGraphicsServiceSetFramesInFlightCountInterop;
     service->GraphicsService_GetBufferAllocationInfos = VulkanGraphicsServiceGetBufferAllocationInfosInterop;
     service->GraphicsService_GetTextureAllocationInfos = VulkanGraphicsServiceGetTextureAllocationInfosInterop;
+    service->GraphicsService_GetMemoryBudget = VulkanGraphicsServiceGetMemoryBudgetInterop;
     service->GraphicsService_CreateCommandQueue = VulkanGraphicsServiceCreateCommandQueueInterop;
     service->GraphicsService_SetCommandQueueLabel = VulkanGraphicsServiceSetCommandQueueLabelInterop;
     service->GraphicsService_DeleteCommandQueue = VulkanGraphicsServiceDeleteCommandQueueInterop;
     service->GraphicsService_ResetCommandQueue = VulkanGraphicsServiceResetCommandQueueInterop;
     service->GraphicsService_GetCommandQueueTimestampFrequency = VulkanGraphicsServiceGetCommandQueueTimestampFrequencyInterop;
+    service->GraphicsService_GetCommandQueueTimestampCalibration = VulkanGraphicsServiceGetCommandQueueTimestampCalibrationInterop;
     service->GraphicsService_ExecuteCommandLists = VulkanGraphicsServiceExecuteCommandListsInterop;
+    service->GraphicsService_ExecuteCommandListBatches = VulkanGraphicsServiceExecuteCommandListBatchesInterop;
     service->GraphicsService_WaitForCommandQueueOnCpu = VulkanGraphicsServiceWaitForCommandQueueOnCpuInterop;
     service->GraphicsService_CreateCommandList = VulkanGraphicsServiceCreateCommandListInterop;
     service->GraphicsService_SetCommandListLabel = VulkanGraphicsServiceSetCommandListLabelInterop;
@@ -431,12 +525,15 @@ void InitVulkanGraphicsService(const VulkanGraphicsService* context, GraphicsSer
     service->GraphicsService_SetGraphicsHeapLabel = VulkanGraphicsServiceSetGraphicsHeapLabelInterop;
     service->GraphicsService_DeleteGraphicsHeap = VulkanGraphicsServiceDeleteGraphicsHeapInterop;
     service->GraphicsService_CreateShaderResourceHeap = VulkanGraphicsServiceCreateShaderResourceHeapInterop;
+    service->GraphicsService_GetShaderResourceHeapLength = VulkanGraphicsServiceGetShaderResourceHeapLengthInterop;
+    service->GraphicsService_ResizeShaderResourceHeap = VulkanGraphicsServiceResizeShaderResourceHeapInterop;
     service->GraphicsService_SetShaderResourceHeapLabel = VulkanGraphicsServiceSetShaderResourceHeapLabelInterop;
     service->GraphicsService_DeleteShaderResourceHeap = VulkanGraphicsServiceDeleteShaderResourceHeapInterop;
     service->GraphicsService_CreateShaderResourceTexture = VulkanGraphicsServiceCreateShaderResourceTextureInterop;
     service->GraphicsService_DeleteShaderResourceTexture = VulkanGraphicsServiceDeleteShaderResourceTextureInterop;
     service->GraphicsService_CreateShaderResourceBuffer = VulkanGraphicsServiceCreateShaderResourceBufferInterop;
     service->GraphicsService_DeleteShaderResourceBuffer = VulkanGraphicsServiceDeleteShaderResourceBufferInterop;
+    service->GraphicsService_CreateShaderResources = VulkanGraphicsServiceCreateShaderResourcesInterop;
     service->GraphicsService_CreateGraphicsBuffer = VulkanGraphicsServiceCreateGraphicsBufferInterop;
     service->GraphicsService_SetGraphicsBufferLabel = VulkanGraphicsServiceSetGraphicsBufferLabelInterop;
     service->GraphicsService_DeleteGraphicsBuffer = VulkanGraphicsServiceDeleteGraphicsBufferInterop;
@@ -456,10 +553,15 @@ void InitVulkanGraphicsService(const VulkanGraphicsService* context, GraphicsSer
     service->GraphicsService_SetQueryBufferLabel = VulkanGraphicsServiceSetQueryBufferLabelInterop;
     service->GraphicsService_DeleteQueryBuffer = VulkanGraphicsServiceDeleteQueryBufferInterop;
     service->GraphicsService_CreateShader = VulkanGraphicsServiceCreateShaderInterop;
+    service->GraphicsService_CreateShaderFromArchive = VulkanGraphicsServiceCreateShaderFromArchiveInterop;
     service->GraphicsService_SetShaderLabel = VulkanGraphicsServiceSetShaderLabelInterop;
     service->GraphicsService_DeleteShader = VulkanGraphicsServiceDeleteShaderInterop;
+    service->GraphicsService_OpenShaderArchive = VulkanGraphicsServiceOpenShaderArchiveInterop;
+    service->GraphicsService_CloseShaderArchive = VulkanGraphicsServiceCloseShaderArchiveInterop;
     service->GraphicsService_CreateComputePipelineState = VulkanGraphicsServiceCreateComputePipelineStateInterop;
     service->GraphicsService_CreatePipelineState = VulkanGraphicsServiceCreatePipelineStateInterop;
+    service->GraphicsService_CreatePipelineStateAsync = VulkanGraphicsServiceCreatePipelineStateAsyncInterop;
+    service->GraphicsService_IsPipelineStateReady = VulkanGraphicsServiceIsPipelineStateReadyInterop;
     service->GraphicsService_SetPipelineStateLabel = VulkanGraphicsServiceSetPipelineStateLabelInterop;
     service->GraphicsService_DeletePipelineState = VulkanGraphicsServiceDeletePipelineStateInterop;
     service->GraphicsService_CopyDataToGraphicsBuffer = VulkanGraphicsServiceCopyDataToGraphicsBufferInterop;
@@ -480,4 +582,7 @@ void InitVulkanGraphicsService(const VulkanGraphicsService* context, GraphicsSer
     service->GraphicsService_BeginQuery = VulkanGraphicsServiceBeginQueryInterop;
     service->GraphicsService_EndQuery = VulkanGraphicsServiceEndQueryInterop;
     service->GraphicsService_ResolveQueryData = VulkanGraphicsServiceResolveQueryDataInterop;
+    service->GraphicsService_BeginGpuZone = VulkanGraphicsServiceBeginGpuZoneInterop;
+    service->GraphicsService_EndGpuZone = VulkanGraphicsServiceEndGpuZoneInterop;
+    service->GraphicsService_ResolveGpuZones = VulkanGraphicsServiceResolveGpuZonesInterop;
 }
@@ -14,6 +14,7 @@ using namespace std;
     #define STR(s) L ## s
     #define CH(c) L ## c
     #define DIR_SEPARATOR L'\\'
+    #define NATIVE_LIBRARY_EXTENSION L".dll"
 
     void* NativeHost_LoadLibrary(const char_t* path)
     {
@@ -30,10 +31,12 @@ using namespace std;
 #else
     #include <dlfcn.h>
     #include <limits.h>
+    #include <unistd.h>
 
     #define STR(s) s
     #define CH(c) c
     #define DIR_SEPARATOR '/'
+    #define NATIVE_LIBRARY_EXTENSION ".so"
     #define MAX_PATH PATH_MAX
 
     void* NativeHost_LoadLibrary(const char_t *path)
@@ -99,7 +102,7 @@ load_assembly_and_get_function_pointer_fn NativeHost_GetDotnetLoadAssembly(const
     return (load_assembly_and_get_function_pointer_fn)load_assembly_and_get_function_pointer;
 }
 
-bool NativeHost_LoadEngine(StartEnginePtr* startEnginePointer, wstring assemblyName, bool nativeLoad)
+bool NativeHost_LoadEngine(StartEnginePtr* startEnginePointer, string_t assemblyName, bool nativeLoad)
 {
     char_t hostPath[MAX_PATH];
     
@@ -107,28 +110,30 @@ bool NativeHost_LoadEngine(StartEnginePtr* startEnginePointer, wstring assemblyN
     auto size = GetModuleFileNameW(NULL, hostPath, MAX_PATH);
     assert(size != 0);
 #else
-    auto resolved = realpath(argv[0], host_path);
-    assert(resolved != nullptr);
+    auto size = readlink("/proc/self/exe", hostPath, MAX_PATH - 1);
+    assert(size > 0);
+    hostPath[size] = '\0';
 #endif
 
-    wstring root_path = hostPath;
+    string_t root_path = hostPath;
     auto pos = root_path.find_last_of(DIR_SEPARATOR);
-    assert(pos != wstring::npos);
+    assert(pos != string_t::npos);
     root_path = root_path.substr(0, pos + 1);
 
-    wstring assemblyFileName = assemblyName;
+    string_t assemblyFileName = assemblyName;
     pos = assemblyFileName.find_last_of(DIR_SEPARATOR);
     
-    if(pos != wstring::npos)
+    if(pos != string_t::npos)
     {
         assemblyFileName = assemblyFileName.substr(pos + 1);
     }
 
-    const string_t dotnetlib_path = root_path + assemblyName + L".dll";
+    const string_t dotnetlib_path = root_path + assemblyName + STR(".dll");
 
     if (nativeLoad)
     {
-        void *lib = NativeHost_LoadLibrary(dotnetlib_path.c_str());
+        const string_t nativelib_path = root_path + assemblyName + NATIVE_LIBRARY_EXTENSION;
+        void *lib = NativeHost_LoadLibrary(nativelib_path.c_str());
         *startEnginePointer = (StartEnginePtr)NativeHost_GetExport(lib, "main");
     }
 
@@ -137,7 +142,7 @@ bool NativeHost_LoadEngine(StartEnginePtr* startEnginePointer, wstring assemblyN
         if (!NativeHost_LoadHostfxr())
         {
             assert(false && "Failure: load_hostfxr()");
-            return EXIT_FAILURE;
+            return false;
         }
 
         const string_t config_path = root_path + assemblyName + STR(".runtimeconfig.json");
@@ -146,7 +151,7 @@ bool NativeHost_LoadEngine(StartEnginePtr* startEnginePointer, wstring assemblyN
         assert(load_assembly_and_get_function_pointer != nullptr && "Failure: get_dotnet_load_assembly()");
 
         const char_t* dotnetlib_pathPtr = dotnetlib_path.c_str();
-        const string_t dotnetType = (L"Program, " + assemblyFileName);
+        const string_t dotnetType = (STR("Program, ") + assemblyFileName);
         const char_t *dotnet_type = dotnetType.c_str();
         const char_t *dotnet_type_method = STR("Main");
 
@@ -0,0 +1,819 @@
+#pragma once
+#include "NullGraphicsService.h"
+
+static const int NullResourceAlignment = 65536;
+
+NullGraphicsService::NullGraphicsService()
+{
+    for (int i = 0; i < NullCounterCount; i++)
+    {
+        this->counters[i] = 0;
+    }
+
+    this->presentedFrameCount = 0;
+    this->gpuMemoryUsage = 0;
+    this->systemMemoryUsage = 0;
+}
+
+NullGraphicsService::~NullGraphicsService()
+{
+}
+
+void NullGraphicsService::GetGraphicsAdapterName(char* output)
+{
+    IncrementCounter(NullCounterGetGraphicsAdapterName);
+
+    const char* adapterName = "Null Graphics Adapter";
+    memcpy(output, adapterName, strlen(adapterName));
+}
+
+int NullGraphicsService::SetFramesInFlightCount(int framesInFlightCount)
+{
+    IncrementCounter(NullCounterSetFramesInFlightCount);
+
+    this->framesInFlightCount = framesInFlightCount < 1 ? 1 : (framesInFlightCount > NullMaxFramesInFlightCount ? NullMaxFramesInFlightCount : framesInFlightCount);
+    this->gpuZoneProfiler.SetFramesInFlightCount(this->framesInFlightCount);
+
+    return this->framesInFlightCount;
+}
+
+GraphicsAllocationInfos NullGraphicsService::GetBufferAllocationInfos(int sizeInBytes)
+{
+    IncrementCounter(NullCounterGetBufferAllocationInfos);
+
+    GraphicsAllocationInfos result = {};
+    result.SizeInBytes = sizeInBytes;
+    result.Alignment = NullResourceAlignment;
+
+    return result;
+}
+
+GraphicsAllocationInfos NullGraphicsService::GetTextureAllocationInfos(enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+    IncrementCounter(NullCounterGetTextureAllocationInfos);
+
+    GraphicsAllocationInfos result = {};
+    result.SizeInBytes = (int)ComputeTextureSizeInBytes(textureFormat, width, height, faceCount, mipLevels, multisampleCount);
+    result.Alignment = NullResourceAlignment;
+
+    return result;
+}
+
+GraphicsMemoryBudget NullGraphicsService::GetMemoryBudget(enum GraphicsServiceHeapType heapType)
+{
+    IncrementCounter(NullCounterGetMemoryBudget);
+
+    GraphicsMemoryBudget result = {};
+
+    if (heapType == GraphicsServiceHeapType::Gpu || heapType == GraphicsServiceHeapType::GpuUpload)
+    {
+        result.BudgetInBytes = NullGpuMemoryBudget;
+        result.UsageInBytes = this->gpuMemoryUsage;
+    }
+
+    else
+    {
+        result.BudgetInBytes = NullSystemMemoryBudget;
+        result.UsageInBytes = this->systemMemoryUsage;
+    }
+
+    return result;
+}
+
+void* NullGraphicsService::CreateCommandQueue(enum GraphicsServiceCommandType commandQueueType)
+{
+    IncrementCounter(NullCounterCreateCommandQueue);
+
+    auto commandQueue = new NullCommandQueue();
+    commandQueue->CommandQueueType = commandQueueType;
+    commandQueue->FenceValue = 0;
+
+    return commandQueue;
+}
+
+void NullGraphicsService::SetCommandQueueLabel(void* commandQueuePointer, char* label)
+{
+    IncrementCounter(NullCounterSetCommandQueueLabel);
+}
+
+void NullGraphicsService::DeleteCommandQueue(void* commandQueuePointer)
+{
+    IncrementCounter(NullCounterDeleteCommandQueue);
+    delete (NullCommandQueue*)commandQueuePointer;
+}
+
+void NullGraphicsService::ResetCommandQueue(void* commandQueuePointer)
+{
+    IncrementCounter(NullCounterResetCommandQueue);
+}
+
+unsigned long NullGraphicsService::GetCommandQueueTimestampFrequency(void* commandQueuePointer)
+{
+    IncrementCounter(NullCounterGetCommandQueueTimestampFrequency);
+
+    // The zones are timed with the host clock
+    return GetHostTimestampFrequency();
+}
+
+struct GraphicsTimestampCalibration NullGraphicsService::GetCommandQueueTimestampCalibration(void* commandQueuePointer)
+{
+    IncrementCounter(NullCounterGetCommandQueueTimestampCalibration);
+
+    GraphicsTimestampCalibration result = {};
+    result.GpuTimestamp = GetHostTimestamp();
+    result.CpuTimestamp = result.GpuTimestamp;
+
+    return result;
+}
+
+unsigned long NullGraphicsService::ExecuteCommandLists(void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength)
+{
+    IncrementCounter(NullCounterExecuteCommandLists);
+
+    auto commandQueue = (NullCommandQueue*)commandQueuePointer;
+    return commandQueue->FenceValue.fetch_add(1) + 1;
+}
+
+void NullGraphicsService::ExecuteCommandListBatches(struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength)
+{
+    IncrementCounter(NullCounterExecuteCommandListBatches);
+    assert(fencesLength >= batchesLength);
+
+    for (int i = 0; i < batchesLength; i++)
+    {
+        auto commandQueue = (NullCommandQueue*)batches[i].CommandQueuePointer;
+
+        fences[i].CommandQueuePointer = commandQueue;
+        fences[i].Value = commandQueue->FenceValue.fetch_add(1) + 1;
+    }
+}
+
+void NullGraphicsService::WaitForCommandQueueOnCpu(struct GraphicsFence fenceToWait)
+{
+    IncrementCounter(NullCounterWaitForCommandQueueOnCpu);
+}
+
+void* NullGraphicsService::CreateCommandList(void* commandQueuePointer)
+{
+    IncrementCounter(NullCounterCreateCommandList);
+
+    auto commandList = new NullCommandList();
+    commandList->CommandQueue = (NullCommandQueue*)commandQueuePointer;
+    commandList->IsRenderPassActive = false;
+    commandList->GpuZones.Depth = 0;
+
+    return commandList;
+}
+
+void NullGraphicsService::SetCommandListLabel(void* commandListPointer, char* label)
+{
+    IncrementCounter(NullCounterSetCommandListLabel);
+}
+
+void NullGraphicsService::DeleteCommandList(void* commandListPointer)
+{
+    IncrementCounter(NullCounterDeleteCommandList);
+    delete (NullCommandList*)commandListPointer;
+}
+
+void NullGraphicsService::ResetCommandList(void* commandListPointer)
+{
+    IncrementCounter(NullCounterResetCommandList);
+
+    auto commandList = (NullCommandList*)commandListPointer;
+    commandList->GpuZones.Depth = 0;
+}
+
+void NullGraphicsService::CommitCommandList(void* commandListPointer)
+{
+    IncrementCounter(NullCounterCommitCommandList);
+
+    auto commandList = (NullCommandList*)commandListPointer;
+    assert(!commandList->IsRenderPassActive);
+    assert(commandList->GpuZones.Depth == 0);
+}
+
+void* NullGraphicsService::CreateGraphicsHeap(enum GraphicsServiceHeapType type, unsigned long sizeInBytes)
+{
+    IncrementCounter(NullCounterCreateGraphicsHeap);
+    IncrementCounter(NullCounterHeapBytes, sizeInBytes);
+
+    auto graphicsHeap = new NullGraphicsHeap();
+    graphicsHeap->Type = type;
+    graphicsHeap->SizeInBytes = sizeInBytes;
+    graphicsHeap->CpuMemory = nullptr;
+
+    auto& memoryUsage = (type == GraphicsServiceHeapType::Gpu || type == GraphicsServiceHeapType::GpuUpload) ? this->gpuMemoryUsage : this->systemMemoryUsage;
+    memoryUsage += sizeInBytes;
+
+    // Only the heaps that are accessed by the CPU need real memory
+    if (type == GraphicsServiceHeapType::Upload || type == GraphicsServiceHeapType::ReadBack || type == GraphicsServiceHeapType::GpuUpload)
+    {
+        graphicsHeap->CpuMemory = (uint8_t*)calloc(sizeInBytes, 1);
+        assert(graphicsHeap->CpuMemory != nullptr);
+    }
+
+    return graphicsHeap;
+}
+
+void NullGraphicsService::SetGraphicsHeapLabel(void* graphicsHeapPointer, char* label)
+{
+    IncrementCounter(NullCounterSetGraphicsHeapLabel);
+}
+
+void NullGraphicsService::DeleteGraphicsHeap(void* graphicsHeapPointer)
+{
+    IncrementCounter(NullCounterDeleteGraphicsHeap);
+
+    auto graphicsHeap = (NullGraphicsHeap*)graphicsHeapPointer;
+
+    auto& memoryUsage = (graphicsHeap->Type == GraphicsServiceHeapType::Gpu || graphicsHeap->Type == GraphicsServiceHeapType::GpuUpload) ? this->gpuMemoryUsage : this->systemMemoryUsage;
+    memoryUsage -= graphicsHeap->SizeInBytes;
+
+    if (graphicsHeap->CpuMemory != nullptr)
+    {
+        free(graphicsHeap->CpuMemory);
+    }
+
+    delete graphicsHeap;
+}
+
+void* NullGraphicsService::CreateShaderResourceHeap(unsigned long length)
+{
+    IncrementCounter(NullCounterCreateShaderResourceHeap);
+
+    auto shaderResourceHeap = new NullShaderResourceHeap();
+    shaderResourceHeap->Length = length < NullMaxShaderResourceHeapLength ? length : NullMaxShaderResourceHeapLength;
+
+    return shaderResourceHeap;
+}
+
+unsigned long NullGraphicsService::GetShaderResourceHeapLength(void* shaderResourceHeapPointer)
+{
+    IncrementCounter(NullCounterGetShaderResourceHeapLength);
+    return ((NullShaderResourceHeap*)shaderResourceHeapPointer)->Length;
+}
+
+void NullGraphicsService::ResizeShaderResourceHeap(void* shaderResourceHeapPointer, unsigned long length)
+{
+    IncrementCounter(NullCounterResizeShaderResourceHeap);
+
+    auto shaderResourceHeap = (NullShaderResourceHeap*)shaderResourceHeapPointer;
+    auto heapLength = length < NullMaxShaderResourceHeapLength ? length : NullMaxShaderResourceHeapLength;
+
+    if (heapLength > shaderResourceHeap->Length)
+    {
+        shaderResourceHeap->Length = heapLength;
+    }
+}
+
+void NullGraphicsService::SetShaderResourceHeapLabel(void* shaderResourceHeapPointer, char* label)
+{
+    IncrementCounter(NullCounterSetShaderResourceHeapLabel);
+}
+
+void NullGraphicsService::DeleteShaderResourceHeap(void* shaderResourceHeapPointer)
+{
+    IncrementCounter(NullCounterDeleteShaderResourceHeap);
+    delete (NullShaderResourceHeap*)shaderResourceHeapPointer;
+}
+
+void NullGraphicsService::CreateShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel)
+{
+    IncrementCounter(NullCounterCreateShaderResourceTexture);
+    assert(index < ((NullShaderResourceHeap*)shaderResourceHeapPointer)->Length);
+}
+
+void NullGraphicsService::DeleteShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index)
+{
+    IncrementCounter(NullCounterDeleteShaderResourceTexture);
+    assert(index < ((NullShaderResourceHeap*)shaderResourceHeapPointer)->Length);
+}
+
+void NullGraphicsService::CreateShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable)
+{
+    IncrementCounter(NullCounterCreateShaderResourceBuffer);
+    assert(index < ((NullShaderResourceHeap*)shaderResourceHeapPointer)->Length);
+}
+
+void NullGraphicsService::DeleteShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index)
+{
+    IncrementCounter(NullCounterDeleteShaderResourceBuffer);
+    assert(index < ((NullShaderResourceHeap*)shaderResourceHeapPointer)->Length);
+}
+
+void NullGraphicsService::CreateShaderResources(void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength)
+{
+    IncrementCounter(NullCounterCreateShaderResources);
+
+    for (int i = 0; i < writesLength; i++)
+    {
+        assert(writes[i].Index < ((NullShaderResourceHeap*)shaderResourceHeapPointer)->Length);
+    }
+}
+
+void* NullGraphicsService::CreateGraphicsBuffer(void* graphicsHeapPointer, unsigned long heapOffset, GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes)
+{
+    IncrementCounter(NullCounterCreateGraphicsBuffer);
+
+    auto graphicsHeap = (NullGraphicsHeap*)graphicsHeapPointer;
+    assert(heapOffset + sizeInBytes <= graphicsHeap->SizeInBytes);
+
+    auto graphicsBuffer = new NullGraphicsBuffer();
+    graphicsBuffer->GraphicsHeap = graphicsHeap;
+    graphicsBuffer->HeapOffset = heapOffset;
+    graphicsBuffer->SizeInBytes = sizeInBytes;
+    graphicsBuffer->Usage = graphicsBufferUsage;
+
+    return graphicsBuffer;
+}
+
+void NullGraphicsService::SetGraphicsBufferLabel(void* graphicsBufferPointer, char* label)
+{
+    IncrementCounter(NullCounterSetGraphicsBufferLabel);
+}
+
+void NullGraphicsService::DeleteGraphicsBuffer(void* graphicsBufferPointer)
+{
+    IncrementCounter(NullCounterDeleteGraphicsBuffer);
+    delete (NullGraphicsBuffer*)graphicsBufferPointer;
+}
+
+void* NullGraphicsService::GetGraphicsBufferCpuPointer(void* graphicsBufferPointer)
+{
+    IncrementCounter(NullCounterGetGraphicsBufferCpuPointer);
+
+    auto graphicsBuffer = (NullGraphicsBuffer*)graphicsBufferPointer;
+
+    if (graphicsBuffer->GraphicsHeap->CpuMemory == nullptr)
+    {
+        return nullptr;
+    }
+
+    return graphicsBuffer->GraphicsHeap->CpuMemory + graphicsBuffer->HeapOffset;
+}
+
+void NullGraphicsService::ReleaseGraphicsBufferCpuPointer(void* graphicsBufferPointer)
+{
+    IncrementCounter(NullCounterReleaseGraphicsBufferCpuPointer);
+}
+
+void* NullGraphicsService::CreateTexture(void* graphicsHeapPointer, unsigned long heapOffset, int isAliasable, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+    IncrementCounter(NullCounterCreateTexture);
+
+    auto texture = new NullTexture();
+    texture->TextureFormat = textureFormat;
+    texture->Usage = usage;
+    texture->Width = width;
+    texture->Height = height;
+    texture->FaceCount = faceCount;
+    texture->MipLevels = mipLevels;
+    texture->IsPresentTexture = false;
+
+    return texture;
+}
+
+void NullGraphicsService::SetTextureLabel(void* texturePointer, char* label)
+{
+    IncrementCounter(NullCounterSetTextureLabel);
+}
+
+void NullGraphicsService::DeleteTexture(void* texturePointer)
+{
+    IncrementCounter(NullCounterDeleteTexture);
+    delete (NullTexture*)texturePointer;
+}
+
+void* NullGraphicsService::CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount)
+{
+    IncrementCounter(NullCounterCreateSwapChain);
+
+    auto swapChain = new NullSwapChain();
+    swapChain->CommandQueue = (NullCommandQueue*)commandQueuePointer;
+    swapChain->CurrentImageIndex = 0;
+    swapChain->PresentMode = presentMode;
+
+    // 0 lets the backend choose, one back buffer per frame in flight with a minimum of 2
+    swapChain->BackBufferCount = backBufferCount > 0 ? backBufferCount : this->framesInFlightCount;
+    swapChain->BackBufferCount = swapChain->BackBufferCount < 2 ? 2 : (swapChain->BackBufferCount > NullMaxSwapChainImageCount ? NullMaxSwapChainImageCount : swapChain->BackBufferCount);
+
+    for (uint32_t i = 0; i < swapChain->BackBufferCount; i++)
+    {
+        auto backBufferTexture = new NullTexture();
+        backBufferTexture->TextureFormat = textureFormat;
+        backBufferTexture->Usage = GraphicsTextureUsage::RenderTarget;
+        backBufferTexture->Width = width;
+        backBufferTexture->Height = height;
+        backBufferTexture->FaceCount = 1;
+        backBufferTexture->MipLevels = 1;
+        backBufferTexture->IsPresentTexture = true;
+
+        swapChain->BackBufferTextures[i] = backBufferTexture;
+    }
+
+    return swapChain;
+}
+
+void NullGraphicsService::DeleteSwapChain(void* swapChainPointer)
+{
+    IncrementCounter(NullCounterDeleteSwapChain);
+
+    auto swapChain = (NullSwapChain*)swapChainPointer;
+
+    for (uint32_t i = 0; i < swapChain->BackBufferCount; i++)
+    {
+        delete swapChain->BackBufferTextures[i];
+    }
+
+    delete swapChain;
+}
+
+void NullGraphicsService::ResizeSwapChain(void* swapChainPointer, int width, int height)
+{
+    IncrementCounter(NullCounterResizeSwapChain);
+
+    auto swapChain = (NullSwapChain*)swapChainPointer;
+
+    for (uint32_t i = 0; i < swapChain->BackBufferCount; i++)
+    {
+        swapChain->BackBufferTextures[i]->Width = width;
+        swapChain->BackBufferTextures[i]->Height = height;
+    }
+}
+
+void* NullGraphicsService::GetSwapChainBackBufferTexture(void* swapChainPointer)
+{
+    IncrementCounter(NullCounterGetSwapChainBackBufferTexture);
+
+    auto swapChain = (NullSwapChain*)swapChainPointer;
+    return swapChain->BackBufferTextures[swapChain->CurrentImageIndex];
+}
+
+unsigned long NullGraphicsService::PresentSwapChain(void* swapChainPointer)
+{
+    IncrementCounter(NullCounterPresentSwapChain);
+    this->presentedFrameCount++;
+
+    auto swapChain = (NullSwapChain*)swapChainPointer;
+    swapChain->CurrentImageIndex = (swapChain->CurrentImageIndex + 1) % swapChain->BackBufferCount;
+
+    return swapChain->CommandQueue->FenceValue.fetch_add(1) + 1;
+}
+
+void NullGraphicsService::WaitForSwapChainOnCpu(void* swapChainPointer)
+{
+    IncrementCounter(NullCounterWaitForSwapChainOnCpu);
+}
+
+void* NullGraphicsService::CreateQueryBuffer(enum GraphicsQueryBufferType queryBufferType, int length)
+{
+    IncrementCounter(NullCounterCreateQueryBuffer);
+
+    auto queryBuffer = new NullQueryBuffer();
+    queryBuffer->QueryBufferType = queryBufferType;
+    queryBuffer->Length = length;
+
+    return queryBuffer;
+}
+
+void NullGraphicsService::ResetQueryBuffer(void* queryBufferPointer)
+{
+    IncrementCounter(NullCounterResetQueryBuffer);
+}
+
+void NullGraphicsService::SetQueryBufferLabel(void* queryBufferPointer, char* label)
+{
+    IncrementCounter(NullCounterSetQueryBufferLabel);
+}
+
+void NullGraphicsService::DeleteQueryBuffer(void* queryBufferPointer)
+{
+    IncrementCounter(NullCounterDeleteQueryBuffer);
+    delete (NullQueryBuffer*)queryBufferPointer;
+}
+
+void* NullGraphicsService::CreateShader(char* computeShaderFunction, void* shaderByteCode, int shaderByteCodeLength)
+{
+    IncrementCounter(NullCounterCreateShader);
+    IncrementCounter(NullCounterShaderByteCodeBytes, shaderByteCodeLength);
+
+    auto shader = new NullShader();
+    shader->IsComputeShader = (computeShaderFunction != nullptr);
+
+    return shader;
+}
+
+void* NullGraphicsService::CreateShaderFromArchive(void* shaderArchivePointer, char* shaderName)
+{
+    IncrementCounter(NullCounterCreateShaderFromArchive);
+
+    ShaderArchive* shaderArchive = (ShaderArchive*)shaderArchivePointer;
+    auto archiveShader = FindShaderArchiveShader(shaderArchive, shaderName);
+
+    if (archiveShader == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto shader = new NullShader();
+
+    for (uint32_t i = 0; i < archiveShader->EntryPointCount; i++)
+    {
+        auto& entryPoint = shaderArchive->EntryPoints[archiveShader->FirstEntryPoint + i];
+        IncrementCounter(NullCounterShaderByteCodeBytes, entryPoint.SpirvLength);
+
+        if (entryPoint.Stage == ShaderStageCompute)
+        {
+            shader->IsComputeShader = true;
+        }
+    }
+
+    return shader;
+}
+
+void NullGraphicsService::SetShaderLabel(void* shaderPointer, char* label)
+{
+    IncrementCounter(NullCounterSetShaderLabel);
+}
+
+void NullGraphicsService::DeleteShader(void* shaderPointer)
+{
+    IncrementCounter(NullCounterDeleteShader);
+    delete (NullShader*)shaderPointer;
+}
+
+void* NullGraphicsService::OpenShaderArchive(char* path)
+{
+    IncrementCounter(NullCounterOpenShaderArchive);
+    return OpenShaderArchiveFile(path);
+}
+
+void NullGraphicsService::CloseShaderArchive(void* shaderArchivePointer)
+{
+    IncrementCounter(NullCounterCloseShaderArchive);
+    CloseShaderArchiveFile((ShaderArchive*)shaderArchivePointer);
+}
+
+void* NullGraphicsService::CreateComputePipelineState(void* shaderPointer)
+{
+    IncrementCounter(NullCounterCreateComputePipelineState);
+
+    auto pipelineState = new NullPipelineState();
+    pipelineState->Shader = (NullShader*)shaderPointer;
+
+    return pipelineState;
+}
+
+void* NullGraphicsService::CreatePipelineState(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor)
+{
+    IncrementCounter(NullCounterCreatePipelineState);
+
+    auto pipelineState = new NullPipelineState();
+    pipelineState->Shader = (NullShader*)shaderPointer;
+
+    return pipelineState;
+}
+
+void* NullGraphicsService::CreatePipelineStateAsync(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState)
+{
+    IncrementCounter(NullCounterCreatePipelineStateAsync);
+
+    // Nothing to compile so the pipeline state is ready right away
+    auto pipelineState = new NullPipelineState();
+    pipelineState->Shader = (NullShader*)shaderPointer;
+
+    return pipelineState;
+}
+
+int NullGraphicsService::IsPipelineStateReady(void* pipelineStatePointer, int waitForCompletion)
+{
+    IncrementCounter(NullCounterIsPipelineStateReady);
+    return 1;
+}
+
+void NullGraphicsService::SetPipelineStateLabel(void* pipelineStatePointer, char* label)
+{
+    IncrementCounter(NullCounterSetPipelineStateLabel);
+}
+
+void NullGraphicsService::DeletePipelineState(void* pipelineStatePointer)
+{
+    IncrementCounter(NullCounterDeletePipelineState);
+    delete (NullPipelineState*)pipelineStatePointer;
+}
+
+void NullGraphicsService::CopyDataToGraphicsBuffer(void* commandListPointer, void* destinationGraphicsBufferPointer, void* sourceGraphicsBufferPointer, unsigned int sizeInBytes, unsigned int destinationOffsetInBytes, unsigned int sourceOffsetInBytes)
+{
+    IncrementCounter(NullCounterCopyDataToGraphicsBuffer);
+    IncrementCounter(NullCounterUploadedBytes, sizeInBytes);
+}
+
+void NullGraphicsService::CopyDataToTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceGraphicsBufferPointer, enum GraphicsTextureFormat textureFormat, int width, int height, int slice, int mipLevel)
+{
+    IncrementCounter(NullCounterCopyDataToTexture);
+    IncrementCounter(NullCounterUploadedBytes, ComputeTextureSizeInBytes(textureFormat, width, height, 1, 1, 1));
+}
+
+void NullGraphicsService::CopyTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceTexturePointer)
+{
+    IncrementCounter(NullCounterCopyTexture);
+}
+
+void NullGraphicsService::TransitionGraphicsBufferToState(void* commandListPointer, void* graphicsBufferPointer, enum GraphicsResourceState resourceState)
+{
+    IncrementCounter(NullCounterTransitionGraphicsBufferToState);
+}
+
+void NullGraphicsService::DispatchThreads(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ)
+{
+    IncrementCounter(NullCounterDispatchThreads);
+}
+
+void NullGraphicsService::BeginRenderPass(void* commandListPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor)
+{
+    IncrementCounter(NullCounterBeginRenderPass);
+
+    auto commandList = (NullCommandList*)commandListPointer;
+    assert(!commandList->IsRenderPassActive);
+    commandList->IsRenderPassActive = true;
+}
+
+void NullGraphicsService::EndRenderPass(void* commandListPointer)
+{
+    IncrementCounter(NullCounterEndRenderPass);
+
+    auto commandList = (NullCommandList*)commandListPointer;
+    assert(commandList->IsRenderPassActive);
+    commandList->IsRenderPassActive = false;
+}
+
+void NullGraphicsService::SetPipelineState(void* commandListPointer, void* pipelineStatePointer)
+{
+    IncrementCounter(NullCounterSetPipelineState);
+}
+
+void NullGraphicsService::SetShaderResourceHeap(void* commandListPointer, void* shaderResourceHeapPointer)
+{
+    IncrementCounter(NullCounterSetShaderResourceHeap);
+}
+
+void NullGraphicsService::SetShader(void* commandListPointer, void* shaderPointer)
+{
+    IncrementCounter(NullCounterSetShader);
+}
+
+void NullGraphicsService::SetShaderParameterValues(void* commandListPointer, unsigned int slot, unsigned int* values, int valuesLength)
+{
+    IncrementCounter(NullCounterSetShaderParameterValues);
+    IncrementCounter(NullCounterShaderParameterBytes, valuesLength * sizeof(unsigned int));
+}
+
+void NullGraphicsService::SetTextureBarrier(void* commandListPointer, void* texturePointer)
+{
+    IncrementCounter(NullCounterSetTextureBarrier);
+}
+
+void NullGraphicsService::SetGraphicsBufferBarrier(void* commandListPointer, void* graphicsBufferPointer)
+{
+    IncrementCounter(NullCounterSetGraphicsBufferBarrier);
+}
+
+void NullGraphicsService::DispatchMesh(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ)
+{
+    IncrementCounter(NullCounterDispatchMesh);
+}
+
+void NullGraphicsService::ExecuteIndirect(void* commandListPointer, unsigned int maxCommandCount, void* commandGraphicsBufferPointer, unsigned int commandBufferOffset)
+{
+    IncrementCounter(NullCounterExecuteIndirect);
+}
+
+void NullGraphicsService::BeginQuery(void* commandListPointer, void* queryBufferPointer, int index)
+{
+    IncrementCounter(NullCounterBeginQuery);
+}
+
+void NullGraphicsService::EndQuery(void* commandListPointer, void* queryBufferPointer, int index)
+{
+    IncrementCounter(NullCounterEndQuery);
+}
+
+void NullGraphicsService::ResolveQueryData(void* commandListPointer, void* queryBufferPointer, void* destinationBufferPointer, int startIndex, int endIndex)
+{
+    IncrementCounter(NullCounterResolveQueryData);
+}
+
+void NullGraphicsService::BeginGpuZone(void* commandListPointer, unsigned int nameId, char* name)
+{
+    IncrementCounter(NullCounterBeginGpuZone);
+
+    auto commandList = (NullCommandList*)commandListPointer;
+    auto zoneIndex = this->gpuZoneProfiler.BeginZone(&commandList->GpuZones, nameId);
+
+    if (zoneIndex != GpuZoneInvalidIndex)
+    {
+        this->gpuZoneTimestamps[this->gpuZoneProfiler.GetStartQueryIndex(zoneIndex)] = GetHostTimestamp();
+    }
+}
+
+void NullGraphicsService::EndGpuZone(void* commandListPointer)
+{
+    IncrementCounter(NullCounterEndGpuZone);
+
+    auto commandList = (NullCommandList*)commandListPointer;
+    auto zoneIndex = this->gpuZoneProfiler.EndZone(&commandList->GpuZones);
+
+    if (zoneIndex != GpuZoneInvalidIndex)
+    {
+        this->gpuZoneTimestamps[this->gpuZoneProfiler.GetEndQueryIndex(zoneIndex)] = GetHostTimestamp();
+    }
+}
+
+int NullGraphicsService::ResolveGpuZones(struct GraphicsGpuZone* gpuZones, int gpuZonesLength)
+{
+    IncrementCounter(NullCounterResolveGpuZones);
+
+    auto frameQueryOffset = this->gpuZoneProfiler.GetFrameQueryOffset(this->gpuZoneProfiler.GetNextFrameIndex());
+    return this->gpuZoneProfiler.ResolveZones(this->gpuZoneTimestamps.data() + frameQueryOffset, gpuZones, gpuZonesLength);
+}
+
+void NullGraphicsService::PrintStatistics()
+{
+    uint64_t frameCount = this->presentedFrameCount;
+
+    printf("Null Graphics Service Statistics (%llu frames):\n", (unsigned long long)frameCount);
+
+    for (int i = 0; i < NullCounterCount; i++)
+    {
+        uint64_t value = this->counters[i];
+
+        if (value == 0)
+        {
+            continue;
+        }
+
+        if (frameCount > 0)
+        {
+            printf("    %s: %llu (%.2f per frame)\n", NullGraphicsServiceCounterNames[i], (unsigned long long)value, (double)value / frameCount);
+        }
+
+        else
+        {
+            printf("    %s: %llu\n", NullGraphicsServiceCounterNames[i], (unsigned long long)value);
+        }
+    }
+}
+
+uint64_t NullGraphicsService::ComputeTextureSizeInBytes(enum GraphicsTextureFormat textureFormat, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+    // Block compressed formats are stored in 4x4 blocks
+    uint64_t blockSize = 1;
+    uint64_t bytesPerBlock = 4;
+
+    switch (textureFormat)
+    {
+        case GraphicsTextureFormat::BC1Srgb:
+        case GraphicsTextureFormat::BC4:
+            blockSize = 4;
+            bytesPerBlock = 8;
+            break;
+
+        case GraphicsTextureFormat::BC2Srgb:
+        case GraphicsTextureFormat::BC3Srgb:
+        case GraphicsTextureFormat::BC5:
+        case GraphicsTextureFormat::BC6:
+        case GraphicsTextureFormat::BC7Srgb:
+            blockSize = 4;
+            bytesPerBlock = 16;
+            break;
+
+        case GraphicsTextureFormat::R16Float:
+            bytesPerBlock = 2;
+            break;
+
+        case GraphicsTextureFormat::Rgba16Float:
+        case GraphicsTextureFormat::Rgba16Unorm:
+            bytesPerBlock = 8;
+            break;
+
+        case GraphicsTextureFormat::Rgba32Float:
+            bytesPerBlock = 16;
+            break;
+
+        default:
+            bytesPerBlock = 4;
+    }
+
+    uint64_t result = 0;
+
+    for (int i = 0; i < mipLevels; i++)
+    {
+        uint64_t mipWidth = (width >> i) > 0 ? (width >> i) : 1;
+        uint64_t mipHeight = (height >> i) > 0 ? (height >> i) : 1;
+
+        result += ((mipWidth + blockSize - 1) / blockSize) * ((mipHeight + blockSize - 1) / blockSize) * bytesPerBlock;
+    }
+
+    return result * faceCount * multisampleCount;
+}
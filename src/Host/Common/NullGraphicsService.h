@@ -0,0 +1,408 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <atomic>
+#include <vector>
+#include "CoreEngine.h"
+#include "ShaderArchive.h"
+#include "GpuZoneProfiler.h"
+
+using namespace std;
+
+static const int NullMaxFramesInFlightCount = 4;
+static const int NullMaxSwapChainImageCount = 8;
+
+// Simulated device limit for the shader resource heaps
+static const uint64_t NullMaxShaderResourceHeapLength = 1000000;
+
+// Simulated memory budgets of a discrete GPU, upload and readback heaps use system memory
+static const uint64_t NullGpuMemoryBudget = 4ull * 1024 * 1024 * 1024;
+static const uint64_t NullSystemMemoryBudget = 8ull * 1024 * 1024 * 1024;
+
+enum NullGraphicsServiceCounter : int
+{
+    NullCounterGetGraphicsAdapterName,
+    NullCounterSetFramesInFlightCount,
+    NullCounterGetBufferAllocationInfos,
+    NullCounterGetTextureAllocationInfos,
+    NullCounterGetMemoryBudget,
+    NullCounterCreateCommandQueue,
+    NullCounterSetCommandQueueLabel,
+    NullCounterDeleteCommandQueue,
+    NullCounterResetCommandQueue,
+    NullCounterGetCommandQueueTimestampFrequency,
+    NullCounterGetCommandQueueTimestampCalibration,
+    NullCounterExecuteCommandLists,
+    NullCounterExecuteCommandListBatches,
+    NullCounterWaitForCommandQueueOnCpu,
+    NullCounterCreateCommandList,
+    NullCounterSetCommandListLabel,
+    NullCounterDeleteCommandList,
+    NullCounterResetCommandList,
+    NullCounterCommitCommandList,
+    NullCounterCreateGraphicsHeap,
+    NullCounterSetGraphicsHeapLabel,
+    NullCounterDeleteGraphicsHeap,
+    NullCounterCreateShaderResourceHeap,
+    NullCounterGetShaderResourceHeapLength,
+    NullCounterResizeShaderResourceHeap,
+    NullCounterSetShaderResourceHeapLabel,
+    NullCounterDeleteShaderResourceHeap,
+    NullCounterCreateShaderResourceTexture,
+    NullCounterDeleteShaderResourceTexture,
+    NullCounterCreateShaderResourceBuffer,
+    NullCounterDeleteShaderResourceBuffer,
+    NullCounterCreateShaderResources,
+    NullCounterCreateGraphicsBuffer,
+    NullCounterSetGraphicsBufferLabel,
+    NullCounterDeleteGraphicsBuffer,
+    NullCounterGetGraphicsBufferCpuPointer,
+    NullCounterReleaseGraphicsBufferCpuPointer,
+    NullCounterCreateTexture,
+    NullCounterSetTextureLabel,
+    NullCounterDeleteTexture,
+    NullCounterCreateSwapChain,
+    NullCounterDeleteSwapChain,
+    NullCounterResizeSwapChain,
+    NullCounterGetSwapChainBackBufferTexture,
+    NullCounterPresentSwapChain,
+    NullCounterWaitForSwapChainOnCpu,
+    NullCounterCreateQueryBuffer,
+    NullCounterResetQueryBuffer,
+    NullCounterSetQueryBufferLabel,
+    NullCounterDeleteQueryBuffer,
+    NullCounterCreateShader,
+    NullCounterCreateShaderFromArchive,
+    NullCounterSetShaderLabel,
+    NullCounterDeleteShader,
+    NullCounterOpenShaderArchive,
+    NullCounterCloseShaderArchive,
+    NullCounterCreateComputePipelineState,
+    NullCounterCreatePipelineState,
+    NullCounterCreatePipelineStateAsync,
+    NullCounterIsPipelineStateReady,
+    NullCounterSetPipelineStateLabel,
+    NullCounterDeletePipelineState,
+    NullCounterCopyDataToGraphicsBuffer,
+    NullCounterCopyDataToTexture,
+    NullCounterCopyTexture,
+    NullCounterTransitionGraphicsBufferToState,
+    NullCounterDispatchThreads,
+    NullCounterBeginRenderPass,
+    NullCounterEndRenderPass,
+    NullCounterSetPipelineState,
+    NullCounterSetShaderResourceHeap,
+    NullCounterSetShader,
+    NullCounterSetShaderParameterValues,
+    NullCounterSetTextureBarrier,
+    NullCounterSetGraphicsBufferBarrier,
+    NullCounterDispatchMesh,
+    NullCounterExecuteIndirect,
+    NullCounterBeginQuery,
+    NullCounterEndQuery,
+    NullCounterResolveQueryData,
+    NullCounterBeginGpuZone,
+    NullCounterEndGpuZone,
+    NullCounterResolveGpuZones,
+    NullCounterUploadedBytes,
+    NullCounterShaderParameterBytes,
+    NullCounterShaderByteCodeBytes,
+    NullCounterHeapBytes,
+    NullCounterCount
+};
+
+static const char* NullGraphicsServiceCounterNames[NullCounterCount] =
+{
+    "GetGraphicsAdapterName",
+    "SetFramesInFlightCount",
+    "GetBufferAllocationInfos",
+    "GetTextureAllocationInfos",
+    "GetMemoryBudget",
+    "CreateCommandQueue",
+    "SetCommandQueueLabel",
+    "DeleteCommandQueue",
+    "ResetCommandQueue",
+    "GetCommandQueueTimestampFrequency",
+    "GetCommandQueueTimestampCalibration",
+    "ExecuteCommandLists",
+    "ExecuteCommandListBatches",
+    "WaitForCommandQueueOnCpu",
+    "CreateCommandList",
+    "SetCommandListLabel",
+    "DeleteCommandList",
+    "ResetCommandList",
+    "CommitCommandList",
+    "CreateGraphicsHeap",
+    "SetGraphicsHeapLabel",
+    "DeleteGraphicsHeap",
+    "CreateShaderResourceHeap",
+    "GetShaderResourceHeapLength",
+    "ResizeShaderResourceHeap",
+    "SetShaderResourceHeapLabel",
+    "DeleteShaderResourceHeap",
+    "CreateShaderResourceTexture",
+    "DeleteShaderResourceTexture",
+    "CreateShaderResourceBuffer",
+    "DeleteShaderResourceBuffer",
+    "CreateShaderResources",
+    "CreateGraphicsBuffer",
+    "SetGraphicsBufferLabel",
+    "DeleteGraphicsBuffer",
+    "GetGraphicsBufferCpuPointer",
+    "ReleaseGraphicsBufferCpuPointer",
+    "CreateTexture",
+    "SetTextureLabel",
+    "DeleteTexture",
+    "CreateSwapChain",
+    "DeleteSwapChain",
+    "ResizeSwapChain",
+    "GetSwapChainBackBufferTexture",
+    "PresentSwapChain",
+    "WaitForSwapChainOnCpu",
+    "CreateQueryBuffer",
+    "ResetQueryBuffer",
+    "SetQueryBufferLabel",
+    "DeleteQueryBuffer",
+    "CreateShader",
+    "CreateShaderFromArchive",
+    "SetShaderLabel",
+    "DeleteShader",
+    "OpenShaderArchive",
+    "CloseShaderArchive",
+    "CreateComputePipelineState",
+    "CreatePipelineState",
+    "CreatePipelineStateAsync",
+    "IsPipelineStateReady",
+    "SetPipelineStateLabel",
+    "DeletePipelineState",
+    "CopyDataToGraphicsBuffer",
+    "CopyDataToTexture",
+    "CopyTexture",
+    "TransitionGraphicsBufferToState",
+    "DispatchThreads",
+    "BeginRenderPass",
+    "EndRenderPass",
+    "SetPipelineState",
+    "SetShaderResourceHeap",
+    "SetShader",
+    "SetShaderParameterValues",
+    "SetTextureBarrier",
+    "SetGraphicsBufferBarrier",
+    "DispatchMesh",
+    "ExecuteIndirect",
+    "BeginQuery",
+    "EndQuery",
+    "ResolveQueryData",
+    "BeginGpuZone",
+    "EndGpuZone",
+    "ResolveGpuZones",
+    "UploadedBytes",
+    "ShaderParameterBytes",
+    "ShaderByteCodeBytes",
+    "HeapBytes"
+};
+
+struct NullCommandQueue
+{
+    GraphicsServiceCommandType CommandQueueType;
+    atomic<uint64_t> FenceValue;
+};
+
+struct NullCommandList
+{
+    NullCommandQueue* CommandQueue;
+    bool IsRenderPassActive;
+    GpuZoneStack GpuZones;
+};
+
+struct NullGraphicsHeap
+{
+    GraphicsServiceHeapType Type;
+    uint64_t SizeInBytes;
+    uint8_t* CpuMemory;
+};
+
+struct NullShaderResourceHeap
+{
+    uint64_t Length;
+};
+
+struct NullGraphicsBuffer
+{
+    NullGraphicsHeap* GraphicsHeap;
+    uint64_t HeapOffset;
+    int SizeInBytes;
+    GraphicsBufferUsage Usage;
+};
+
+struct NullTexture
+{
+    GraphicsTextureFormat TextureFormat;
+    GraphicsTextureUsage Usage;
+    int Width;
+    int Height;
+    int FaceCount;
+    int MipLevels;
+    bool IsPresentTexture;
+};
+
+struct NullSwapChain
+{
+    NullCommandQueue* CommandQueue;
+    NullTexture* BackBufferTextures[NullMaxSwapChainImageCount];
+    uint32_t BackBufferCount;
+    uint32_t CurrentImageIndex;
+    GraphicsPresentMode PresentMode;
+};
+
+struct NullQueryBuffer
+{
+    GraphicsQueryBufferType QueryBufferType;
+    int Length;
+};
+
+struct NullShader
+{
+    bool IsComputeShader;
+};
+
+struct NullPipelineState
+{
+    NullShader* Shader;
+};
+
+// Graphics service that doesn't talk to any GPU. Resources are lightweight handles, upload and readback
+// heaps are backed by host memory and every command is a no-op. Each call and the amount of data sent by
+// the engine are counted so that the CPU cost of the engine can be measured without any driver overhead.
+class NullGraphicsService
+{
+    public:
+        NullGraphicsService();
+        ~NullGraphicsService();
+
+        void GetGraphicsAdapterName(char* output);
+        int SetFramesInFlightCount(int framesInFlightCount);
+        
+        GraphicsAllocationInfos GetBufferAllocationInfos(int sizeInBytes);
+        GraphicsAllocationInfos GetTextureAllocationInfos(enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+        struct GraphicsMemoryBudget GetMemoryBudget(enum GraphicsServiceHeapType heapType);
+
+        void* CreateCommandQueue(enum GraphicsServiceCommandType commandQueueType);
+        void SetCommandQueueLabel(void* commandQueuePointer, char* label);
+        void DeleteCommandQueue(void* commandQueuePointer);
+        void ResetCommandQueue(void* commandQueuePointer);
+        unsigned long GetCommandQueueTimestampFrequency(void* commandQueuePointer);
+        struct GraphicsTimestampCalibration GetCommandQueueTimestampCalibration(void* commandQueuePointer);
+        unsigned long ExecuteCommandLists(void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength);
+        void ExecuteCommandListBatches(struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength);
+        void WaitForCommandQueueOnCpu(struct GraphicsFence fenceToWait);
+
+        void* CreateCommandList(void* commandQueuePointer);
+        void SetCommandListLabel(void* commandListPointer, char* label);
+        void DeleteCommandList(void* commandListPointer);
+        void ResetCommandList(void* commandListPointer);
+        void CommitCommandList(void* commandListPointer);
+
+        void* CreateGraphicsHeap(enum GraphicsServiceHeapType type, unsigned long sizeInBytes);
+        void SetGraphicsHeapLabel(void* graphicsHeapPointer, char* label);
+        void DeleteGraphicsHeap(void* graphicsHeapPointer);
+
+        void* CreateShaderResourceHeap(unsigned long length);
+        unsigned long GetShaderResourceHeapLength(void* shaderResourceHeapPointer);
+        void ResizeShaderResourceHeap(void* shaderResourceHeapPointer, unsigned long length);
+        void SetShaderResourceHeapLabel(void* shaderResourceHeapPointer, char* label);
+        void DeleteShaderResourceHeap(void* shaderResourceHeapPointer);
+        void CreateShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel);
+        void DeleteShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index);
+        void CreateShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable);
+        void DeleteShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index);
+        void CreateShaderResources(void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength);
+
+        void* CreateGraphicsBuffer(void* graphicsHeapPointer, unsigned long heapOffset, GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes);
+        void SetGraphicsBufferLabel(void* graphicsBufferPointer, char* label);
+        void DeleteGraphicsBuffer(void* graphicsBufferPointer);
+        void* GetGraphicsBufferCpuPointer(void* graphicsBufferPointer);
+        void ReleaseGraphicsBufferCpuPointer(void* graphicsBufferPointer);
+
+        void* CreateTexture(void* graphicsHeapPointer, unsigned long heapOffset, int isAliasable, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+        void SetTextureLabel(void* texturePointer, char* label);
+        void DeleteTexture(void* texturePointer);
+
+        void* CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount);
+        void DeleteSwapChain(void* swapChainPointer);
+        void ResizeSwapChain(void* swapChainPointer, int width, int height);
+        void* GetSwapChainBackBufferTexture(void* swapChainPointer);
+        unsigned long PresentSwapChain(void* swapChainPointer);
+        void WaitForSwapChainOnCpu(void* swapChainPointer);
+
+        void* CreateQueryBuffer(enum GraphicsQueryBufferType queryBufferType, int length);
+        void ResetQueryBuffer(void* queryBufferPointer);
+        void SetQueryBufferLabel(void* queryBufferPointer, char* label);
+        void DeleteQueryBuffer(void* queryBufferPointer);
+     
+        void* CreateShader(char* computeShaderFunction, void* shaderByteCode, int shaderByteCodeLength);
+        void* CreateShaderFromArchive(void* shaderArchivePointer, char* shaderName);
+        void SetShaderLabel(void* shaderPointer, char* label);
+        void DeleteShader(void* shaderPointer);
+        void* OpenShaderArchive(char* path);
+        void CloseShaderArchive(void* shaderArchivePointer);
+
+        void* CreateComputePipelineState(void* shaderPointer);
+        void* CreatePipelineState(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor);
+        void* CreatePipelineStateAsync(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState);
+        int IsPipelineStateReady(void* pipelineStatePointer, int waitForCompletion);
+        void SetPipelineStateLabel(void* pipelineStatePointer, char* label);
+        void DeletePipelineState(void* pipelineStatePointer);
+
+        void CopyDataToGraphicsBuffer(void* commandListPointer, void* destinationGraphicsBufferPointer, void* sourceGraphicsBufferPointer, unsigned int sizeInBytes, unsigned int destinationOffsetInBytes, unsigned int sourceOffsetInBytes);
+        void CopyDataToTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceGraphicsBufferPointer, enum GraphicsTextureFormat textureFormat, int width, int height, int slice, int mipLevel);
+        void CopyTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceTexturePointer);
+
+        void TransitionGraphicsBufferToState(void* commandListPointer, void* graphicsBufferPointer, enum GraphicsResourceState resourceState);
+
+        void DispatchThreads(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ);
+
+        void BeginRenderPass(void* commandListPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor);
+        void EndRenderPass(void* commandListPointer);
+
+        void SetPipelineState(void* commandListPointer, void* pipelineStatePointer);
+        void SetShaderResourceHeap(void* commandListPointer, void* shaderResourceHeapPointer);
+        void SetShader(void* commandListPointer, void* shaderPointer);
+        void SetShaderParameterValues(void* commandListPointer, unsigned int slot, unsigned int* values, int valuesLength);
+
+        void SetTextureBarrier(void* commandListPointer, void* texturePointer);
+        void SetGraphicsBufferBarrier(void* commandListPointer, void* graphicsBufferPointer);
+
+        void DispatchMesh(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ);
+        void ExecuteIndirect(void* commandListPointer, unsigned int maxCommandCount, void* commandGraphicsBufferPointer, unsigned int commandBufferOffset);
+
+        void BeginQuery(void* commandListPointer, void* queryBufferPointer, int index);
+        void EndQuery(void* commandListPointer, void* queryBufferPointer, int index);
+        void ResolveQueryData(void* commandListPointer, void* queryBufferPointer, void* destinationBufferPointer, int startIndex, int endIndex);
+        void BeginGpuZone(void* commandListPointer, unsigned int nameId, char* name);
+        void EndGpuZone(void* commandListPointer);
+        int ResolveGpuZones(struct GraphicsGpuZone* gpuZones, int gpuZonesLength);
+
+        void PrintStatistics();
+
+    private:
+        atomic<uint64_t> counters[NullCounterCount];
+        atomic<uint64_t> presentedFrameCount;
+        atomic<uint64_t> gpuMemoryUsage;
+        atomic<uint64_t> systemMemoryUsage;
+        int framesInFlightCount = 2;
+
+        // The zones use the CPU time of the recording as timestamps
+        GpuZoneProfiler gpuZoneProfiler { NullMaxFramesInFlightCount };
+        vector<uint64_t> gpuZoneTimestamps = vector<uint64_t>(gpuZoneProfiler.GetQueryCount());
+
+        inline void IncrementCounter(NullGraphicsServiceCounter counter, uint64_t value = 1)
+        {
+            this->counters[counter].fetch_add(value, memory_order_relaxed);
+        }
+
+        uint64_t ComputeTextureSizeInBytes(enum GraphicsTextureFormat textureFormat, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+};
@@ -0,0 +1,255 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Packed shader archive written by ShaderArchiveWriter in the engine. The file is memory mapped
+// and the shader byte code is read straight from the mapped pages.
+//
+// Layout: header, shader table, entry point table, names and then the byte code ranges. Identical
+// byte code is stored once so entry points can share the same range and content hash.
+// All offsets are relative to the start of the file.
+
+#define ShaderArchiveMagic 0x4B504853
+#define ShaderArchiveVersion 1
+
+enum ShaderStage : uint32_t
+{
+    ShaderStageAmplification,
+    ShaderStageMesh,
+    ShaderStagePixel,
+    ShaderStageCompute,
+    ShaderStageCount,
+    ShaderStageUnknown = 0xFFFFFFFF
+};
+
+struct ShaderArchiveHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t ShaderCount;
+    uint32_t EntryPointCount;
+};
+
+struct ShaderArchiveShader
+{
+    uint64_t NameHash;
+    uint32_t NameOffset;
+    uint32_t NameLength;
+    uint32_t ParameterCount;
+    uint32_t FirstEntryPoint;
+    uint32_t EntryPointCount;
+    uint32_t RootSignatureLength;
+    uint64_t RootSignatureOffset;
+};
+
+struct ShaderArchiveEntryPoint
+{
+    ShaderStage Stage;
+    uint32_t SpirvLength;
+    uint64_t SpirvOffset;
+    uint64_t SpirvHash;
+    uint32_t DxilLength;
+    uint32_t Reserved;
+    uint64_t DxilOffset;
+    uint64_t DxilHash;
+};
+
+struct ShaderArchive
+{
+    const uint8_t* Data;
+    uint64_t SizeInBytes;
+    const ShaderArchiveHeader* Header;
+    const ShaderArchiveShader* Shaders;
+    const ShaderArchiveEntryPoint* EntryPoints;
+};
+
+// FNV-1a, the writer uses the same function for the name and content hashes
+uint64_t ComputeShaderContentHash(const void* data, uint64_t length)
+{
+    auto bytes = (const uint8_t*)data;
+    uint64_t hash = 14695981039346656037ull;
+
+    for (uint64_t i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+ShaderStage GetShaderStage(const char* entryPointName, uint32_t entryPointNameLength)
+{
+    const char* stageEntryPoints[] = { "AmplificationMain", "MeshMain", "PixelMain", "ComputeMain" };
+
+    for (uint32_t i = 0; i < ShaderStageCount; i++)
+    {
+        if (strlen(stageEntryPoints[i]) == entryPointNameLength && memcmp(stageEntryPoints[i], entryPointName, entryPointNameLength) == 0)
+        {
+            return (ShaderStage)i;
+        }
+    }
+
+    return ShaderStageUnknown;
+}
+
+bool IsShaderArchiveRangeValid(const ShaderArchive* shaderArchive, uint64_t offset, uint64_t length)
+{
+    return offset <= shaderArchive->SizeInBytes && length <= shaderArchive->SizeInBytes - offset;
+}
+
+bool IsShaderArchiveValid(const ShaderArchive* shaderArchive)
+{
+    if (shaderArchive->SizeInBytes < sizeof(ShaderArchiveHeader) || shaderArchive->Header->Magic != ShaderArchiveMagic || shaderArchive->Header->Version != ShaderArchiveVersion)
+    {
+        return false;
+    }
+
+    auto shaderTableSize = (uint64_t)shaderArchive->Header->ShaderCount * sizeof(ShaderArchiveShader);
+    auto entryPointTableSize = (uint64_t)shaderArchive->Header->EntryPointCount * sizeof(ShaderArchiveEntryPoint);
+
+    if (!IsShaderArchiveRangeValid(shaderArchive, sizeof(ShaderArchiveHeader), shaderTableSize + entryPointTableSize))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < shaderArchive->Header->ShaderCount; i++)
+    {
+        auto& shader = shaderArchive->Shaders[i];
+
+        if (!IsShaderArchiveRangeValid(shaderArchive, shader.NameOffset, shader.NameLength) ||
+            !IsShaderArchiveRangeValid(shaderArchive, shader.RootSignatureOffset, shader.RootSignatureLength) ||
+            shader.FirstEntryPoint > shaderArchive->Header->EntryPointCount ||
+            shader.EntryPointCount > shaderArchive->Header->EntryPointCount - shader.FirstEntryPoint)
+        {
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < shaderArchive->Header->EntryPointCount; i++)
+    {
+        auto& entryPoint = shaderArchive->EntryPoints[i];
+
+        // SPIR-V words are read in place so the ranges must stay aligned
+        if (!IsShaderArchiveRangeValid(shaderArchive, entryPoint.SpirvOffset, entryPoint.SpirvLength) ||
+            !IsShaderArchiveRangeValid(shaderArchive, entryPoint.DxilOffset, entryPoint.DxilLength) ||
+            (entryPoint.SpirvOffset % sizeof(uint32_t)) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CloseShaderArchiveFile(ShaderArchive* shaderArchive)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(shaderArchive->Data);
+#else
+    munmap((void*)shaderArchive->Data, shaderArchive->SizeInBytes);
+#endif
+
+    delete shaderArchive;
+}
+
+ShaderArchive* OpenShaderArchiveFile(const char* path)
+{
+    void* mappedData = nullptr;
+    uint64_t sizeInBytes = 0;
+
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize = {};
+
+    if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+    {
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mappingHandle != nullptr)
+        {
+            // The view keeps the mapping alive once the handles are closed
+            mappedData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+            sizeInBytes = fileSize.QuadPart;
+            CloseHandle(mappingHandle);
+        }
+    }
+
+    CloseHandle(fileHandle);
+#else
+    int fileDescriptor = open(path, O_RDONLY);
+
+    if (fileDescriptor == -1)
+    {
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+
+    if (fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        mappedData = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        sizeInBytes = fileStat.st_size;
+
+        if (mappedData == MAP_FAILED)
+        {
+            mappedData = nullptr;
+        }
+    }
+
+    close(fileDescriptor);
+#endif
+
+    if (mappedData == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto shaderArchive = new ShaderArchive();
+    shaderArchive->Data = (const uint8_t*)mappedData;
+    shaderArchive->SizeInBytes = sizeInBytes;
+    shaderArchive->Header = (const ShaderArchiveHeader*)shaderArchive->Data;
+    shaderArchive->Shaders = (const ShaderArchiveShader*)(shaderArchive->Data + sizeof(ShaderArchiveHeader));
+    shaderArchive->EntryPoints = (const ShaderArchiveEntryPoint*)(shaderArchive->Shaders + (sizeInBytes >= sizeof(ShaderArchiveHeader) ? shaderArchive->Header->ShaderCount : 0));
+
+    if (!IsShaderArchiveValid(shaderArchive))
+    {
+        printf("ERROR: Shader archive '%s' is invalid.\n", path);
+        CloseShaderArchiveFile(shaderArchive);
+        return nullptr;
+    }
+
+    return shaderArchive;
+}
+
+const ShaderArchiveShader* FindShaderArchiveShader(const ShaderArchive* shaderArchive, const char* shaderName)
+{
+    auto shaderNameLength = (uint32_t)strlen(shaderName);
+    auto shaderNameHash = ComputeShaderContentHash(shaderName, shaderNameLength);
+
+    for (uint32_t i = 0; i < shaderArchive->Header->ShaderCount; i++)
+    {
+        auto shader = &shaderArchive->Shaders[i];
+
+        if (shader->NameHash == shaderNameHash && shader->NameLength == shaderNameLength && memcmp(shaderArchive->Data + shader->NameOffset, shaderName, shaderNameLength) == 0)
+        {
+            return shader;
+        }
+    }
+
+    return nullptr;
+}
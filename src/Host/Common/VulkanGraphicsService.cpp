@@ -0,0 +1,3739 @@
+#pragma once
+#include "VulkanGraphicsService.h"
+#include "VulkanGraphicsServiceUtils.h"
+
+VulkanGraphicsService::VulkanGraphicsService()
+{
+    AssertIfFailed(volkInitialize());
+
+    this->vulkanInstance = CreateVulkanInstance();
+    volkLoadInstance(this->vulkanInstance);
+
+    this->graphicsPhysicalDevice = FindGraphicsDevice();
+    this->graphicsDevice = CreateDevice(this->graphicsPhysicalDevice);
+    volkLoadDevice(this->graphicsDevice);
+
+    if (this->isDescriptorBufferSupported)
+    {
+        LoadDescriptorBufferFunctions(this->graphicsDevice);
+        globalUseDescriptorBuffer = true;
+    }
+
+    this->pipelineCache = CreatePipelineCache();
+
+    // Shader resource heaps share one index space for all the descriptor types so their length is
+    // bounded by the smallest limit, the two storage buffer sets count twice
+    this->descriptorBufferProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+
+    VkPhysicalDeviceVulkan12Properties properties12 = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES };
+    properties12.pNext = this->isDescriptorBufferSupported ? &this->descriptorBufferProperties : nullptr;
+
+    VkPhysicalDeviceProperties2 properties = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2 };
+    properties.pNext = &properties12;
+    vkGetPhysicalDeviceProperties2(this->graphicsPhysicalDevice, &properties);
+
+    this->nonCoherentAtomSize = properties.properties.limits.nonCoherentAtomSize;
+
+    uint32_t descriptorLimits[]
+    {
+        VulkanMaxShaderResourceHeapLength,
+        properties12.maxPerStageDescriptorUpdateAfterBindStorageBuffers / 2,
+        properties12.maxPerStageDescriptorUpdateAfterBindSampledImages,
+        properties12.maxPerStageDescriptorUpdateAfterBindStorageImages,
+        properties12.maxPerStageUpdateAfterBindResources / VulkanDescriptorSetLayoutCount,
+        properties12.maxDescriptorSetUpdateAfterBindStorageBuffers / 2,
+        properties12.maxDescriptorSetUpdateAfterBindSampledImages,
+        properties12.maxDescriptorSetUpdateAfterBindStorageImages
+    };
+
+    this->maxShaderResourceHeapLength = VulkanMaxShaderResourceHeapLength;
+
+    for (uint32_t i = 0; i < ARRAYSIZE(descriptorLimits); i++)
+    {
+        this->maxShaderResourceHeapLength = descriptorLimits[i] < this->maxShaderResourceHeapLength ? descriptorLimits[i] : this->maxShaderResourceHeapLength;
+    }
+
+    if (this->isDescriptorBufferSupported)
+    {
+        // All the resource sets of a heap are stored in the same descriptor buffer
+        auto slotSizeInBytes = 2 * this->descriptorBufferProperties.storageBufferDescriptorSize + this->descriptorBufferProperties.sampledImageDescriptorSize + this->descriptorBufferProperties.storageImageDescriptorSize;
+        auto maxDescriptorBufferLength = this->descriptorBufferProperties.maxResourceDescriptorBufferRange / slotSizeInBytes;
+
+        this->maxShaderResourceHeapLength = maxDescriptorBufferLength < this->maxShaderResourceHeapLength ? (uint32_t)maxDescriptorBufferLength : this->maxShaderResourceHeapLength;
+    }
+
+    globalResourceDescriptorCount = this->maxShaderResourceHeapLength;
+
+    // The global layouts are created upfront because pipeline layouts are also created
+    // by the pipeline compiler threads
+    GetGlobalBufferLayout(this->graphicsDevice);
+    GetGlobalTextureLayout(this->graphicsDevice);
+    GetGlobalUavBufferLayout(this->graphicsDevice);
+    GetGlobalUavTextureLayout(this->graphicsDevice);
+    GetGlobalSamplerLayout(this->graphicsDevice);
+
+    if (this->isDescriptorBufferSupported)
+    {
+        VkDescriptorSetLayout globalLayouts[] { globalBufferLayout, globalTextureLayout, globalUavBufferLayout, globalUavTextureLayout, globalSamplerLayout };
+
+        for (uint32_t i = 0; i < VulkanDescriptorSetLayoutCount; i++)
+        {
+            vkGetDescriptorSetLayoutBindingOffsetEXT(this->graphicsDevice, globalLayouts[i], 0, &this->descriptorBufferBindingOffsets[i]);
+        }
+    }
+
+    this->submitInfos.reserve(16);
+    this->submitCommandBufferInfos.reserve(64);
+    this->submitSemaphoreInfos.reserve(64);
+
+    VkQueryPoolCreateInfo gpuZoneQueryPoolCreateInfo = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+    gpuZoneQueryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    gpuZoneQueryPoolCreateInfo.queryCount = this->gpuZoneProfiler.GetQueryCount();
+
+    AssertIfFailed(vkCreateQueryPool(this->graphicsDevice, &gpuZoneQueryPoolCreateInfo, nullptr, &this->gpuZoneQueryPool));
+    vkResetQueryPool(this->graphicsDevice, this->gpuZoneQueryPool, 0, gpuZoneQueryPoolCreateInfo.queryCount);
+
+    // Each result is followed by its availability value
+    this->gpuZoneQueryResults.resize(GpuZoneMaxCountPerFrame * 2 * 2);
+    this->gpuZoneTimestamps.resize(GpuZoneMaxCountPerFrame * 2);
+
+    if (!this->isCalibratedTimestampsSupported)
+    {
+        VkQueryPoolCreateInfo calibrationQueryPoolCreateInfo = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+        calibrationQueryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        calibrationQueryPoolCreateInfo.queryCount = 1;
+
+        AssertIfFailed(vkCreateQueryPool(this->graphicsDevice, &calibrationQueryPoolCreateInfo, nullptr, &this->calibrationQueryPool));
+    }
+
+#ifdef DEBUG
+    RegisterDebugCallback();
+#endif
+}
+
+VulkanGraphicsService::~VulkanGraphicsService()
+{
+    this->pipelineCompilerThreadPool.Stop();
+
+    if (this->graphicsDevice != nullptr)
+    {
+        AssertIfFailed(vkDeviceWaitIdle(this->graphicsDevice));
+        ProcessDeferredDeletes(true);
+
+        if (this->pipelineCache != nullptr)
+        {
+            SavePipelineCache();
+            vkDestroyPipelineCache(this->graphicsDevice, this->pipelineCache, nullptr);
+        }
+
+        for (auto& cacheEntry : this->frameBufferCache)
+        {
+            vkDestroyFramebuffer(this->graphicsDevice, cacheEntry.second, nullptr);
+        }
+
+        if (this->gpuZoneQueryPool != nullptr)
+        {
+            vkDestroyQueryPool(this->graphicsDevice, this->gpuZoneQueryPool, nullptr);
+        }
+
+        if (this->calibrationQueryPool != nullptr)
+        {
+            vkDestroyQueryPool(this->graphicsDevice, this->calibrationQueryPool, nullptr);
+        }
+
+        for (auto& cacheEntry : this->pipelineStateCache)
+        {
+            vkDestroyPipeline(this->graphicsDevice, cacheEntry.second->PipelineStateObject, nullptr);
+            delete cacheEntry.second;
+        }
+
+        for (auto& cacheEntry : this->renderPassCache)
+        {
+            vkDestroyRenderPass(this->graphicsDevice, cacheEntry.second.RenderPass, nullptr);
+        }
+
+        for (auto& cacheEntry : this->pipelineLayoutCache)
+        {
+            vkDestroyPipelineLayout(this->graphicsDevice, cacheEntry.second.PipelineLayoutObject, nullptr);
+        }
+
+        for (auto& cacheEntry : this->shaderModuleCache)
+        {
+            vkDestroyShaderModule(this->graphicsDevice, cacheEntry.second.ShaderModuleObject, nullptr);
+        }
+
+        // The global layouts are shared by all the shader resource heaps and pipeline layouts
+        VkDescriptorSetLayout* globalLayouts[] { &globalBufferLayout, &globalTextureLayout, &globalUavBufferLayout, &globalUavTextureLayout, &globalSamplerLayout };
+
+        for (uint32_t i = 0; i < ARRAYSIZE(globalLayouts); i++)
+        {
+            if (*globalLayouts[i] != nullptr)
+            {
+                vkDestroyDescriptorSetLayout(this->graphicsDevice, *globalLayouts[i], nullptr);
+                *globalLayouts[i] = nullptr;
+            }
+        }
+
+        vkDestroyDevice(this->graphicsDevice, nullptr);
+    }
+
+    if (this->debugCallback != nullptr)
+    {
+        vkDestroyDebugReportCallbackEXT(this->vulkanInstance, this->debugCallback, nullptr);
+    }
+
+    if (this->vulkanInstance != nullptr)
+    {
+        vkDestroyInstance(this->vulkanInstance, nullptr);
+    }
+}
+
+void VulkanGraphicsService::GetGraphicsAdapterName(char* output)
+{
+    this->deviceName.copy(output, this->deviceName.length());
+}
+
+int VulkanGraphicsService::SetFramesInFlightCount(int framesInFlightCount)
+{
+    // NOTE: This must be called before the swap chain is created
+    this->framesInFlightCount = framesInFlightCount < 1 ? 1 : (framesInFlightCount > VulkanMaxFramesInFlightCount ? VulkanMaxFramesInFlightCount : framesInFlightCount);
+    this->currentCommandPoolIndex = 0;
+    this->gpuZoneProfiler.SetFramesInFlightCount(this->framesInFlightCount);
+
+    return this->framesInFlightCount;
+}
+
+GraphicsAllocationInfos VulkanGraphicsService::GetBufferAllocationInfos(int sizeInBytes)
+{
+	VkBufferCreateInfo createInfo = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    createInfo.size = sizeInBytes;
+    createInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+    VkBuffer buffer = nullptr;
+    AssertIfFailed(vkCreateBuffer(this->graphicsDevice, &createInfo, nullptr, &buffer));
+
+    VkMemoryRequirements memoryRequirements = {};
+    vkGetBufferMemoryRequirements(this->graphicsDevice, buffer, &memoryRequirements);
+
+    GraphicsAllocationInfos result = {};
+	result.SizeInBytes = memoryRequirements.size;
+	result.Alignment = memoryRequirements.alignment;
+
+    vkDestroyBuffer(this->graphicsDevice, buffer, nullptr);
+
+	return result;
+}
+
+GraphicsAllocationInfos VulkanGraphicsService::GetTextureAllocationInfos(enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+    // TODO: Avoid the creation of an image here
+    VkImage tmpImage = CreateImage(this->graphicsDevice, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
+
+    VkMemoryRequirements memoryRequirements = {};
+    vkGetImageMemoryRequirements(this->graphicsDevice, tmpImage, &memoryRequirements);
+
+    vkDestroyImage(this->graphicsDevice, tmpImage, nullptr);
+
+    GraphicsAllocationInfos result = {};
+	result.SizeInBytes = memoryRequirements.size;
+	result.Alignment = memoryRequirements.alignment;
+	return result;
+}
+
+GraphicsMemoryBudget VulkanGraphicsService::GetMemoryBudget(enum GraphicsServiceHeapType heapType)
+{
+    auto heapIndex = this->deviceMemoryProperties.memoryTypes[GetMemoryTypeIndex(heapType)].heapIndex;
+
+    GraphicsMemoryBudget result = {};
+
+    if (this->isMemoryBudgetSupported)
+    {
+        // The budget includes the memory used by the other processes
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT };
+
+        VkPhysicalDeviceMemoryProperties2 memoryProperties = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2 };
+        memoryProperties.pNext = &budgetProperties;
+        vkGetPhysicalDeviceMemoryProperties2(this->graphicsPhysicalDevice, &memoryProperties);
+
+        result.BudgetInBytes = budgetProperties.heapBudget[heapIndex];
+        result.UsageInBytes = budgetProperties.heapUsage[heapIndex];
+    }
+
+    else
+    {
+        // Without the extension only the heaps of the engine are known so 80% of the memory heap is used as the budget
+        result.BudgetInBytes = this->deviceMemoryProperties.memoryHeaps[heapIndex].size / 10 * 8;
+        result.UsageInBytes = this->memoryHeapUsages[heapIndex];
+    }
+
+    return result;
+}
+
+void* VulkanGraphicsService::CreateCommandQueue(enum GraphicsServiceCommandType commandQueueType)
+{
+    VulkanCommandQueue* commandQueue = new VulkanCommandQueue();
+    commandQueue->IsCopyCommandQueue = false;
+    commandQueue->ShaderStages = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR | (this->isMeshShaderSupported ? VK_PIPELINE_STAGE_2_TASK_SHADER_BIT_NV | VK_PIPELINE_STAGE_2_MESH_SHADER_BIT_NV : VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT_KHR);
+
+    uint32_t queueFamilyIndex = this->renderCommandQueueFamilyIndex;
+
+    if (commandQueueType == GraphicsServiceCommandType::Compute)
+    {
+        queueFamilyIndex = this->computeCommandQueueFamilyIndex;
+        commandQueue->IsComputeCommandQueue = true;
+        commandQueue->ShaderStages = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR;
+    }
+
+    else if (commandQueueType == GraphicsServiceCommandType::Copy)
+    {
+        queueFamilyIndex = this->copyCommandQueueFamilyIndex;
+        commandQueue->IsCopyCommandQueue = true;
+        commandQueue->ShaderStages = VK_PIPELINE_STAGE_2_NONE_KHR;
+    }
+
+    commandQueue->CommandQueueFamilyIndex = queueFamilyIndex;
+
+    vkGetDeviceQueue(this->graphicsDevice, queueFamilyIndex, 0, &commandQueue->CommandQueueObject);
+
+    VkSemaphoreTypeCreateInfo timelineCreateInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO };
+    timelineCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    timelineCreateInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo createInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+    createInfo.pNext = &timelineCreateInfo;
+
+    AssertIfFailed(vkCreateSemaphore(this->graphicsDevice, &createInfo, NULL, &commandQueue->TimelineSemaphore));
+
+    lock_guard<mutex> lock(this->deferredDeletesLock);
+    commandQueue->QueueIndex = UINT32_MAX;
+
+    for (uint32_t i = 0; i < VulkanMaxCommandQueueCount; i++)
+    {
+        if (this->commandQueues[i] == nullptr)
+        {
+            this->commandQueues[i] = commandQueue;
+            commandQueue->QueueIndex = i;
+            break;
+        }
+    }
+
+    assert(commandQueue->QueueIndex != UINT32_MAX);
+    return commandQueue;
+}
+
+void VulkanGraphicsService::SetCommandQueueLabel(void* commandQueuePointer, char* label)
+{
+    #ifdef DEBUG 
+    // The command pools are created later by the recording threads so they are labeled at creation
+    VulkanCommandQueue* commandQueue = (VulkanCommandQueue*)commandQueuePointer;
+    commandQueue->Label = label;
+    #endif
+}
+void VulkanGraphicsService::DeleteCommandQueue(void* commandQueuePointer)
+{ 
+    VulkanCommandQueue* commandQueue = (VulkanCommandQueue*)commandQueuePointer;
+
+    if (commandQueue->FenceValue > 0)
+    {
+        VkSemaphoreWaitInfo waitInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &commandQueue->TimelineSemaphore;
+        waitInfo.pValues = &commandQueue->FenceValue;
+
+        AssertIfFailed(vkWaitSemaphores(this->graphicsDevice, &waitInfo, UINT64_MAX));
+    }
+
+    {
+        lock_guard<mutex> lock(this->submitLock);
+
+        for (auto& ownershipTransfer : commandQueue->OwnershipTransfers)
+        {
+            GetOwnershipTransferQueue(ownershipTransfer) = nullptr;
+        }
+    }
+
+    {
+        // The queue has completed all its work so the pending deletes don't depend on it anymore
+        lock_guard<mutex> lock(this->deferredDeletesLock);
+        this->commandQueues[commandQueue->QueueIndex] = nullptr;
+
+        for (uint32_t i = 0; i < this->deferredDeletes.size(); i++)
+        {
+            this->deferredDeletes[i].FenceValues[commandQueue->QueueIndex] = 0;
+        }
+    }
+    
+    for (int i = 0; i < VulkanMaxFramesInFlightCount; i++)
+    {
+        for (int j = 0; j < VulkanMaxThreadCount; j++)
+        {
+            VulkanCommandPool* commandPool = commandQueue->CommandPools[i][j];
+
+            if (commandPool != nullptr)
+            {
+                vkDestroyCommandPool(this->graphicsDevice, commandPool->CommandPoolObject, nullptr);
+                delete commandPool;
+            }
+        }
+    }
+
+    vkDestroySemaphore(this->graphicsDevice, commandQueue->TimelineSemaphore, nullptr);
+
+    delete commandQueue;
+}
+
+void VulkanGraphicsService::ResetCommandQueue(void* commandQueuePointer)
+{
+    // NOTE: This must be called when no thread is recording a command list for this queue
+    VulkanCommandQueue* commandQueue = (VulkanCommandQueue*)commandQueuePointer;
+    VulkanCommandPool** commandPools = commandQueue->CommandPools[this->currentCommandPoolIndex];
+
+    // The command buffers of the pools can only be recycled when the GPU has finished
+    // the last submission that used them
+    uint64_t fenceValue = 0;
+
+    for (int i = 0; i < VulkanMaxThreadCount; i++)
+    {
+        if (commandPools[i] != nullptr && commandPools[i]->FenceValue > fenceValue)
+        {
+            fenceValue = commandPools[i]->FenceValue;
+        }
+    }
+
+    uint64_t completedFenceValue = 0;
+    AssertIfFailed(vkGetSemaphoreCounterValue(this->graphicsDevice, commandQueue->TimelineSemaphore, &completedFenceValue));
+
+    if (completedFenceValue < fenceValue)
+    {
+        VkSemaphoreWaitInfo waitInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &commandQueue->TimelineSemaphore;
+        waitInfo.pValues = &fenceValue;
+
+        AssertIfFailed(vkWaitSemaphores(this->graphicsDevice, &waitInfo, UINT64_MAX));
+    }
+
+    for (int i = 0; i < VulkanMaxThreadCount; i++)
+    {
+        if (commandPools[i] != nullptr && commandPools[i]->UsedCommandBufferCount > 0)
+        {
+            AssertIfFailed(vkResetCommandPool(this->graphicsDevice, commandPools[i]->CommandPoolObject, 0));
+            commandPools[i]->UsedCommandBufferCount = 0;
+        }
+    }
+}
+
+unsigned long VulkanGraphicsService::GetCommandQueueTimestampFrequency(void* commandQueuePointer)
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(this->graphicsPhysicalDevice, &properties);
+
+    // The timestamp period is the number of nanoseconds per tick
+    return (unsigned long)(1000000000.0 / properties.limits.timestampPeriod);
+}
+
+struct GraphicsTimestampCalibration VulkanGraphicsService::GetCommandQueueTimestampCalibration(void* commandQueuePointer)
+{
+    VulkanCommandQueue* commandQueue = (VulkanCommandQueue*)commandQueuePointer;
+
+    if (!this->isCalibratedTimestampsSupported)
+    {
+        return EstimateTimestampCalibration(commandQueue);
+    }
+
+    // All the queues share the device time domain
+    VkCalibratedTimestampInfoEXT timestampInfos[2] = { { VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT }, { VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT } };
+    timestampInfos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+    timestampInfos[1].timeDomain = VulkanHostTimeDomain;
+
+    uint64_t timestamps[2] = {};
+    uint64_t maxDeviation = 0;
+    AssertIfFailed(vkGetCalibratedTimestampsEXT(this->graphicsDevice, 2, timestampInfos, timestamps, &maxDeviation));
+
+    GraphicsTimestampCalibration result = {};
+    result.GpuTimestamp = timestamps[0];
+    result.CpuTimestamp = timestamps[1];
+    result.MaxDeviation = maxDeviation;
+
+    return result;
+}
+
+unsigned long VulkanGraphicsService::ExecuteCommandLists(void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength)
+{
+    GraphicsCommandListBatch batch = {};
+    batch.CommandQueuePointer = commandQueuePointer;
+    batch.CommandLists = commandLists;
+    batch.CommandListsLength = commandListsLength;
+    batch.FencesToWait = fencesToWait;
+    batch.FencesToWaitLength = fencesToWaitLength;
+    batch.BatchIndexToWait = -1;
+
+    GraphicsFence fence = {};
+    ExecuteCommandListBatches(&batch, 1, &fence, 1);
+
+    return fence.Value;
+}
+
+void VulkanGraphicsService::ExecuteCommandListBatches(struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength)
+{
+    assert(fencesLength >= batchesLength);
+    lock_guard<mutex> lock(this->submitLock);
+
+    int startBatchIndex = 0;
+
+    while (startBatchIndex < batchesLength)
+    {
+        // Consecutive batches for the same queue are sent with one submit call
+        VulkanCommandQueue* commandQueue = (VulkanCommandQueue*)batches[startBatchIndex].CommandQueuePointer;
+        int endBatchIndex = startBatchIndex + 1;
+
+        while (endBatchIndex < batchesLength && batches[endBatchIndex].CommandQueuePointer == commandQueue)
+        {
+            endBatchIndex++;
+        }
+
+        uint32_t commandBufferCount = 0;
+        uint32_t semaphoreCount = 0;
+
+        for (int i = startBatchIndex; i < endBatchIndex; i++)
+        {
+            // Each waited queue can add an ownership release, each batch an ownership acquire and
+            // each command list the transitions to the first state of its resources
+            commandBufferCount += batches[i].CommandListsLength * 2 + 1;
+            semaphoreCount += batches[i].FencesToWaitLength * 2 + 3;
+        }
+
+        // Room for the pending swap chain acquire semaphore
+        semaphoreCount++;
+
+        // The capacity is reserved upfront so that the pointers stored in the submit infos stay valid
+        this->submitInfos.clear();
+        this->submitCommandBufferInfos.clear();
+        this->submitSemaphoreInfos.clear();
+
+        this->submitInfos.reserve(endBatchIndex - startBatchIndex);
+        this->submitCommandBufferInfos.reserve(commandBufferCount);
+        this->submitSemaphoreInfos.reserve(semaphoreCount);
+
+        for (int i = startBatchIndex; i < endBatchIndex; i++)
+        {
+            auto batch = batches[i];
+
+            VulkanCommandList acquireCommandList = {};
+            acquireCommandList.CommandQueue = commandQueue;
+
+            VkSubmitInfo2KHR submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR };
+            submitInfo.pWaitSemaphoreInfos = this->submitSemaphoreInfos.data() + this->submitSemaphoreInfos.size();
+
+            if (commandQueue->AcquireSemaphoreToWait != nullptr)
+            {
+                AddSubmitSemaphore(commandQueue->AcquireSemaphoreToWait, 0);
+                commandQueue->AcquireSemaphoreToWait = nullptr;
+            }
+
+            for (int j = 0; j < batch.FencesToWaitLength; j++)
+            {
+                VulkanCommandQueue* commandQueueToWait = (VulkanCommandQueue*)batch.FencesToWait[j].CommandQueuePointer;
+                AddSubmitSemaphore(commandQueueToWait->TimelineSemaphore, batch.FencesToWait[j].Value);
+                TransferQueueOwnership(commandQueueToWait, &acquireCommandList);
+            }
+
+            if (batch.BatchIndexToWait >= 0)
+            {
+                assert(batch.BatchIndexToWait < i);
+
+                VulkanCommandQueue* commandQueueToWait = (VulkanCommandQueue*)fences[batch.BatchIndexToWait].CommandQueuePointer;
+                AddSubmitSemaphore(commandQueueToWait->TimelineSemaphore, fences[batch.BatchIndexToWait].Value);
+                TransferQueueOwnership(commandQueueToWait, &acquireCommandList);
+            }
+
+            submitInfo.waitSemaphoreInfoCount = (uint32_t)(this->submitSemaphoreInfos.data() + this->submitSemaphoreInfos.size() - submitInfo.pWaitSemaphoreInfos);
+
+            const uint64_t signalValue = commandQueue->FenceValue + 1;
+            commandQueue->FenceValue = signalValue;
+
+            fences[i].CommandQueuePointer = commandQueue;
+            fences[i].Value = signalValue;
+
+            submitInfo.pSignalSemaphoreInfos = this->submitSemaphoreInfos.data() + this->submitSemaphoreInfos.size();
+            submitInfo.signalSemaphoreInfoCount = 1;
+            AddSubmitSemaphore(commandQueue->TimelineSemaphore, signalValue);
+
+            submitInfo.pCommandBufferInfos = this->submitCommandBufferInfos.data() + this->submitCommandBufferInfos.size();
+            submitInfo.commandBufferInfoCount = batch.CommandListsLength;
+
+            if (acquireCommandList.CommandBufferObject != nullptr)
+            {
+                CommitCommandList(&acquireCommandList);
+                acquireCommandList.CommandPool->FenceValue = signalValue;
+
+                VkCommandBufferSubmitInfoKHR commandBufferInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR };
+                commandBufferInfo.commandBuffer = acquireCommandList.CommandBufferObject;
+
+                this->submitCommandBufferInfos.push_back(commandBufferInfo);
+                submitInfo.commandBufferInfoCount++;
+            }
+
+            for (int j = 0; j < batch.CommandListsLength; j++)
+            {
+                VulkanCommandList* vulkanCommandList = (VulkanCommandList*)batch.CommandLists[j];
+                vulkanCommandList->CommandPool->FenceValue = signalValue;
+
+                // The state left by the previous command lists is known now that they are submitted in order
+                ResolveResourceStates(vulkanCommandList, this->submitBufferBarriers, this->submitTextureBarriers);
+
+                if (!this->submitBufferBarriers.empty() || !this->submitTextureBarriers.empty())
+                {
+                    VulkanCommandList transitionCommandList = {};
+                    transitionCommandList.CommandQueue = commandQueue;
+                    BeginCommandBuffer(&transitionCommandList);
+
+                    // The barrier arrays are swapped back once flushed so that their capacity is reused
+                    transitionCommandList.BufferBarriers.swap(this->submitBufferBarriers);
+                    transitionCommandList.TextureBarriers.swap(this->submitTextureBarriers);
+                    CommitCommandList(&transitionCommandList);
+                    transitionCommandList.BufferBarriers.swap(this->submitBufferBarriers);
+                    transitionCommandList.TextureBarriers.swap(this->submitTextureBarriers);
+
+                    transitionCommandList.CommandPool->FenceValue = signalValue;
+
+                    VkCommandBufferSubmitInfoKHR transitionCommandBufferInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR };
+                    transitionCommandBufferInfo.commandBuffer = transitionCommandList.CommandBufferObject;
+
+                    this->submitCommandBufferInfos.push_back(transitionCommandBufferInfo);
+                    submitInfo.commandBufferInfoCount++;
+                }
+
+                MoveOwnershipTransfers(vulkanCommandList);
+
+                VkCommandBufferSubmitInfoKHR commandBufferInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR };
+                commandBufferInfo.commandBuffer = vulkanCommandList->CommandBufferObject;
+
+                this->submitCommandBufferInfos.push_back(commandBufferInfo);
+            }
+
+            this->submitInfos.push_back(submitInfo);
+        }
+
+        AssertIfFailed(vkQueueSubmit2KHR(commandQueue->CommandQueueObject, (uint32_t)this->submitInfos.size(), this->submitInfos.data(), VK_NULL_HANDLE));
+        startBatchIndex = endBatchIndex;
+    }
+}
+
+void VulkanGraphicsService::WaitForCommandQueueOnCpu(struct GraphicsFence fenceToWait)
+{
+    VulkanCommandQueue* commandQueueToWait = (VulkanCommandQueue*)fenceToWait.CommandQueuePointer;
+    const uint64_t waitValue = fenceToWait.Value;
+
+    VkSemaphoreWaitInfo waitInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &commandQueueToWait->TimelineSemaphore;
+    waitInfo.pValues = &waitValue;
+
+    AssertIfFailed(vkWaitSemaphores(this->graphicsDevice, &waitInfo, UINT64_MAX));
+}
+
+void* VulkanGraphicsService::CreateCommandList(void* commandQueuePointer)
+{
+    VulkanCommandQueue* commandQueue = (VulkanCommandQueue*)commandQueuePointer;
+
+    VulkanCommandList* commandList = new VulkanCommandList();
+	commandList->CommandQueue = commandQueue;
+
+    BeginCommandBuffer(commandList);
+
+    return commandList;
+}
+
+void VulkanGraphicsService::SetCommandListLabel(void* commandListPointer, char* label)
+{ 
+    #ifdef DEBUG 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+
+    VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+    nameInfo.objectType = VK_OBJECT_TYPE_COMMAND_BUFFER;
+    nameInfo.objectHandle = (uint64_t)commandList->CommandBufferObject;
+    nameInfo.pObjectName = label;
+
+    AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    #endif
+}
+
+void VulkanGraphicsService::DeleteCommandList(void* commandListPointer)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    delete commandList;
+}
+
+void VulkanGraphicsService::ResetCommandList(void* commandListPointer)
+{
+    // The previous command buffer can still be in use by the GPU so we take a new one from
+    // the current frame pool. It will be recycled when the pool is reset in ResetCommandQueue.
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    BeginCommandBuffer(commandList);
+}
+
+void VulkanGraphicsService::CommitCommandList(void* commandListPointer)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    assert(commandList->GpuZones.Depth == 0);
+
+    FlushBarriers(commandList);
+    AssertIfFailed(vkEndCommandBuffer(commandList->CommandBufferObject));
+}
+
+void* VulkanGraphicsService::CreateGraphicsHeap(enum GraphicsServiceHeapType type, unsigned long sizeInBytes)
+{
+    VkMemoryAllocateInfo allocateInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+    allocateInfo.allocationSize = sizeInBytes;
+    allocateInfo.memoryTypeIndex = GetMemoryTypeIndex(type);
+
+    // Buffers need a device address to be referenced by a descriptor buffer
+    VkMemoryAllocateFlagsInfo allocateFlagsInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO };
+    allocateFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
+    if (this->isDescriptorBufferSupported)
+    {
+        allocateInfo.pNext = &allocateFlagsInfo;
+    }
+
+    VulkanGraphicsHeap* graphicsHeap = new VulkanGraphicsHeap();
+    graphicsHeap->Type = type;
+    graphicsHeap->SizeInBytes = sizeInBytes;
+
+    AssertIfFailed(vkAllocateMemory(this->graphicsDevice, &allocateInfo, nullptr, &graphicsHeap->DeviceMemory));
+    this->memoryHeapUsages[this->deviceMemoryProperties.memoryTypes[allocateInfo.memoryTypeIndex].heapIndex] += sizeInBytes;
+
+    auto memoryPropertyFlags = this->deviceMemoryProperties.memoryTypes[allocateInfo.memoryTypeIndex].propertyFlags;
+    graphicsHeap->IsCoherent = (memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+    graphicsHeap->CpuPointer = nullptr;
+
+    // The memory is implicitly unmapped when it is freed
+    if (type != GraphicsServiceHeapType::Gpu)
+    {
+        AssertIfFailed(vkMapMemory(this->graphicsDevice, graphicsHeap->DeviceMemory, 0, VK_WHOLE_SIZE, 0, (void**)&graphicsHeap->CpuPointer));
+    }
+
+    return graphicsHeap;
+}
+
+void VulkanGraphicsService::SetGraphicsHeapLabel(void* graphicsHeapPointer, char* label)
+{ 
+    #ifdef DEBUG 
+    VulkanGraphicsHeap* graphicsHeap = (VulkanGraphicsHeap*)graphicsHeapPointer;
+
+    VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+    nameInfo.objectType = VK_OBJECT_TYPE_DEVICE_MEMORY;
+    nameInfo.objectHandle = (uint64_t)graphicsHeap->DeviceMemory;
+    nameInfo.pObjectName = label;
+
+    AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    #endif
+}
+
+void VulkanGraphicsService::DeleteGraphicsHeap(void* graphicsHeapPointer)
+{ 
+    VulkanGraphicsHeap* graphicsHeap = (VulkanGraphicsHeap*)graphicsHeapPointer;
+    DeferDelete(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)graphicsHeap->DeviceMemory);
+
+    this->memoryHeapUsages[this->deviceMemoryProperties.memoryTypes[GetMemoryTypeIndex(graphicsHeap->Type)].heapIndex] -= graphicsHeap->SizeInBytes;
+
+    delete graphicsHeap;
+}
+
+void* VulkanGraphicsService::CreateShaderResourceHeap(unsigned long length)
+{
+    VulkanShaderResourceHeap* resourceHeap = new VulkanShaderResourceHeap();
+
+    // TODO: Don't allocate the sampler like that
+    // TODO: Try to use the static samplers of vulkan that can be attached to the pipeline state
+    // TODO: Get the static sampler info from the shader binary file
+    VkSamplerCreateInfo samplerCreateInfo = { VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+    samplerCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerCreateInfo.minFilter = VK_FILTER_NEAREST;
+    samplerCreateInfo.magFilter = VK_FILTER_NEAREST;
+    samplerCreateInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerCreateInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+
+    // TODO: Use that for the min reduction samplers
+    // This will be done when parsing from the shader root signature
+    VkSamplerReductionModeCreateInfo redutionCreateInfo = {};
+
+    AssertIfFailed(vkCreateSampler(this->graphicsDevice, &samplerCreateInfo, nullptr, &resourceHeap->Sampler));
+
+    AllocateShaderResourceHeapSets(resourceHeap, length < this->maxShaderResourceHeapLength ? (uint32_t)length : this->maxShaderResourceHeapLength);
+    return resourceHeap;
+}
+
+unsigned long VulkanGraphicsService::GetShaderResourceHeapLength(void* shaderResourceHeapPointer)
+{
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    return shaderResourceHeap->Length;
+}
+
+void VulkanGraphicsService::ResizeShaderResourceHeap(void* shaderResourceHeapPointer, unsigned long length)
+{
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    auto heapLength = length < this->maxShaderResourceHeapLength ? (uint32_t)length : this->maxShaderResourceHeapLength;
+
+    if (heapLength <= shaderResourceHeap->Length)
+    {
+        return;
+    }
+
+    // Command buffers already recorded keep using the old sets until the GPU is done with them
+    ReleaseShaderResourceHeapSets(shaderResourceHeap);
+    AllocateShaderResourceHeapSets(shaderResourceHeap, heapLength);
+
+    vector<uint32_t> indexes;
+
+    for (uint32_t i = 0; i < shaderResourceHeap->Descriptors.size(); i++)
+    {
+        if (shaderResourceHeap->Descriptors[i].ResourcePointer != nullptr)
+        {
+            indexes.push_back(i);
+        }
+    }
+
+    WriteShaderResourceDescriptors(shaderResourceHeap, indexes.data(), (uint32_t)indexes.size());
+}
+
+void VulkanGraphicsService::SetShaderResourceHeapLabel(void* shaderResourceHeapPointer, char* label)
+{ 
+    #ifdef DEBUG 
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+
+    VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+    nameInfo.objectType = this->isDescriptorBufferSupported ? VK_OBJECT_TYPE_BUFFER : VK_OBJECT_TYPE_DESCRIPTOR_POOL;
+    nameInfo.objectHandle = this->isDescriptorBufferSupported ? (uint64_t)shaderResourceHeap->ResourceDescriptorBuffer : (uint64_t)shaderResourceHeap->DescriptorPool;
+    nameInfo.pObjectName = label;
+
+    AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    #endif
+}
+
+void VulkanGraphicsService::DeleteShaderResourceHeap(void* shaderResourceHeapPointer)
+{ 
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    ReleaseShaderResourceHeapSets(shaderResourceHeap);
+    DeferDelete(VK_OBJECT_TYPE_SAMPLER, (uint64_t)shaderResourceHeap->Sampler);
+
+    delete shaderResourceHeap;
+}
+
+void VulkanGraphicsService::CreateShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel)
+{ 
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    assert(index < shaderResourceHeap->Length);
+
+    shaderResourceHeap->Descriptors[index] = { texturePointer, true, isWriteable != 0, mipLevel };
+    WriteShaderResourceDescriptors(shaderResourceHeap, &index, 1);
+}
+
+void VulkanGraphicsService::DeleteShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index)
+{ 
+    // The descriptor is left as is in the set, partially bound sets allow unused stale descriptors
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    shaderResourceHeap->Descriptors[index] = {};
+}
+
+void VulkanGraphicsService::CreateShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable)
+{ 
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    assert(index < shaderResourceHeap->Length);
+
+    shaderResourceHeap->Descriptors[index] = { bufferPointer, false, isWriteable != 0, 0 };
+    WriteShaderResourceDescriptors(shaderResourceHeap, &index, 1);
+}
+
+void VulkanGraphicsService::DeleteShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index)
+{ 
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    shaderResourceHeap->Descriptors[index] = {};
+}
+
+void VulkanGraphicsService::CreateShaderResources(void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength)
+{
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    vector<uint32_t> indexes(writesLength);
+
+    for (int i = 0; i < writesLength; i++)
+    {
+        auto& write = writes[i];
+        assert(write.Index < shaderResourceHeap->Length);
+
+        shaderResourceHeap->Descriptors[write.Index] = { write.ResourcePointer, write.IsTexture != 0, write.IsWriteable != 0, write.MipLevel };
+        indexes[i] = write.Index;
+    }
+
+    WriteShaderResourceDescriptors(shaderResourceHeap, indexes.data(), (uint32_t)writesLength);
+}
+
+void* VulkanGraphicsService::CreateGraphicsBuffer(void* graphicsHeapPointer, unsigned long heapOffset, GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes)
+{
+    VulkanGraphicsHeap* graphicsHeap = (VulkanGraphicsHeap*)graphicsHeapPointer;
+    VulkanGraphicsBuffer* graphicsBuffer = new VulkanGraphicsBuffer();
+    graphicsBuffer->SizeInBytes = sizeInBytes;
+    graphicsBuffer->HeapOffset = heapOffset;
+    graphicsBuffer->GraphicsHeap = graphicsHeap;
+
+    VkBufferCreateInfo createInfo = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    createInfo.size = sizeInBytes;
+    createInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT; // TODO: To fill correctly base on the heap type
+
+    if (graphicsHeap->Type == GraphicsServiceHeapType::Gpu)
+	{
+		createInfo.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	}
+
+    else if (graphicsHeap->Type == GraphicsServiceHeapType::Upload)
+	{
+		createInfo.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	}
+
+    else if (graphicsHeap->Type == GraphicsServiceHeapType::ReadBack)
+    {
+        createInfo.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    }
+
+    else if (graphicsHeap->Type == GraphicsServiceHeapType::GpuUpload)
+    {
+        createInfo.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    }
+
+    if (graphicsBufferUsage == GraphicsBufferUsage::IndirectCommands)
+    {
+        // TODO: For the moment we set src to indirect command buffers because we may want to read the counters
+        createInfo.usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    }
+
+    if (this->isDescriptorBufferSupported)
+    {
+        createInfo.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
+    AssertIfFailed(vkCreateBuffer(this->graphicsDevice, &createInfo, nullptr, &graphicsBuffer->BufferObject));
+    AssertIfFailed(vkBindBufferMemory(this->graphicsDevice, graphicsBuffer->BufferObject, graphicsHeap->DeviceMemory, heapOffset));
+
+    if (this->isDescriptorBufferSupported)
+    {
+        VkBufferDeviceAddressInfo addressInfo = { VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
+        addressInfo.buffer = graphicsBuffer->BufferObject;
+
+        graphicsBuffer->DeviceAddress = vkGetBufferDeviceAddress(this->graphicsDevice, &addressInfo);
+    }
+
+    return graphicsBuffer;
+}
+
+void VulkanGraphicsService::SetGraphicsBufferLabel(void* graphicsBufferPointer, char* label)
+{ 
+    #ifdef DEBUG 
+    VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)graphicsBufferPointer;
+
+    VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+    nameInfo.objectType = VK_OBJECT_TYPE_BUFFER;
+    nameInfo.objectHandle = (uint64_t)graphicsBuffer->BufferObject;
+    nameInfo.pObjectName = label;
+
+    AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    #endif
+}
+
+void VulkanGraphicsService::DeleteGraphicsBuffer(void* graphicsBufferPointer)
+{ 
+    VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)graphicsBufferPointer;
+
+    if (graphicsBuffer->OwnershipTransferQueue != nullptr)
+    {
+        lock_guard<mutex> lock(this->submitLock);
+        RemoveOwnershipTransfer(graphicsBuffer->OwnershipTransferQueue, graphicsBuffer, nullptr);
+    }
+
+    DeferDelete(VK_OBJECT_TYPE_BUFFER, (uint64_t)graphicsBuffer->BufferObject);
+    DeferDelete(VK_OBJECT_TYPE_BUFFER, (uint64_t)graphicsBuffer->IndirectCommandWorkingBuffer);
+    DeferDelete(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)graphicsBuffer->IndirectCommandWorkingDeviceMemory);
+
+    delete graphicsBuffer;
+}
+
+void* VulkanGraphicsService::GetGraphicsBufferCpuPointer(void* graphicsBufferPointer)
+{
+    VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)graphicsBufferPointer;
+    VulkanGraphicsHeap* graphicsHeap = graphicsBuffer->GraphicsHeap;
+    assert(graphicsHeap->CpuPointer != nullptr);
+
+    if (graphicsBuffer->PendingQueryPool != VK_NULL_HANDLE)
+    {
+        // The call doesn't wait because queries are never written when the queue has no timestamp support.
+        // Unavailable queries are written as 0 so that the caller doesn't read stale values.
+        uint32_t queryCount = graphicsBuffer->PendingQueryCount;
+        vector<uint64_t> queryResults(queryCount * 2);
+
+        // VK_NOT_READY is a success code returned when some queries are not available
+        AssertIfFailed(vkGetQueryPoolResults(this->graphicsDevice, graphicsBuffer->PendingQueryPool, graphicsBuffer->PendingQueryStartIndex, queryCount, queryResults.size() * sizeof(uint64_t), queryResults.data(), 2 * sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT));
+
+        uint64_t* timestamps = (uint64_t*)(graphicsHeap->CpuPointer + graphicsBuffer->HeapOffset);
+        assert(queryCount * sizeof(uint64_t) <= (uint32_t)graphicsBuffer->SizeInBytes);
+
+        for (uint32_t i = 0; i < queryCount; i++)
+        {
+            timestamps[i] = queryResults[i * 2 + 1] != 0 ? queryResults[i * 2] : 0;
+        }
+
+        graphicsBuffer->PendingQueryPool = VK_NULL_HANDLE;
+
+        return graphicsHeap->CpuPointer + graphicsBuffer->HeapOffset;
+    }
+
+    // Makes the GPU writes visible to the CPU
+    if (!graphicsHeap->IsCoherent && graphicsHeap->Type == GraphicsServiceHeapType::ReadBack)
+    {
+        auto memoryRange = GetMappedMemoryRange(graphicsBuffer);
+        AssertIfFailed(vkInvalidateMappedMemoryRanges(this->graphicsDevice, 1, &memoryRange));
+    }
+
+    return graphicsHeap->CpuPointer + graphicsBuffer->HeapOffset;
+}
+
+void VulkanGraphicsService::ReleaseGraphicsBufferCpuPointer(void* graphicsBufferPointer)
+{
+    VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)graphicsBufferPointer;
+    VulkanGraphicsHeap* graphicsHeap = graphicsBuffer->GraphicsHeap;
+
+    // Makes the CPU writes visible to the GPU, the heap stays mapped
+    if (!graphicsHeap->IsCoherent && graphicsHeap->Type != GraphicsServiceHeapType::ReadBack)
+    {
+        auto memoryRange = GetMappedMemoryRange(graphicsBuffer);
+        AssertIfFailed(vkFlushMappedMemoryRanges(this->graphicsDevice, 1, &memoryRange));
+    }
+}
+
+void* VulkanGraphicsService::CreateTexture(void* graphicsHeapPointer, unsigned long heapOffset, int isAliasable, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+    VulkanGraphicsHeap* graphicsHeap = (VulkanGraphicsHeap*)graphicsHeapPointer;
+    VulkanTexture* texture = new VulkanTexture();
+
+    texture->TextureObject = CreateImage(this->graphicsDevice, textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
+    AssertIfFailed(vkBindImageMemory(this->graphicsDevice, texture->TextureObject, graphicsHeap->DeviceMemory, heapOffset));
+
+    texture->Width = width;
+    texture->Height = height;
+    texture->ResourceState.Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    texture->Format = VulkanConvertTextureFormat(textureFormat);
+
+    texture->ImageView = CreateImageView(this->graphicsDevice, texture->TextureObject, VulkanConvertTextureFormat(textureFormat, false), 0, mipLevels);
+
+    for (uint32_t i = 0; i < mipLevels; i++)
+    {
+        texture->ImageViews.push_back(CreateImageView(this->graphicsDevice, texture->TextureObject, VulkanConvertTextureFormat(textureFormat, false), i, 1));
+    }
+
+    return texture;
+}
+
+void VulkanGraphicsService::SetTextureLabel(void* texturePointer, char* label)
+{ 
+    #ifdef DEBUG 
+    VulkanTexture* texture = (VulkanTexture*)texturePointer;
+
+    VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+    nameInfo.objectType = VK_OBJECT_TYPE_IMAGE;
+    nameInfo.objectHandle = (uint64_t)texture->TextureObject;
+    nameInfo.pObjectName = label;
+
+    AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    #endif
+}
+
+void VulkanGraphicsService::DeleteTexture(void* texturePointer)
+{ 
+    VulkanTexture* texture = (VulkanTexture*)texturePointer;
+
+    if (texture->OwnershipTransferQueue != nullptr)
+    {
+        lock_guard<mutex> lock(this->submitLock);
+        RemoveOwnershipTransfer(texture->OwnershipTransferQueue, nullptr, texture);
+    }
+
+    RemoveCachedFrameBuffers(nullptr, texture->ImageView);
+    DeferDelete(VK_OBJECT_TYPE_IMAGE_VIEW, (uint64_t)texture->ImageView);
+    
+    for (uint32_t i = 0; i < texture->ImageViews.size(); i++)
+    {
+        DeferDelete(VK_OBJECT_TYPE_IMAGE_VIEW, (uint64_t)texture->ImageViews[i]);
+    }
+
+    if (!texture->IsPresentTexture)
+    {
+        DeferDelete(VK_OBJECT_TYPE_IMAGE, (uint64_t)texture->TextureObject);
+    }
+
+    delete texture;    
+}
+
+void* VulkanGraphicsService::CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount)
+{
+    VulkanSwapChain* swapChain = new VulkanSwapChain();
+    swapChain->CommandQueue = (VulkanCommandQueue*)commandQueuePointer;
+    swapChain->Format = VulkanConvertTextureFormat(textureFormat, true);
+    swapChain->WindowSurface = CreateWindowSurface(windowPointer);
+
+    // 0 lets the backend choose, one back buffer per frame in flight with a minimum of 2
+    swapChain->RequestedBackBufferCount = backBufferCount > 0 ? backBufferCount : this->framesInFlightCount;
+    swapChain->RequestedBackBufferCount = swapChain->RequestedBackBufferCount < 2 ? 2 : (swapChain->RequestedBackBufferCount > VulkanMaxSwapChainImageCount ? VulkanMaxSwapChainImageCount : swapChain->RequestedBackBufferCount);
+
+    if (swapChain->WindowSurface == nullptr)
+    {
+        swapChain->IsOffscreen = true;
+        CreateOffscreenBackBuffers(swapChain, VulkanConvertTextureFormat(textureFormat), width, height);
+
+        return swapChain;
+    }
+
+    VkBool32 isPresentSupported;
+    AssertIfFailed(vkGetPhysicalDeviceSurfaceSupportKHR(this->graphicsPhysicalDevice, swapChain->CommandQueue->CommandQueueFamilyIndex, swapChain->WindowSurface, &isPresentSupported));
+    assert(isPresentSupported == 1);
+
+    // FIFO is the only present mode that is always available
+    VkPresentModeKHR requestedPresentMode = VulkanConvertPresentMode(presentMode);
+    swapChain->PresentMode = VK_PRESENT_MODE_FIFO_KHR;
+
+    uint32_t presentModeCount = 0;
+    AssertIfFailed(vkGetPhysicalDeviceSurfacePresentModesKHR(this->graphicsPhysicalDevice, swapChain->WindowSurface, &presentModeCount, nullptr));
+
+    vector<VkPresentModeKHR> presentModes(presentModeCount);
+    AssertIfFailed(vkGetPhysicalDeviceSurfacePresentModesKHR(this->graphicsPhysicalDevice, swapChain->WindowSurface, &presentModeCount, presentModes.data()));
+
+    for (uint32_t i = 0; i < presentModeCount; i++)
+    {
+        if (presentModes[i] == requestedPresentMode)
+        {
+            swapChain->PresentMode = requestedPresentMode;
+            break;
+        }
+    }
+
+    CreateSwapChainBackBuffers(swapChain, VulkanConvertTextureFormat(textureFormat), width, height);
+    CreateSwapChainSemaphores(swapChain);
+
+    return swapChain;
+}
+
+void VulkanGraphicsService::DeleteSwapChain(void* swapChainPointer)
+{
+	VulkanSwapChain* swapChain = (VulkanSwapChain*)swapChainPointer;
+
+    // The back buffer views must be destroyed before the swap chain that owns the images
+    AssertIfFailed(vkDeviceWaitIdle(this->graphicsDevice));
+    DeleteSwapChainBackBuffers(swapChain);
+    ProcessDeferredDeletes(true);
+
+    if (!swapChain->IsOffscreen)
+    {
+        DeleteSwapChainSemaphores(swapChain);
+    }
+
+    swapChain->CommandQueue->AcquireSemaphoreToWait = nullptr;
+
+    if (swapChain->SwapChainObject != nullptr)
+    {
+        vkDestroySwapchainKHR(this->graphicsDevice, swapChain->SwapChainObject, nullptr);
+    }
+
+    if (swapChain->WindowSurface != nullptr)
+    {
+        vkDestroySurfaceKHR(this->vulkanInstance, swapChain->WindowSurface, nullptr);
+    }
+	
+    delete swapChain;
+}
+
+void VulkanGraphicsService::ResizeSwapChain(void* swapChainPointer, int width, int height)
+{
+    AssertIfFailed(vkDeviceWaitIdle(this->graphicsDevice));
+
+    VulkanSwapChain* swapChain = (VulkanSwapChain*)swapChainPointer;
+    VkFormat textureFormat = swapChain->BackBufferTextures[0]->Format;
+
+    DeleteSwapChainBackBuffers(swapChain);
+    ProcessDeferredDeletes(true);
+
+    if (swapChain->IsOffscreen)
+    {
+        CreateOffscreenBackBuffers(swapChain, textureFormat, width, height);
+        swapChain->CurrentImageIndex = 0;
+        return;
+    }
+
+    CreateSwapChainBackBuffers(swapChain, textureFormat, width, height);
+
+    // An acquired image that was never presented leaves its semaphore signaled so the
+    // semaphores are recreated with the swap chain
+    DeleteSwapChainSemaphores(swapChain);
+    CreateSwapChainSemaphores(swapChain);
+    swapChain->CommandQueue->AcquireSemaphoreToWait = nullptr;
+
+    WaitForSwapChainOnCpu(swapChainPointer);
+}
+
+void* VulkanGraphicsService::GetSwapChainBackBufferTexture(void* swapChainPointer)
+{
+    VulkanSwapChain* swapChain = (VulkanSwapChain*)swapChainPointer;
+    return swapChain->BackBufferTextures[swapChain->CurrentImageIndex];
+}
+
+unsigned long VulkanGraphicsService::PresentSwapChain(void* swapChainPointer)
+{
+    VulkanSwapChain* swapChain = (VulkanSwapChain*)swapChainPointer;
+    VulkanCommandQueue* commandQueue = swapChain->CommandQueue;
+    uint64_t fenceValue = 0;
+
+    if (swapChain->IsOffscreen)
+    {
+        fenceValue = commandQueue->FenceValue;
+    }
+
+    else
+    {
+        lock_guard<mutex> lock(this->submitLock);
+
+        // Queue operations are ordered so an empty submit after the frame command lists is enough to
+        // signal the binary semaphore the presentation engine waits on. It also gives the present a
+        // timeline value that the CPU can wait on.
+        VkSemaphore presentSemaphore = swapChain->PresentSemaphores[swapChain->CurrentImageIndex];
+        fenceValue = commandQueue->FenceValue + 1;
+        commandQueue->FenceValue = fenceValue;
+
+        VkSemaphoreSubmitInfoKHR waitSemaphoreInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR };
+        waitSemaphoreInfo.semaphore = commandQueue->AcquireSemaphoreToWait;
+        waitSemaphoreInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+
+        VkSemaphoreSubmitInfoKHR signalSemaphoreInfos[2] = { { VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR }, { VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR } };
+        signalSemaphoreInfos[0].semaphore = presentSemaphore;
+        signalSemaphoreInfos[0].stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+        signalSemaphoreInfos[1].semaphore = commandQueue->TimelineSemaphore;
+        signalSemaphoreInfos[1].value = fenceValue;
+        signalSemaphoreInfos[1].stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+
+        VkSubmitInfo2KHR submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR };
+        submitInfo.waitSemaphoreInfoCount = (commandQueue->AcquireSemaphoreToWait != nullptr) ? 1 : 0;
+        submitInfo.pWaitSemaphoreInfos = &waitSemaphoreInfo;
+        submitInfo.signalSemaphoreInfoCount = 2;
+        submitInfo.pSignalSemaphoreInfos = signalSemaphoreInfos;
+
+        commandQueue->AcquireSemaphoreToWait = nullptr;
+        AssertIfFailed(vkQueueSubmit2KHR(commandQueue->CommandQueueObject, 1, &submitInfo, VK_NULL_HANDLE));
+
+        VkPresentInfoKHR presentInfo = { VK_STRUCTURE_TYPE_PRESENT_INFO_KHR };
+        presentInfo.waitSemaphoreCount = 1;
+        presentInfo.pWaitSemaphores = &presentSemaphore;
+        presentInfo.swapchainCount = 1;
+        presentInfo.pSwapchains = &swapChain->SwapChainObject;
+        presentInfo.pImageIndices = &swapChain->CurrentImageIndex;
+
+        AssertIfFailed(vkQueuePresentKHR(commandQueue->CommandQueueObject, &presentInfo));
+    }
+
+    swapChain->FrameFenceValues[swapChain->CurrentFrameIndex] = fenceValue;
+    swapChain->CurrentFrameIndex = (swapChain->CurrentFrameIndex + 1) % this->framesInFlightCount;
+
+    // TODO: Do something better here
+	this->currentCommandPoolIndex = (this->currentCommandPoolIndex + 1) % this->framesInFlightCount;
+
+    return fenceValue;
+}
+
+void VulkanGraphicsService::WaitForSwapChainOnCpu(void* swapChainPointer)
+{
+    // TODO: Try to emulate the SetLatency awaitable of D3D12
+    VulkanSwapChain* swapChain = (VulkanSwapChain*)swapChainPointer;
+
+    // Wait for the frame that was using the slot of the new frame so that
+    // no more than framesInFlightCount frames are queued on the GPU
+    uint64_t fenceValue = swapChain->FrameFenceValues[swapChain->CurrentFrameIndex];
+
+    if (fenceValue > 0)
+    {
+        VkSemaphoreWaitInfo waitInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO };
+        waitInfo.pSemaphores = &swapChain->CommandQueue->TimelineSemaphore;
+        waitInfo.pValues = &fenceValue;
+        waitInfo.semaphoreCount = 1;
+
+        vkWaitSemaphores(this->graphicsDevice, &waitInfo, UINT64_MAX);
+    }
+
+    if (swapChain->IsOffscreen)
+    {
+        swapChain->CurrentImageIndex = (swapChain->CurrentImageIndex + 1) % swapChain->BackBufferCount;
+    }
+
+    else
+    {
+        // The acquire is not waited on the CPU, the next submit on the present queue waits for it on the GPU
+        VkSemaphore acquireSemaphore = swapChain->AcquireSemaphores[swapChain->CurrentFrameIndex];
+        AssertIfFailed(vkAcquireNextImageKHR(this->graphicsDevice, swapChain->SwapChainObject, UINT64_MAX, acquireSemaphore, VK_NULL_HANDLE, &swapChain->CurrentImageIndex));
+
+        lock_guard<mutex> lock(this->submitLock);
+        swapChain->CommandQueue->AcquireSemaphoreToWait = acquireSemaphore;
+    }
+
+    ProcessDeferredDeletes(false);
+}
+
+void* VulkanGraphicsService::CreateQueryBuffer(enum GraphicsQueryBufferType queryBufferType, int length)
+{
+    VulkanQueryBuffer* queryBuffer = new VulkanQueryBuffer();
+    queryBuffer->QueryBufferType = queryBufferType;
+    queryBuffer->Length = length;
+
+    VkQueryPoolCreateInfo createInfo = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+    createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    createInfo.queryCount = length;
+
+    if (queryBufferType == GraphicsQueryBufferType::GraphicsPipelineStats && this->isPipelineStatisticsSupported)
+    {
+        // The statistics are written in the same order as the D3D12 pipeline statistics
+        createInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        createInfo.pipelineStatistics = VulkanPipelineStatisticsFlags;
+    }
+
+    AssertIfFailed(vkCreateQueryPool(this->graphicsDevice, &createInfo, nullptr, &queryBuffer->QueryPool));
+
+    // Queries must be reset before their first use
+    vkResetQueryPool(this->graphicsDevice, queryBuffer->QueryPool, 0, length);
+
+    return queryBuffer;
+}
+
+void VulkanGraphicsService::ResetQueryBuffer(void* queryBufferPointer)
+{
+    VulkanQueryBuffer* queryBuffer = (VulkanQueryBuffer*)queryBufferPointer;
+    vkResetQueryPool(this->graphicsDevice, queryBuffer->QueryPool, 0, queryBuffer->Length);
+}
+
+void VulkanGraphicsService::SetQueryBufferLabel(void* queryBufferPointer, char* label){ }
+void VulkanGraphicsService::DeleteQueryBuffer(void* queryBufferPointer)
+{ 
+    VulkanQueryBuffer* queryBuffer = (VulkanQueryBuffer*)queryBufferPointer;
+    DeferDelete(VK_OBJECT_TYPE_QUERY_POOL, (uint64_t)queryBuffer->QueryPool);
+    delete queryBuffer;
+}
+
+void* VulkanGraphicsService::CreateShader(char* computeShaderFunction, void* shaderByteCode, int shaderByteCodeLength)
+{
+    VulkanShader* shader = new VulkanShader();
+    shader->ReferenceCount = 1;
+
+	auto currentDataPtr = (unsigned char*)shaderByteCode;
+
+	// Skip SPIR-V offset
+	auto spirvOffset = (*(int*)currentDataPtr);
+	currentDataPtr += sizeof(int);
+	currentDataPtr += spirvOffset;
+
+    shader->ParameterCount = (*(int*)currentDataPtr);
+	currentDataPtr += sizeof(int);
+	
+	auto shaderTableCount = (*(int*)currentDataPtr);
+	currentDataPtr += sizeof(int);
+
+	for (int i = 0; i < shaderTableCount; i++)
+	{
+		auto entryPointNameLength = (*(int*)currentDataPtr);
+		currentDataPtr += sizeof(int);
+
+		auto shaderStage = GetShaderStage((char*)currentDataPtr, entryPointNameLength);
+		currentDataPtr += entryPointNameLength;
+
+		auto shaderByteCodeLength = (*(int*)currentDataPtr);
+		currentDataPtr += sizeof(int);
+
+		if (shaderStage != ShaderStageUnknown)
+		{
+			SetShaderModule(shader, shaderStage, currentDataPtr, shaderByteCodeLength, ComputeShaderContentHash(currentDataPtr, shaderByteCodeLength));
+		}
+
+		currentDataPtr += shaderByteCodeLength;
+	}
+
+    if (this->isDeviceGeneratedCommandsSupported)
+    {
+        shader->CommandSignature = CreateIndirectPipelineLayout(this->graphicsDevice, shader->ComputeShaderMethod != nullptr, shader->ParameterCount);
+    }
+
+    return shader;
+}
+
+void* VulkanGraphicsService::CreateShaderFromArchive(void* shaderArchivePointer, char* shaderName)
+{
+    ShaderArchive* shaderArchive = (ShaderArchive*)shaderArchivePointer;
+    auto archiveShader = FindShaderArchiveShader(shaderArchive, shaderName);
+
+    if (archiveShader == nullptr)
+    {
+        return nullptr;
+    }
+
+    VulkanShader* shader = new VulkanShader();
+    shader->ReferenceCount = 1;
+    shader->ParameterCount = archiveShader->ParameterCount;
+
+    for (uint32_t i = 0; i < archiveShader->EntryPointCount; i++)
+    {
+        auto& entryPoint = shaderArchive->EntryPoints[archiveShader->FirstEntryPoint + i];
+
+        // The modules are created directly from the mapped pages
+        if (entryPoint.Stage < ShaderStageCount && entryPoint.SpirvLength > 0)
+        {
+            SetShaderModule(shader, entryPoint.Stage, shaderArchive->Data + entryPoint.SpirvOffset, entryPoint.SpirvLength, entryPoint.SpirvHash);
+        }
+    }
+
+    if (this->isDeviceGeneratedCommandsSupported)
+    {
+        shader->CommandSignature = CreateIndirectPipelineLayout(this->graphicsDevice, shader->ComputeShaderMethod != nullptr, shader->ParameterCount);
+    }
+
+    return shader;
+}
+
+void VulkanGraphicsService::SetShaderLabel(void* shaderPointer, char* label)
+{ 
+    #ifdef DEBUG 
+    VulkanShader* shader = (VulkanShader*)shaderPointer;
+
+    if (shader->AmplificationShaderMethod != nullptr)
+    {
+        VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+        nameInfo.objectType = VK_OBJECT_TYPE_SHADER_MODULE;
+        nameInfo.objectHandle = (uint64_t)shader->AmplificationShaderMethod;
+        nameInfo.pObjectName = label;
+
+        AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    }
+
+    if (shader->MeshShaderMethod != nullptr)
+    {
+        VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+        nameInfo.objectType = VK_OBJECT_TYPE_SHADER_MODULE;
+        nameInfo.objectHandle = (uint64_t)shader->MeshShaderMethod;
+        nameInfo.pObjectName = label;
+
+        AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    }
+
+    if (shader->PixelShaderMethod != nullptr)
+    {
+        VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+        nameInfo.objectType = VK_OBJECT_TYPE_SHADER_MODULE;
+        nameInfo.objectHandle = (uint64_t)shader->PixelShaderMethod;
+        nameInfo.pObjectName = label;
+
+        AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    }
+
+    if (shader->ComputeShaderMethod != nullptr)
+    {
+        VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+        nameInfo.objectType = VK_OBJECT_TYPE_SHADER_MODULE;
+        nameInfo.objectHandle = (uint64_t)shader->ComputeShaderMethod;
+        nameInfo.pObjectName = label;
+
+        AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+    }
+    #endif
+}
+
+void VulkanGraphicsService::DeleteShader(void* shaderPointer)
+{ 
+    ReleaseShader((VulkanShader*)shaderPointer);
+}
+
+void VulkanGraphicsService::ReleaseShader(VulkanShader* shader)
+{
+    if (--shader->ReferenceCount > 0)
+    {
+        return;
+    }
+
+    VkShaderModule shaderModules[] { shader->AmplificationShaderMethod, shader->MeshShaderMethod, shader->PixelShaderMethod, shader->ComputeShaderMethod };
+
+    for (uint32_t i = 0; i < ShaderStageCount; i++)
+    {
+        if (shaderModules[i] != nullptr)
+        {
+            ReleaseShaderModule(shader->ShaderModuleHashes[i]);
+        }
+    }
+
+    DeferDelete(VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_NV, (uint64_t)shader->CommandSignature);
+
+    delete shader;
+}
+
+void* VulkanGraphicsService::OpenShaderArchive(char* path)
+{
+    return OpenShaderArchiveFile(path);
+}
+
+void VulkanGraphicsService::CloseShaderArchive(void* shaderArchivePointer)
+{
+    // Shader modules own a copy of their code so the archive can be closed while its shaders are alive
+    CloseShaderArchiveFile((ShaderArchive*)shaderArchivePointer);
+}
+
+void* VulkanGraphicsService::CreateComputePipelineState(void* shaderPointer)
+{
+    VulkanShader* shader = (VulkanShader*)shaderPointer;
+
+    bool isNew = false;
+    VulkanPipelineState* pipelineState = AcquirePipelineState(shader, nullptr, &isNew);
+
+    if (isNew)
+    {
+        CompilePipelineState(pipelineState, shader, {});
+        this->pipelineCompilerThreadPool.Notify();
+    }
+
+    return pipelineState;
+}
+
+void* VulkanGraphicsService::CreatePipelineState(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor)
+{
+    VulkanShader* shader = (VulkanShader*)shaderPointer;
+
+    bool isNew = false;
+    VulkanPipelineState* pipelineState = AcquirePipelineState(shader, &renderPassDescriptor, &isNew);
+
+    if (isNew)
+    {
+        CompilePipelineState(pipelineState, shader, renderPassDescriptor);
+        this->pipelineCompilerThreadPool.Notify();
+    }
+
+    return pipelineState;
+}
+
+void* VulkanGraphicsService::CreatePipelineStateAsync(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState)
+{
+    VulkanShader* shader = (VulkanShader*)shaderPointer;
+
+    bool isNew = false;
+    VulkanPipelineState* pipelineState = AcquirePipelineState(shader, isComputePipelineState ? nullptr : &renderPassDescriptor, &isNew);
+
+    if (isNew)
+    {
+        // The shader can be deleted while the compilation is queued
+        shader->ReferenceCount++;
+
+        this->pipelineCompilerThreadPool.Enqueue([this, pipelineState, shader, renderPassDescriptor]()
+        {
+            CompilePipelineState(pipelineState, shader, renderPassDescriptor);
+            ReleaseShader(shader);
+        });
+    }
+
+    return pipelineState;
+}
+
+int VulkanGraphicsService::IsPipelineStateReady(void* pipelineStatePointer, int waitForCompletion)
+{
+    VulkanPipelineState* pipelineState = (VulkanPipelineState*)pipelineStatePointer;
+
+    if (!pipelineState->IsReady && waitForCompletion)
+    {
+        this->pipelineCompilerThreadPool.Wait(pipelineState->IsReady);
+    }
+
+    return pipelineState->IsReady;
+}
+
+void VulkanGraphicsService::SetPipelineStateLabel(void* pipelineStatePointer, char* label){ }
+
+void VulkanGraphicsService::DeletePipelineState(void* pipelineStatePointer)
+{
+    VulkanPipelineState *pipelineState = (VulkanPipelineState *)pipelineStatePointer;
+
+    {
+        lock_guard<mutex> lock(this->pipelineStateCacheLock);
+        assert(pipelineState->ReferenceCount > 0);
+
+        if (--pipelineState->ReferenceCount > 0)
+        {
+            return;
+        }
+
+        this->pipelineStateCache.erase(pipelineState->Key);
+    }
+
+    // The pipeline state is no longer in the cache so it can be waited on without the lock
+    IsPipelineStateReady(pipelineStatePointer, true);
+    DestroyPipelineState(pipelineState);
+}
+
+void VulkanGraphicsService::CopyDataToGraphicsBuffer(void* commandListPointer, void* destinationGraphicsBufferPointer, void* sourceGraphicsBufferPointer, unsigned int sizeInBytes, unsigned int destinationOffsetInBytes, unsigned int sourceOffsetInBytes)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanGraphicsBuffer* destinationBuffer = (VulkanGraphicsBuffer*)destinationGraphicsBufferPointer;
+    VulkanGraphicsBuffer* sourceBuffer = (VulkanGraphicsBuffer*)sourceGraphicsBufferPointer;
+    
+    VkBufferCopy copyRegion = {};
+    copyRegion.size = sizeInBytes;
+    copyRegion.dstOffset = destinationOffsetInBytes;
+    copyRegion.srcOffset = sourceOffsetInBytes;
+
+    TransitionBufferToState(commandList, sourceBuffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_ACCESS_2_TRANSFER_READ_BIT_KHR);
+    TransitionBufferToState(commandList, destinationBuffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR);
+    FlushBarriers(commandList);
+
+    vkCmdCopyBuffer(commandList->CommandBufferObject, sourceBuffer->BufferObject, destinationBuffer->BufferObject, 1, &copyRegion);
+}
+
+void VulkanGraphicsService::CopyDataToTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceGraphicsBufferPointer, enum GraphicsTextureFormat textureFormat, int width, int height, int slice, int mipLevel)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanTexture* destinationTexture = (VulkanTexture*)destinationTexturePointer;
+    VulkanGraphicsBuffer* sourceBuffer = (VulkanGraphicsBuffer*)sourceGraphicsBufferPointer;
+    
+    VkBufferImageCopy copyRegion = {};
+    copyRegion.imageExtent.width = width;
+    copyRegion.imageExtent.height = height;
+    copyRegion.imageExtent.depth = 1;
+    copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copyRegion.imageSubresource.mipLevel = mipLevel;
+    copyRegion.imageSubresource.layerCount = 1;
+
+    // TODO: Fill other properties
+    TransitionBufferToState(commandList, sourceBuffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_ACCESS_2_TRANSFER_READ_BIT_KHR);
+    TransitionTextureToState(commandList, destinationTexture, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    FlushBarriers(commandList);
+
+    vkCmdCopyBufferToImage(commandList->CommandBufferObject, sourceBuffer->BufferObject, destinationTexture->TextureObject, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
+
+    // Only the layout is changed on copy queues, the ownership release of the texture waits for the transition
+    auto shaderStages = commandList->CommandQueue->ShaderStages;
+
+    if (shaderStages != VK_PIPELINE_STAGE_2_NONE_KHR)
+    {
+        TransitionTextureToState(commandList, destinationTexture, shaderStages, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+
+    else
+    {
+        TransitionTextureToState(commandList, destinationTexture, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_ACCESS_2_NONE_KHR, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+}
+
+void VulkanGraphicsService::CopyTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceTexturePointer){ }
+
+void VulkanGraphicsService::TransitionGraphicsBufferToState(void* commandListPointer, void* graphicsBufferPointer, enum GraphicsResourceState resourceState)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+	VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)graphicsBufferPointer;
+
+	// The common state hands the buffer over to the other queues
+	VkPipelineStageFlags2KHR destinationStage = VK_PIPELINE_STAGE_2_NONE_KHR;
+	VkAccessFlags2KHR destinationAccess = VK_ACCESS_2_NONE_KHR;
+
+	if (resourceState == GraphicsResourceState::StateDestinationCopy)
+	{
+		destinationStage = VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR;
+		destinationAccess = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+	}
+
+	else if (resourceState == GraphicsResourceState::StateShaderRead && !commandList->CommandQueue->IsCopyCommandQueue)
+	{
+		destinationStage = commandList->CommandQueue->ShaderStages;
+		destinationAccess = VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR;
+	}
+
+	TransitionBufferToState(commandList, graphicsBuffer, destinationStage, destinationAccess);
+}
+
+void VulkanGraphicsService::DispatchThreads(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    FlushBarriers(commandList);
+
+    vkCmdDispatch(commandList->CommandBufferObject, threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+}
+
+void VulkanGraphicsService::BeginRenderPass(void* commandListPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+	commandList->RenderPassDescriptor = renderPassDescriptor;
+
+    if (renderPassDescriptor.RenderTarget1TexturePointer.HasValue == 1)
+    {
+        // The render pass is found with the descriptor because the pipeline state set for the pass
+        // is not bound while it is compiled
+        VkRenderPass renderPass = FindRenderPass(VulkanCreateRenderPassKey(renderPassDescriptor));
+
+        if (renderPass == nullptr)
+        {
+            return;
+        }
+
+        VulkanTexture* renderTargetTexture = (VulkanTexture*)renderPassDescriptor.RenderTarget1TexturePointer.Value;
+        TransitionTextureToState(commandList, renderTargetTexture, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR, VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT_KHR | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+        uint32_t imageViewCount = 1;
+        VkImageView imageViews[2] {};
+        imageViews[0] = renderTargetTexture->ImageView;
+
+        if (renderPassDescriptor.DepthTexturePointer.HasValue == 1)
+        {
+            VulkanTexture* depthTexture = (VulkanTexture*)renderPassDescriptor.DepthTexturePointer.Value;
+            TransitionTextureToState(commandList, depthTexture, VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR, VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT_KHR | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT_KHR, VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL);
+
+            imageViews[1] = depthTexture->ImageView;
+            imageViewCount++;
+        }
+
+        uint32_t clearColorCount = 0;
+        VkClearValue clearColors[2] = {};
+        
+        if (renderPassDescriptor.RenderTarget1ClearColor.HasValue)
+        {
+            clearColorCount++;
+            clearColors[0] = { renderPassDescriptor.RenderTarget1ClearColor.Value.X, renderPassDescriptor.RenderTarget1ClearColor.Value.Y, renderPassDescriptor.RenderTarget1ClearColor.Value.Z, 1 };
+        }
+
+        if (renderPassDescriptor.DepthBufferOperation == GraphicsDepthBufferOperation::ClearWrite)
+        {
+            clearColorCount++;
+            clearColors[1] = { 0, 0, 0, 0 };
+        }
+
+        VkRenderPassBeginInfo passBeginInfo = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
+        passBeginInfo.renderPass = renderPass;
+
+        commandList->RenderPassFrameBuffer = GetFrameBuffer(renderPass, imageViews, imageViewCount, renderTargetTexture->Width, renderTargetTexture->Height);
+        
+        passBeginInfo.framebuffer = commandList->RenderPassFrameBuffer;
+        passBeginInfo.renderArea.extent.width = renderTargetTexture->Width;
+        passBeginInfo.renderArea.extent.height = renderTargetTexture->Height;
+        passBeginInfo.clearValueCount = clearColorCount;
+        passBeginInfo.pClearValues = clearColors;
+
+        FlushBarriers(commandList);
+        vkCmdBeginRenderPass(commandList->CommandBufferObject, &passBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+        VkViewport viewport = { 0, (float)renderTargetTexture->Height, (float)renderTargetTexture->Width, -(float)renderTargetTexture->Height, 0, 1 };
+        VkRect2D scissor = { {0, 0}, {renderTargetTexture->Width, renderTargetTexture->Height} };
+
+        vkCmdSetViewport(commandList->CommandBufferObject, 0, 1, &viewport);
+        vkCmdSetScissor(commandList->CommandBufferObject, 0, 1, &scissor);
+
+        commandList->IsRenderPassActive = true;
+    }
+}
+
+void VulkanGraphicsService::EndRenderPass(void* commandListPointer)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    
+    if (commandList->IsRenderPassActive)
+    {
+        // TODO: Refactor all of that
+        vkCmdEndRenderPass(commandList->CommandBufferObject);
+        commandList->IsRenderPassActive = false;
+    }
+
+    VulkanTexture* texture = (VulkanTexture*)commandList->RenderPassDescriptor.RenderTarget1TexturePointer.Value;
+
+    // The transitions are flushed with the ones of the next pass or when the command list is committed. The attachments
+    // were written by the pass so they are released with their final state to the next queue family that reads them.
+    if (texture->IsPresentTexture)
+    {
+        // The color output stage is kept so that the transition of the next frame waits for the image acquire
+        TransitionTextureToState(commandList, texture, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR, VK_ACCESS_2_NONE_KHR, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+    }
+
+    else
+    {
+        TransitionTextureToState(commandList, texture, commandList->CommandQueue->ShaderStages, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+
+    if (commandList->RenderPassDescriptor.DepthTexturePointer.HasValue == 1)
+    {
+        VulkanTexture* depthTexture = (VulkanTexture*)commandList->RenderPassDescriptor.DepthTexturePointer.Value;
+        TransitionTextureToState(commandList, depthTexture, commandList->CommandQueue->ShaderStages, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+}
+
+void VulkanGraphicsService::SetPipelineState(void* commandListPointer, void* pipelineStatePointer)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    commandList->CurrentPipelineState = (VulkanPipelineState*)pipelineStatePointer;
+
+    // A pipeline state created asynchronously that is not ready yet blocks until it is compiled, the
+    // engine only sets it once IsPipelineStateReady returns true
+    IsPipelineStateReady(pipelineStatePointer, true);
+
+    if (commandList->CurrentPipelineState->PipelineStateObject != nullptr)
+    {
+        // TODO: Support compute shaders
+        vkCmdBindPipeline(commandList->CommandBufferObject, commandList->CommandQueue->IsComputeCommandQueue ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS, commandList->CurrentPipelineState->PipelineStateObject);
+
+        if (this->isDescriptorBufferSupported)
+        {
+            // The resource sets are in the first bound buffer and the sampler set in the second one
+            uint32_t bufferIndices[VulkanDescriptorSetLayoutCount] { 0, 0, 0, 0, 1 };
+            vkCmdSetDescriptorBufferOffsetsEXT(commandList->CommandBufferObject, commandList->CommandQueue->IsComputeCommandQueue ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS, commandList->CurrentPipelineState->PipelineLayoutObject, 0, VulkanDescriptorSetLayoutCount, bufferIndices, commandList->BoundDescriptorSetOffsets);
+        }
+
+        else
+        {
+            vkCmdBindDescriptorSets(commandList->CommandBufferObject, commandList->CommandQueue->IsComputeCommandQueue ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS, commandList->CurrentPipelineState->PipelineLayoutObject, 0, 5, commandList->CurrentResourceHeap->DescriptorSets, 0, nullptr);
+        }
+    }
+}
+
+void VulkanGraphicsService::SetShaderResourceHeap(void* commandListPointer, void* shaderResourceHeapPointer)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanShaderResourceHeap* shaderResourceHeap = (VulkanShaderResourceHeap*)shaderResourceHeapPointer;
+    commandList->CurrentResourceHeap = shaderResourceHeap;
+
+    // The descriptor buffers are bound once per command list, they only change when the heap is resized
+    if (this->isDescriptorBufferSupported && commandList->BoundDescriptorBufferAddress != shaderResourceHeap->ResourceDescriptorAddress)
+    {
+        VkDescriptorBufferBindingInfoEXT bindingInfos[2] = {};
+        bindingInfos[0].sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        bindingInfos[0].address = shaderResourceHeap->ResourceDescriptorAddress;
+        bindingInfos[0].usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT;
+        bindingInfos[1].sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        bindingInfos[1].address = shaderResourceHeap->SamplerDescriptorAddress;
+        bindingInfos[1].usage = VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+
+        vkCmdBindDescriptorBuffersEXT(commandList->CommandBufferObject, 2, bindingInfos);
+
+        commandList->BoundDescriptorBufferAddress = shaderResourceHeap->ResourceDescriptorAddress;
+        memcpy(commandList->BoundDescriptorSetOffsets, shaderResourceHeap->DescriptorSetOffsets, sizeof(commandList->BoundDescriptorSetOffsets));
+    }
+}
+
+void VulkanGraphicsService::SetShader(void* commandListPointer, void* shaderPointer)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    commandList->CurrentShader = (VulkanShader*)shaderPointer;
+}
+
+void VulkanGraphicsService::SetShaderParameterValues(void* commandListPointer, unsigned int slot, unsigned int* values, int valuesLength)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+
+    // The push constants need the layout of the bound pipeline state
+    if (commandList->CurrentPipelineState == nullptr)
+    {
+        return;
+    }
+
+    // TODO: There seems that there is a memory leak here!!!
+    // Is it a drive issue?
+    vkCmdPushConstants(commandList->CommandBufferObject, commandList->CurrentPipelineState->PipelineLayoutObject, VK_SHADER_STAGE_ALL, 0, valuesLength * 4, values);
+}
+
+void VulkanGraphicsService::SetTextureBarrier(void* commandListPointer, void* texturePointer)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanTexture* texture = (VulkanTexture*)texturePointer;
+
+    // Shader writes are not tracked so the previous shaders of the queue are assumed to have written the texture.
+    // A texture not transitioned before by the command list was written as a storage image in the general layout.
+    auto shaderStages = commandList->CommandQueue->ShaderStages;
+    auto resourceState = GetCommandListResourceState(commandList, texture);
+
+    if (resourceState == nullptr)
+    {
+        resourceState = AddCommandListResourceState(commandList, nullptr, texture, { shaderStages, VK_ACCESS_2_SHADER_READ_BIT_KHR | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR, VK_IMAGE_LAYOUT_GENERAL, commandList->CommandQueue });
+    }
+
+    resourceState->LastState.Stage |= shaderStages;
+    resourceState->LastState.Access |= VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR;
+
+    TransitionTextureToState(commandList, texture, shaderStages, VK_ACCESS_2_SHADER_READ_BIT_KHR | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR, resourceState->LastState.Layout);
+}
+
+void VulkanGraphicsService::SetGraphicsBufferBarrier(void* commandListPointer, void* graphicsBufferPointer)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)graphicsBufferPointer;
+
+    auto shaderStages = commandList->CommandQueue->ShaderStages;
+    auto resourceState = GetCommandListResourceState(commandList, graphicsBuffer);
+
+    if (resourceState == nullptr)
+    {
+        resourceState = AddCommandListResourceState(commandList, graphicsBuffer, nullptr, { shaderStages, VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR, VK_IMAGE_LAYOUT_UNDEFINED, commandList->CommandQueue });
+    }
+
+    resourceState->LastState.Stage |= shaderStages;
+    resourceState->LastState.Access |= VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR;
+
+    TransitionBufferToState(commandList, graphicsBuffer, shaderStages, VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR);
+}
+
+void VulkanGraphicsService::DispatchMesh(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+
+    FlushBarriers(commandList);
+
+    if (commandList->IsRenderPassActive && this->isMeshShaderSupported)
+    {
+        vkCmdDrawMeshTasksNV(commandList->CommandBufferObject, threadGroupCountX, 0);
+    }
+}
+
+void VulkanGraphicsService::ExecuteIndirect(void* commandListPointer, unsigned int maxCommandCount, void* commandGraphicsBufferPointer, unsigned int commandBufferOffset)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanGraphicsBuffer* commandGraphicsBuffer = (VulkanGraphicsBuffer*)commandGraphicsBufferPointer;
+    FlushBarriers(commandList);
+
+    if (commandList->IsRenderPassActive && commandList->CurrentShader && this->isDeviceGeneratedCommandsSupported)
+    {
+        if (commandGraphicsBuffer->IndirectCommandWorkingBuffer == nullptr)
+        {
+            commandGraphicsBuffer->IndirectCommandWorkingBuffer = VulkanCreateIndirectCommandWorkingBuffer(this->graphicsDevice, commandList->CurrentShader, commandList->CurrentPipelineState, maxCommandCount, this->gpuMemoryTypeIndex, &commandGraphicsBuffer->IndirectCommandWorkingDeviceMemory, &commandGraphicsBuffer->IndirectCommandWorkingBufferSize);
+        }
+
+        VkIndirectCommandsStreamNV streams[1] = {};
+        streams[0].buffer = commandGraphicsBuffer->BufferObject;
+        streams[0].offset = commandBufferOffset;
+
+        VkGeneratedCommandsInfoNV generatedCommandsInfo = { VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV };
+        generatedCommandsInfo.indirectCommandsLayout = commandList->CurrentShader->CommandSignature;
+        generatedCommandsInfo.pipeline = commandList->CurrentPipelineState->PipelineStateObject;
+        generatedCommandsInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        generatedCommandsInfo.pStreams = streams;
+        generatedCommandsInfo.streamCount = ARRAYSIZE(streams);
+        generatedCommandsInfo.sequencesCount = maxCommandCount;
+        generatedCommandsInfo.sequencesCountBuffer = commandGraphicsBuffer->BufferObject;
+        generatedCommandsInfo.sequencesCountOffset = commandGraphicsBuffer->SizeInBytes - sizeof(uint32_t);
+        generatedCommandsInfo.preprocessBuffer = commandGraphicsBuffer->IndirectCommandWorkingBuffer;
+        generatedCommandsInfo.preprocessSize = commandGraphicsBuffer->IndirectCommandWorkingBufferSize;
+        generatedCommandsInfo.preprocessOffset = 0;
+
+        vkCmdExecuteGeneratedCommandsNV(commandList->CommandBufferObject, false, &generatedCommandsInfo);
+    }
+}
+
+void VulkanGraphicsService::BeginQuery(void* commandListPointer, void* queryBufferPointer, int index)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanQueryBuffer* queryBuffer = (VulkanQueryBuffer*)queryBufferPointer;
+
+    if (queryBuffer->QueryBufferType == GraphicsQueryBufferType::GraphicsPipelineStats && this->isPipelineStatisticsSupported)
+    {
+        vkCmdBeginQuery(commandList->CommandBufferObject, queryBuffer->QueryPool, index, 0);
+    }
+}
+
+void VulkanGraphicsService::EndQuery(void* commandListPointer, void* queryBufferPointer, int index)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanQueryBuffer* queryBuffer = (VulkanQueryBuffer*)queryBufferPointer;
+
+    if (queryBuffer->QueryBufferType == GraphicsQueryBufferType::Timestamp)
+    {
+        vkCmdWriteTimestamp(commandList->CommandBufferObject, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryBuffer->QueryPool, index);
+    }
+
+    else if (queryBuffer->QueryBufferType == GraphicsQueryBufferType::CopyTimestamp && this->isCopyQueueTimestampSupported)
+    {
+        vkCmdWriteTimestamp(commandList->CommandBufferObject, VK_PIPELINE_STAGE_TRANSFER_BIT, queryBuffer->QueryPool, index);
+    }
+
+    else if (queryBuffer->QueryBufferType == GraphicsQueryBufferType::GraphicsPipelineStats && this->isPipelineStatisticsSupported)
+    {
+        vkCmdEndQuery(commandList->CommandBufferObject, queryBuffer->QueryPool, index);
+    }
+}
+
+void VulkanGraphicsService::ResolveQueryData(void* commandListPointer, void* queryBufferPointer, void* destinationBufferPointer, int startIndex, int endIndex)
+{ 
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    VulkanQueryBuffer* queryBuffer = (VulkanQueryBuffer*)queryBufferPointer;
+    VulkanGraphicsBuffer* destinationBuffer = (VulkanGraphicsBuffer*)destinationBufferPointer;
+
+    uint32_t queryCount = endIndex - startIndex;
+
+    if (queryCount == 0 || (queryBuffer->QueryBufferType == GraphicsQueryBufferType::GraphicsPipelineStats && !this->isPipelineStatisticsSupported))
+    {
+        return;
+    }
+
+    // Query results cannot be copied by a transfer only queue so the results are read back by the CPU
+    // when the destination buffer is mapped. The fence of the command list has been waited at that point.
+    if (commandList->CommandQueue->IsCopyCommandQueue && this->copyCommandQueueFamilyIndex != this->computeCommandQueueFamilyIndex)
+    {
+        destinationBuffer->PendingQueryPool = queryBuffer->QueryPool;
+        destinationBuffer->PendingQueryStartIndex = startIndex;
+        destinationBuffer->PendingQueryCount = queryCount;
+        return;
+    }
+
+    VkDeviceSize stride = sizeof(uint64_t);
+    TransitionBufferToState(commandList, destinationBuffer, VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR, VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR);
+
+    if (queryBuffer->QueryBufferType == GraphicsQueryBufferType::GraphicsPipelineStats)
+    {
+        // The mesh shader statistics of D3D12 have no Vulkan equivalent and are cleared
+        stride = VulkanPipelineStatisticsStride;
+
+        FlushBarriers(commandList);
+        vkCmdFillBuffer(commandList->CommandBufferObject, destinationBuffer->BufferObject, 0, queryCount * stride, 0);
+    }
+
+    // Waits for the queries written before instead of using VK_QUERY_RESULT_WAIT_BIT
+    VkMemoryBarrier2KHR barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR };
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR;
+    FlushBarriers(commandList, &barrier);
+
+    vkCmdCopyQueryPoolResults(commandList->CommandBufferObject, queryBuffer->QueryPool, startIndex, queryCount, destinationBuffer->BufferObject, 0, stride, VK_QUERY_RESULT_64_BIT);
+}
+
+void VulkanGraphicsService::BeginGpuZone(void* commandListPointer, unsigned int nameId, char* name)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+
+    #ifdef DEBUG
+    VkDebugUtilsLabelEXT label = { VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT };
+    label.pLabelName = name;
+
+    vkCmdBeginDebugUtilsLabelEXT(commandList->CommandBufferObject, &label);
+    #endif
+
+    auto zoneIndex = this->gpuZoneProfiler.BeginZone(&commandList->GpuZones, nameId);
+
+    if (zoneIndex != GpuZoneInvalidIndex && (!commandList->CommandQueue->IsCopyCommandQueue || this->isCopyQueueTimestampSupported))
+    {
+        vkCmdWriteTimestamp(commandList->CommandBufferObject, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, this->gpuZoneQueryPool, this->gpuZoneProfiler.GetStartQueryIndex(zoneIndex));
+    }
+}
+
+void VulkanGraphicsService::EndGpuZone(void* commandListPointer)
+{
+    VulkanCommandList* commandList = (VulkanCommandList*)commandListPointer;
+    auto zoneIndex = this->gpuZoneProfiler.EndZone(&commandList->GpuZones);
+
+    if (zoneIndex != GpuZoneInvalidIndex && (!commandList->CommandQueue->IsCopyCommandQueue || this->isCopyQueueTimestampSupported))
+    {
+        vkCmdWriteTimestamp(commandList->CommandBufferObject, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, this->gpuZoneQueryPool, this->gpuZoneProfiler.GetEndQueryIndex(zoneIndex));
+    }
+
+    #ifdef DEBUG
+    vkCmdEndDebugUtilsLabelEXT(commandList->CommandBufferObject);
+    #endif
+}
+
+int VulkanGraphicsService::ResolveGpuZones(struct GraphicsGpuZone* gpuZones, int gpuZonesLength)
+{
+    auto frameIndex = this->gpuZoneProfiler.GetNextFrameIndex();
+    auto queryOffset = this->gpuZoneProfiler.GetFrameQueryOffset(frameIndex);
+    auto queryCount = this->gpuZoneProfiler.GetFrameZoneCount(frameIndex) * 2;
+
+    if (queryCount > 0)
+    {
+        // The frame slot was recorded framesInFlightCount frames ago and the CPU already waited for that
+        // frame, the results are not waited and the queries that are not available are skipped
+        vkGetQueryPoolResults(this->graphicsDevice, this->gpuZoneQueryPool, queryOffset, queryCount, queryCount * 2 * sizeof(uint64_t), this->gpuZoneQueryResults.data(), 2 * sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+        uint32_t resetQueryStart = 0;
+
+        for (uint32_t i = 0; i <= queryCount; i++)
+        {
+            bool isAvailable = i < queryCount && this->gpuZoneQueryResults[i * 2 + 1] != 0;
+
+            if (i < queryCount)
+            {
+                this->gpuZoneTimestamps[i] = isAvailable ? this->gpuZoneQueryResults[i * 2] : 0;
+            }
+
+            // Only the contiguous ranges of available queries are reset. An unavailable query was never written
+            // because its frame was already waited, so it is still in the reset state and can be written again.
+            if (!isAvailable)
+            {
+                if (i > resetQueryStart)
+                {
+                    vkResetQueryPool(this->graphicsDevice, this->gpuZoneQueryPool, queryOffset + resetQueryStart, i - resetQueryStart);
+                }
+
+                resetQueryStart = i + 1;
+            }
+        }
+    }
+
+    return this->gpuZoneProfiler.ResolveZones(this->gpuZoneTimestamps.data(), gpuZones, gpuZonesLength);
+}
+
+void VulkanGraphicsService::SavePipelineCache()
+{
+    size_t dataSize = 0;
+    AssertIfFailed(vkGetPipelineCacheData(this->graphicsDevice, this->pipelineCache, &dataSize, nullptr));
+
+    if (dataSize == 0)
+    {
+        return;
+    }
+
+    vector<uint8_t> data(dataSize);
+    AssertIfFailed(vkGetPipelineCacheData(this->graphicsDevice, this->pipelineCache, &dataSize, data.data()));
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(this->graphicsPhysicalDevice, &properties);
+
+    VulkanPipelineCacheFileHeader header = {};
+    header.Magic = VulkanPipelineCacheFileMagic;
+    header.VendorId = properties.vendorID;
+    header.DeviceId = properties.deviceID;
+    header.DriverVersion = properties.driverVersion;
+    header.DataSize = dataSize;
+    memcpy(header.PipelineCacheUuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    // The cache is written to a temporary file first so that a crash during the save
+    // doesn't leave a truncated cache behind
+    string temporaryFileName = this->pipelineCacheFileName + ".tmp";
+    FILE* file = fopen(temporaryFileName.c_str(), "wb");
+
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    bool isWritten = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(data.data(), dataSize, 1, file) == 1;
+    isWritten = (fclose(file) == 0) && isWritten;
+
+    if (!isWritten || rename(temporaryFileName.c_str(), this->pipelineCacheFileName.c_str()) != 0)
+    {
+        remove(temporaryFileName.c_str());
+    }
+}
+
+VkInstance VulkanGraphicsService::CreateVulkanInstance()
+{
+    VkInstance instance = {};
+
+    VkApplicationInfo appInfo = { VK_STRUCTURE_TYPE_APPLICATION_INFO };
+    appInfo.apiVersion = VK_API_VERSION_1_2;
+
+    VkInstanceCreateInfo createInfo = { VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO };
+
+    createInfo.pApplicationInfo = &appInfo;
+
+#ifdef DEBUG
+    const char* layers[] =
+    {
+        "VK_LAYER_KHRONOS_validation"
+    };
+
+    createInfo.ppEnabledLayerNames = layers;
+	createInfo.enabledLayerCount = ARRAYSIZE(layers);
+#endif
+
+    uint32_t availableExtensionCount = 0;
+    AssertIfFailed(vkEnumerateInstanceExtensionProperties(nullptr, &availableExtensionCount, nullptr));
+
+    vector<VkExtensionProperties> availableExtensions(availableExtensionCount);
+    AssertIfFailed(vkEnumerateInstanceExtensionProperties(nullptr, &availableExtensionCount, availableExtensions.data()));
+
+    vector<const char*> extensions;
+
+#ifdef DEBUG
+    extensions.push_back(VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
+    extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+#endif
+
+    if (VulkanIsExtensionSupported(availableExtensions, VK_KHR_SURFACE_EXTENSION_NAME))
+    {
+        extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+
+#ifdef _WIN32
+        extensions.push_back(VK_KHR_WIN32_SURFACE_EXTENSION_NAME);
+#endif
+
+        if (VulkanIsExtensionSupported(availableExtensions, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME))
+        {
+            extensions.push_back(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
+            this->isHeadlessSurfaceSupported = true;
+        }
+    }
+
+    createInfo.ppEnabledExtensionNames = extensions.data();
+	createInfo.enabledExtensionCount = (uint32_t)extensions.size();
+
+    AssertIfFailed(vkCreateInstance(&createInfo, nullptr, &instance));
+
+    return instance;
+}
+
+VkPhysicalDevice VulkanGraphicsService::FindGraphicsDevice()
+{
+    uint32_t deviceCount = 16;
+    VkPhysicalDevice devices[16];
+
+    AssertIfFailed(vkEnumeratePhysicalDevices(this->vulkanInstance, &deviceCount, nullptr));
+    assert(deviceCount > 0 && deviceCount <= ARRAYSIZE(devices));
+    AssertIfFailed(vkEnumeratePhysicalDevices(this->vulkanInstance, &deviceCount, devices));
+
+    // Prefer a discrete GPU with mesh shaders, otherwise fallback to the first device that supports
+    // Vulkan 1.2 and synchronization2 (integrated GPUs or software rasterizers like lavapipe)
+    int selectedDeviceIndex = -1;
+    int selectedDeviceScore = -1;
+
+    for (int i = 0; i < deviceCount; i++)
+    {
+        VkPhysicalDeviceProperties deviceProperties;
+        vkGetPhysicalDeviceProperties(devices[i], &deviceProperties);
+
+        if (deviceProperties.apiVersion < VK_API_VERSION_1_2)
+        {
+            continue;
+        }
+
+        uint32_t availableExtensionCount = 0;
+        AssertIfFailed(vkEnumerateDeviceExtensionProperties(devices[i], nullptr, &availableExtensionCount, nullptr));
+
+        vector<VkExtensionProperties> availableExtensions(availableExtensionCount);
+        AssertIfFailed(vkEnumerateDeviceExtensionProperties(devices[i], nullptr, &availableExtensionCount, availableExtensions.data()));
+
+        // Barriers and submits are recorded with synchronization2 that is not core in Vulkan 1.2
+        if (!VulkanIsExtensionSupported(availableExtensions, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        {
+            continue;
+        }
+
+        VkPhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures = {};
+        meshShaderFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV;
+
+        VkPhysicalDeviceSynchronization2FeaturesKHR sync2Features = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR };
+        sync2Features.pNext = &meshShaderFeatures;
+
+        VkPhysicalDeviceFeatures2 features2 = {};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+        features2.pNext = &sync2Features;
+
+        vkGetPhysicalDeviceFeatures2(devices[i], &features2);
+
+        if (!sync2Features.synchronization2)
+        {
+            continue;
+        }
+
+        int deviceScore = 0;
+
+        if (deviceProperties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU)
+        {
+            deviceScore += 2;
+        }
+
+        if (meshShaderFeatures.meshShader && meshShaderFeatures.taskShader)
+        {
+            deviceScore += 4;
+        }
+
+        if (deviceScore > selectedDeviceScore)
+        {
+            selectedDeviceIndex = i;
+            selectedDeviceScore = deviceScore;
+        }
+    }
+
+    if (selectedDeviceIndex == -1)
+    {
+        printf("VULKAN ERROR: No device supports Vulkan 1.2 and %s\n", VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+        fflush(stdout);
+        abort();
+    }
+
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(devices[selectedDeviceIndex], &deviceProperties);
+
+    this->deviceName = string(deviceProperties.deviceName);
+    this->deviceName += " (Vulkan " + to_string(VK_API_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." + to_string(VK_API_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." + to_string(VK_API_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE)) + ")";
+
+    return devices[selectedDeviceIndex];
+}
+
+VkDevice VulkanGraphicsService::CreateDevice(VkPhysicalDevice physicalDevice)
+{
+    VkDevice device;
+
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+
+    vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+    // Use dedicated compute and copy families when they exist, otherwise share the render family
+    this->renderCommandQueueFamilyIndex = UINT32_MAX;
+    this->computeCommandQueueFamilyIndex = UINT32_MAX;
+    this->copyCommandQueueFamilyIndex = UINT32_MAX;
+
+    for (uint32_t i = 0; i < queueFamilyCount; i++)
+    {
+        auto queueFlags = queueFamilies[i].queueFlags;
+
+        if ((queueFlags & VK_QUEUE_GRAPHICS_BIT) && this->renderCommandQueueFamilyIndex == UINT32_MAX)
+        {
+            this->renderCommandQueueFamilyIndex = i;
+        }
+
+        else if ((queueFlags & VK_QUEUE_COMPUTE_BIT) && !(queueFlags & VK_QUEUE_GRAPHICS_BIT) && this->computeCommandQueueFamilyIndex == UINT32_MAX)
+        {
+            this->computeCommandQueueFamilyIndex = i;
+        }
+
+        else if ((queueFlags & VK_QUEUE_TRANSFER_BIT) && !(queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) && this->copyCommandQueueFamilyIndex == UINT32_MAX)
+        {
+            this->copyCommandQueueFamilyIndex = i;
+        }
+    }
+
+    assert(this->renderCommandQueueFamilyIndex != UINT32_MAX);
+
+    if (this->computeCommandQueueFamilyIndex == UINT32_MAX)
+    {
+        this->computeCommandQueueFamilyIndex = this->renderCommandQueueFamilyIndex;
+    }
+
+    if (this->copyCommandQueueFamilyIndex == UINT32_MAX)
+    {
+        this->copyCommandQueueFamilyIndex = this->computeCommandQueueFamilyIndex;
+    }
+
+    uint32_t queueCreateInfoCount = 0;
+    VkDeviceQueueCreateInfo queueCreateInfos[3];
+
+    uint32_t queueFamilyIndices[] = { this->renderCommandQueueFamilyIndex, this->computeCommandQueueFamilyIndex, this->copyCommandQueueFamilyIndex };
+
+    for (uint32_t i = 0; i < ARRAYSIZE(queueFamilyIndices); i++)
+    {
+        bool isAlreadyAdded = false;
+
+        for (uint32_t j = 0; j < queueCreateInfoCount; j++)
+        {
+            isAlreadyAdded |= (queueCreateInfos[j].queueFamilyIndex == queueFamilyIndices[i]);
+        }
+
+        if (!isAlreadyAdded)
+        {
+            queueCreateInfos[queueCreateInfoCount++] = CreateDeviceQueueCreateInfo(queueFamilyIndices[i], 1);
+        }
+    }
+
+    // Timestamps can only be written on queues with valid timestamp bits
+    this->isCopyQueueTimestampSupported = queueFamilies[this->copyCommandQueueFamilyIndex].timestampValidBits > 0;
+
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &this->deviceMemoryProperties);
+
+    for (uint32_t i = 0; i < VK_MAX_MEMORY_HEAPS; i++)
+    {
+        this->memoryHeapUsages[i] = 0;
+    }
+
+    this->gpuMemoryTypeIndex = VulkanFindMemoryTypeIndex(this->deviceMemoryProperties, UINT32_MAX, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    // Read back heaps are invalidated before each read so cached memory is used even if it is not coherent
+    this->readBackMemoryTypeIndex = VulkanFindMemoryTypeIndex(this->deviceMemoryProperties, UINT32_MAX, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+    this->uploadMemoryTypeIndex = VulkanFindMemoryTypeIndex(this->deviceMemoryProperties, UINT32_MAX, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    // DEVICE_LOCAL | HOST_VISIBLE memory (BAR or resizable BAR) is written directly by the CPU for small per frame data
+    this->gpuUploadMemoryTypeIndex = VulkanFindMemoryTypeIndex(this->deviceMemoryProperties, UINT32_MAX, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0);
+
+    if (this->gpuUploadMemoryTypeIndex == UINT32_MAX)
+    {
+        this->gpuUploadMemoryTypeIndex = this->uploadMemoryTypeIndex;
+    }
+
+    uint32_t availableExtensionCount = 0;
+    AssertIfFailed(vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableExtensionCount, nullptr));
+
+    vector<VkExtensionProperties> availableExtensions(availableExtensionCount);
+    AssertIfFailed(vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableExtensionCount, availableExtensions.data()));
+
+    vector<const char*> extensions;
+    extensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    extensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+
+    this->isSwapChainSupported = VulkanIsExtensionSupported(availableExtensions, VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    this->isMutableSwapChainFormatSupported = this->isSwapChainSupported && VulkanIsExtensionSupported(availableExtensions, VK_KHR_SWAPCHAIN_MUTABLE_FORMAT_EXTENSION_NAME);
+    this->isMeshShaderSupported = VulkanIsExtensionSupported(availableExtensions, VK_NV_MESH_SHADER_EXTENSION_NAME);
+    this->isDeviceGeneratedCommandsSupported = this->isMeshShaderSupported && VulkanIsExtensionSupported(availableExtensions, VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME);
+    this->isDescriptorBufferSupported = VulkanIsExtensionSupported(availableExtensions, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    this->isMemoryBudgetSupported = VulkanIsExtensionSupported(availableExtensions, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    this->isCalibratedTimestampsSupported = VulkanIsExtensionSupported(availableExtensions, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+
+    if (!this->isMeshShaderSupported)
+    {
+        printf("\033[93mVULKAN WARNING: %s is not supported, graphics pipelines are not created and DispatchMesh only clears the render targets\n\033[0m", VK_NV_MESH_SHADER_EXTENSION_NAME);
+    }
+
+    if (this->isCalibratedTimestampsSupported)
+    {
+        uint32_t timeDomainCount = 0;
+        AssertIfFailed(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, &timeDomainCount, nullptr));
+
+        vector<VkTimeDomainEXT> timeDomains(timeDomainCount);
+        AssertIfFailed(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, &timeDomainCount, timeDomains.data()));
+
+        this->isCalibratedTimestampsSupported = find(timeDomains.begin(), timeDomains.end(), VK_TIME_DOMAIN_DEVICE_EXT) != timeDomains.end() &&
+                                                find(timeDomains.begin(), timeDomains.end(), VulkanHostTimeDomain) != timeDomains.end();
+    }
+
+    if (this->isSwapChainSupported)
+    {
+        extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
+
+    if (this->isMutableSwapChainFormatSupported)
+    {
+        extensions.push_back(VK_KHR_SWAPCHAIN_MUTABLE_FORMAT_EXTENSION_NAME);
+    }
+
+    if (this->isMeshShaderSupported)
+    {
+        extensions.push_back(VK_NV_MESH_SHADER_EXTENSION_NAME);
+    }
+
+    if (this->isDeviceGeneratedCommandsSupported)
+    {
+        extensions.push_back(VK_NV_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME);
+    }
+
+    if (this->isMemoryBudgetSupported)
+    {
+        extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
+    if (this->isCalibratedTimestampsSupported)
+    {
+        extensions.push_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+    }
+
+    VkDeviceCreateInfo createInfo = { VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
+    createInfo.queueCreateInfoCount = queueCreateInfoCount;
+    createInfo.pQueueCreateInfos = queueCreateInfos;
+
+    VkPhysicalDeviceMeshShaderFeaturesNV meshFeatures = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV };
+    meshFeatures.meshShader = true;
+    meshFeatures.taskShader = true;
+
+    VkPhysicalDeviceSynchronization2FeaturesKHR sync2Features = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR };
+    sync2Features.synchronization2 = true;
+    sync2Features.pNext = this->isMeshShaderSupported ? &meshFeatures : nullptr;
+
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT supportedDescriptorBufferFeatures = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT };
+
+    VkPhysicalDeviceVulkan12Features supportedFeatures = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES };
+    supportedFeatures.pNext = this->isDescriptorBufferSupported ? &supportedDescriptorBufferFeatures : nullptr;
+
+    VkPhysicalDeviceFeatures2 supportedFeatures2 = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2 };
+    supportedFeatures2.pNext = &supportedFeatures;
+    vkGetPhysicalDeviceFeatures2(physicalDevice, &supportedFeatures2);
+
+    // Descriptor buffers reference the storage buffers by their device address
+    this->isDescriptorBufferSupported = this->isDescriptorBufferSupported && supportedDescriptorBufferFeatures.descriptorBuffer && supportedFeatures.bufferDeviceAddress;
+
+    if (this->isDescriptorBufferSupported)
+    {
+        extensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    }
+
+    createInfo.ppEnabledExtensionNames = extensions.data();
+    createInfo.enabledExtensionCount = (uint32_t)extensions.size();
+
+    this->isPipelineStatisticsSupported = supportedFeatures2.features.pipelineStatisticsQuery;
+
+    VkPhysicalDeviceFeatures enabledFeatures = {};
+    enabledFeatures.pipelineStatisticsQuery = this->isPipelineStatisticsSupported;
+    createInfo.pEnabledFeatures = &enabledFeatures;
+
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT };
+    descriptorBufferFeatures.descriptorBuffer = true;
+    descriptorBufferFeatures.pNext = sync2Features.pNext;
+
+    if (this->isDescriptorBufferSupported)
+    {
+        sync2Features.pNext = &descriptorBufferFeatures;
+    }
+
+    VkPhysicalDeviceVulkan12Features features = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES };
+    features.timelineSemaphore = true;
+    features.runtimeDescriptorArray = true;
+    features.descriptorIndexing = true;
+    features.descriptorBindingVariableDescriptorCount = true;
+    features.descriptorBindingPartiallyBound = true;
+    features.descriptorBindingSampledImageUpdateAfterBind = true;
+    features.descriptorBindingStorageBufferUpdateAfterBind = true;
+    features.descriptorBindingStorageImageUpdateAfterBind = true;
+    features.shaderSampledImageArrayNonUniformIndexing = true;
+    features.separateDepthStencilLayouts = true;
+    features.hostQueryReset = true;
+    features.shaderInt8 = supportedFeatures.shaderInt8;
+    features.bufferDeviceAddress = this->isDescriptorBufferSupported;
+
+    #ifdef DEBUG
+    features.bufferDeviceAddressCaptureReplay = supportedFeatures.bufferDeviceAddressCaptureReplay;
+    #endif
+
+    features.pNext = &sync2Features;
+
+    createInfo.pNext = &features;
+
+    AssertIfFailed(vkCreateDevice(physicalDevice, &createInfo, nullptr, &device));
+    
+    return device;
+}
+
+static VkBool32 VKAPI_CALL DebugReportCallback(VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage, void* pUserData)
+{
+	// This silences warnings like "For optimal performance image layout should be VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL instead of GENERAL."
+	// We'll assume other performance warnings are also not useful.
+	// if (flags & VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT)
+    // {
+	// 	return VK_FALSE;
+    // }
+
+	const char* type = "[93mVULKAN INFO";
+
+	if (flags & VK_DEBUG_REPORT_ERROR_BIT_EXT)
+    {
+        type = "[91mVULKAN ERROR";
+    }
+
+    else if (flags & VK_DEBUG_REPORT_WARNING_BIT_EXT)
+    {
+	    type = "[93mVULKAN WARNING";
+    }
+
+	char message[4096];
+	snprintf(message, 4096, "%s: %s\n[0m", type, pMessage);
+
+	printf("%s", message);
+
+#ifdef _WIN32
+	OutputDebugStringA(message);
+#endif
+
+	if (flags & VK_DEBUG_REPORT_ERROR_BIT_EXT)
+    {
+		// assert(!"Vulkan validation error encountered!");
+    }
+
+	return VK_FALSE;
+}
+
+void VulkanGraphicsService::RegisterDebugCallback()
+{
+	VkDebugReportCallbackCreateInfoEXT createInfo = { VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT };
+	createInfo.flags = VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT | VK_DEBUG_REPORT_ERROR_BIT_EXT;
+	createInfo.pfnCallback = DebugReportCallback;
+
+	AssertIfFailed(vkCreateDebugReportCallbackEXT(this->vulkanInstance, &createInfo, 0, &this->debugCallback));
+}
+
+string VulkanGraphicsService::GetPipelineCacheFileName()
+{
+    // The cache is stored next to the executable so that it doesn't depend on the current directory
+#ifdef _WIN32
+    char executablePath[MAX_PATH];
+    auto size = GetModuleFileNameA(NULL, executablePath, MAX_PATH);
+    auto separator = '\\';
+#else
+    char executablePath[PATH_MAX];
+    auto size = readlink("/proc/self/exe", executablePath, PATH_MAX - 1);
+    auto separator = '/';
+#endif
+
+    if (size <= 0)
+    {
+        return VulkanPipelineCacheFileName;
+    }
+
+    string directoryPath = string(executablePath, size);
+    auto pos = directoryPath.find_last_of(separator);
+
+    if (pos == string::npos)
+    {
+        return VulkanPipelineCacheFileName;
+    }
+
+    return directoryPath.substr(0, pos + 1) + VulkanPipelineCacheFileName;
+}
+
+VkPipelineCache VulkanGraphicsService::CreatePipelineCache()
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(this->graphicsPhysicalDevice, &properties);
+
+    this->pipelineCacheFileName = GetPipelineCacheFileName();
+
+    vector<uint8_t> data;
+    FILE* file = fopen(this->pipelineCacheFileName.c_str(), "rb");
+
+    if (file != nullptr)
+    {
+        VulkanPipelineCacheFileHeader header = {};
+
+        // A cache saved by another device or driver version is ignored and overwritten at shutdown
+        if (fread(&header, sizeof(header), 1, file) == 1 &&
+            header.Magic == VulkanPipelineCacheFileMagic &&
+            header.VendorId == properties.vendorID &&
+            header.DeviceId == properties.deviceID &&
+            header.DriverVersion == properties.driverVersion &&
+            memcmp(header.PipelineCacheUuid, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+            header.DataSize > 0)
+        {
+            data.resize(header.DataSize);
+
+            if (fread(data.data(), header.DataSize, 1, file) != 1)
+            {
+                data.clear();
+            }
+        }
+
+        fclose(file);
+    }
+
+    VkPipelineCacheCreateInfo createInfo = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+    createInfo.initialDataSize = data.size();
+    createInfo.pInitialData = data.data();
+
+    VkPipelineCache pipelineCache = nullptr;
+
+    if (vkCreatePipelineCache(this->graphicsDevice, &createInfo, nullptr, &pipelineCache) != VK_SUCCESS && !data.empty())
+    {
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+
+        AssertIfFailed(vkCreatePipelineCache(this->graphicsDevice, &createInfo, nullptr, &pipelineCache));
+    }
+
+    return pipelineCache;
+}
+
+VkSurfaceKHR VulkanGraphicsService::CreateWindowSurface(void* windowPointer)
+{
+    VkSurfaceKHR surface = nullptr;
+
+#ifdef _WIN32
+    if (windowPointer != nullptr)
+    {
+        VkWin32SurfaceCreateInfoKHR surfaceCreateInfo = { VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR };
+        surfaceCreateInfo.hinstance = GetModuleHandle(nullptr);
+        surfaceCreateInfo.hwnd = (HWND)windowPointer;
+
+        AssertIfFailed(vkCreateWin32SurfaceKHR(this->vulkanInstance, &surfaceCreateInfo, nullptr, &surface));
+        return surface;
+    }
+#endif
+
+    // The Linux host windows are not backed by a display server so they use a headless surface
+    if (this->isHeadlessSurfaceSupported && this->isSwapChainSupported)
+    {
+        VkHeadlessSurfaceCreateInfoEXT surfaceCreateInfo = { VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT };
+        AssertIfFailed(vkCreateHeadlessSurfaceEXT(this->vulkanInstance, &surfaceCreateInfo, nullptr, &surface));
+    }
+
+    return surface;
+}
+
+void VulkanGraphicsService::CreateSwapChainBackBuffers(VulkanSwapChain* swapChain, VkFormat textureFormat, int width, int height)
+{
+    VkSwapchainKHR oldSwapchain = swapChain->SwapChainObject;
+
+    VkSurfaceCapabilitiesKHR surfaceCapabilities;
+    AssertIfFailed(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(this->graphicsPhysicalDevice, swapChain->WindowSurface, &surfaceCapabilities));
+
+    uint32_t minImageCount = swapChain->RequestedBackBufferCount;
+
+    if (minImageCount < surfaceCapabilities.minImageCount)
+    {
+        minImageCount = surfaceCapabilities.minImageCount;
+    }
+
+    if (surfaceCapabilities.maxImageCount > 0 && minImageCount > surfaceCapabilities.maxImageCount)
+    {
+        minImageCount = surfaceCapabilities.maxImageCount;
+    }
+
+    VkFormat formatList[] = 
+    {
+        swapChain->Format,
+        textureFormat
+    };
+
+    VkImageFormatListCreateInfo imageFormatListCreateInfo = { VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO };
+    imageFormatListCreateInfo.pViewFormats = formatList;
+    imageFormatListCreateInfo.viewFormatCount = ARRAYSIZE(formatList);
+
+    VkSwapchainCreateInfoKHR swapChainCreateInfo = { VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR };
+    swapChainCreateInfo.surface = swapChain->WindowSurface;
+    swapChainCreateInfo.minImageCount = minImageCount;
+    swapChainCreateInfo.imageFormat = swapChain->Format;
+    swapChainCreateInfo.imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+    swapChainCreateInfo.imageExtent.width = width;
+    swapChainCreateInfo.imageExtent.height = height;
+    swapChainCreateInfo.imageArrayLayers = 1;
+    swapChainCreateInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    swapChainCreateInfo.presentMode = swapChain->PresentMode;
+    swapChainCreateInfo.preTransform = surfaceCapabilities.currentTransform;
+    swapChainCreateInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    swapChainCreateInfo.oldSwapchain = oldSwapchain;
+
+    if (this->isMutableSwapChainFormatSupported)
+    {
+        swapChainCreateInfo.flags = VK_SWAPCHAIN_CREATE_MUTABLE_FORMAT_BIT_KHR;
+        swapChainCreateInfo.pNext = &imageFormatListCreateInfo;
+    }
+
+    else
+    {
+        // Without mutable format support the swap chain is created directly with the view format
+        swapChainCreateInfo.imageFormat = textureFormat;
+    }
+
+    AssertIfFailed(vkCreateSwapchainKHR(this->graphicsDevice, &swapChainCreateInfo, nullptr, &swapChain->SwapChainObject));
+
+	uint32_t swapchainImageCount = 0;
+	AssertIfFailed(vkGetSwapchainImagesKHR(this->graphicsDevice, swapChain->SwapChainObject, &swapchainImageCount, nullptr));
+    assert(swapchainImageCount <= VulkanMaxSwapChainImageCount);
+	
+    VkImage swapchainImages[VulkanMaxSwapChainImageCount];
+	AssertIfFailed(vkGetSwapchainImagesKHR(this->graphicsDevice, swapChain->SwapChainObject, &swapchainImageCount, swapchainImages));
+
+    for (uint32_t i = 0; i < swapchainImageCount; i++)
+    {
+        VulkanTexture* backBufferTexture = new VulkanTexture();
+        backBufferTexture->TextureObject = swapchainImages[i];
+        backBufferTexture->IsPresentTexture = true;
+        backBufferTexture->ImageView = CreateImageView(this->graphicsDevice, swapchainImages[i], textureFormat, 0, 1);
+        backBufferTexture->Width = width;
+        backBufferTexture->Height = height;
+        backBufferTexture->ResourceState.Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        backBufferTexture->Format = textureFormat;
+
+        swapChain->BackBufferTextures[i] = backBufferTexture;
+    }
+
+    swapChain->BackBufferCount = swapchainImageCount;
+
+    if (oldSwapchain != nullptr)
+    {
+        vkDestroySwapchainKHR(this->graphicsDevice, oldSwapchain, nullptr);
+    }
+}
+
+void VulkanGraphicsService::CreateOffscreenBackBuffers(VulkanSwapChain* swapChain, VkFormat textureFormat, int width, int height)
+{
+    for (uint32_t i = 0; i < swapChain->RequestedBackBufferCount; i++)
+    {
+        VkImageCreateInfo createInfo = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+        createInfo.imageType = VK_IMAGE_TYPE_2D;
+        createInfo.format = textureFormat;
+        createInfo.extent.width = width;
+        createInfo.extent.height = height;
+        createInfo.extent.depth = 1;
+        createInfo.mipLevels = 1;
+        createInfo.arrayLayers = 1;
+        createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        createInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
+        VulkanTexture* backBufferTexture = new VulkanTexture();
+        AssertIfFailed(vkCreateImage(this->graphicsDevice, &createInfo, nullptr, &backBufferTexture->TextureObject));
+
+        VkMemoryRequirements memoryRequirements = {};
+        vkGetImageMemoryRequirements(this->graphicsDevice, backBufferTexture->TextureObject, &memoryRequirements);
+
+        VkPhysicalDeviceMemoryProperties deviceMemoryProperties;
+        vkGetPhysicalDeviceMemoryProperties(this->graphicsPhysicalDevice, &deviceMemoryProperties);
+
+        VkMemoryAllocateInfo allocateInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        allocateInfo.allocationSize = memoryRequirements.size;
+        allocateInfo.memoryTypeIndex = VulkanFindMemoryTypeIndex(deviceMemoryProperties, memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+        AssertIfFailed(vkAllocateMemory(this->graphicsDevice, &allocateInfo, nullptr, &swapChain->OffscreenDeviceMemory[i]));
+        AssertIfFailed(vkBindImageMemory(this->graphicsDevice, backBufferTexture->TextureObject, swapChain->OffscreenDeviceMemory[i], 0));
+
+        // The offscreen images are never presented so they are treated like regular render targets
+        backBufferTexture->IsPresentTexture = false;
+        backBufferTexture->ImageView = CreateImageView(this->graphicsDevice, backBufferTexture->TextureObject, textureFormat, 0, 1);
+        backBufferTexture->Width = width;
+        backBufferTexture->Height = height;
+        backBufferTexture->ResourceState.Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        backBufferTexture->Format = textureFormat;
+
+        swapChain->BackBufferTextures[i] = backBufferTexture;
+    }
+
+    swapChain->BackBufferCount = swapChain->RequestedBackBufferCount;
+}
+
+void VulkanGraphicsService::DeleteSwapChainBackBuffers(VulkanSwapChain* swapChain)
+{
+    for (uint32_t i = 0; i < swapChain->BackBufferCount; i++)
+    {
+        DeleteTexture(swapChain->BackBufferTextures[i]);
+        swapChain->BackBufferTextures[i] = nullptr;
+
+        DeferDelete(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)swapChain->OffscreenDeviceMemory[i]);
+        swapChain->OffscreenDeviceMemory[i] = nullptr;
+    }
+
+    swapChain->BackBufferCount = 0;
+}
+
+void VulkanGraphicsService::CreateSwapChainSemaphores(VulkanSwapChain* swapChain)
+{
+    for (uint32_t i = 0; i < VulkanMaxFramesInFlightCount; i++)
+    {
+        swapChain->AcquireSemaphores[i] = VulkanCreateSemaphore(this->graphicsDevice);
+    }
+
+    for (uint32_t i = 0; i < VulkanMaxSwapChainImageCount; i++)
+    {
+        swapChain->PresentSemaphores[i] = VulkanCreateSemaphore(this->graphicsDevice);
+    }
+}
+
+void VulkanGraphicsService::DeleteSwapChainSemaphores(VulkanSwapChain* swapChain)
+{
+    for (uint32_t i = 0; i < VulkanMaxFramesInFlightCount; i++)
+    {
+        vkDestroySemaphore(this->graphicsDevice, swapChain->AcquireSemaphores[i], nullptr);
+        swapChain->AcquireSemaphores[i] = nullptr;
+    }
+
+    for (uint32_t i = 0; i < VulkanMaxSwapChainImageCount; i++)
+    {
+        vkDestroySemaphore(this->graphicsDevice, swapChain->PresentSemaphores[i], nullptr);
+        swapChain->PresentSemaphores[i] = nullptr;
+    }
+}
+
+VulkanCommandPool*VulkanGraphicsService::GetCurrentThreadCommandPool(VulkanCommandQueue* commandQueue)
+{
+    uint32_t threadIndex = VulkanGetCurrentThreadIndex();
+    VulkanCommandPool* commandPool = commandQueue->CommandPools[this->currentCommandPoolIndex][threadIndex];
+
+    if (commandPool == nullptr)
+    {
+        // Command buffers are only reset all at once with the pool so we don't need the individual reset flag
+        VkCommandPoolCreateInfo createInfo = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        createInfo.queueFamilyIndex = commandQueue->CommandQueueFamilyIndex;
+
+        commandPool = new VulkanCommandPool();
+        AssertIfFailed(vkCreateCommandPool(this->graphicsDevice, &createInfo, 0, &commandPool->CommandPoolObject));
+
+        #ifdef DEBUG
+        VkDebugUtilsObjectNameInfoEXT nameInfo = { VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT };
+        nameInfo.objectType = VK_OBJECT_TYPE_COMMAND_POOL;
+        nameInfo.objectHandle = (uint64_t)commandPool->CommandPoolObject;
+        nameInfo.pObjectName = commandQueue->Label.c_str();
+
+        AssertIfFailed(vkSetDebugUtilsObjectNameEXT(this->graphicsDevice, &nameInfo));
+        #endif
+
+        commandQueue->CommandPools[this->currentCommandPoolIndex][threadIndex] = commandPool;
+    }
+
+    return commandPool;
+}
+
+void VulkanGraphicsService::BeginCommandBuffer(VulkanCommandList* commandList)
+{
+    VulkanCommandPool* commandPool = GetCurrentThreadCommandPool(commandList->CommandQueue);
+
+    if (commandPool->UsedCommandBufferCount == commandPool->CommandBuffers.size())
+    {
+        VkCommandBufferAllocateInfo allocateInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        allocateInfo.commandPool = commandPool->CommandPoolObject;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer = 0;
+        AssertIfFailed(vkAllocateCommandBuffers(this->graphicsDevice, &allocateInfo, &commandBuffer));
+        commandPool->CommandBuffers.push_back(commandBuffer);
+    }
+
+    commandList->CommandBufferObject = commandPool->CommandBuffers[commandPool->UsedCommandBufferCount++];
+    commandList->CommandPool = commandPool;
+    commandList->IsRenderPassActive = false;
+    commandList->CurrentPipelineState = nullptr;
+    commandList->CurrentResourceHeap = nullptr;
+    commandList->CurrentShader = nullptr;
+    commandList->BoundDescriptorBufferAddress = 0;
+    commandList->GpuZones.Depth = 0;
+    commandList->BufferBarriers.clear();
+    commandList->TextureBarriers.clear();
+    commandList->ResourceStates.clear();
+    commandList->ResourceStateIndices.clear();
+
+    VkCommandBufferBeginInfo beginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    AssertIfFailed(vkBeginCommandBuffer(commandList->CommandBufferObject, &beginInfo));
+}
+
+VkFramebuffer VulkanGraphicsService::GetFrameBuffer(VkRenderPass renderPass, VkImageView* imageViews, uint32_t imageViewCount, uint32_t width, uint32_t height)
+{
+    VulkanFrameBufferKey key = {};
+    key.RenderPass = renderPass;
+    key.ImageViewCount = imageViewCount;
+    key.Width = width;
+    key.Height = height;
+
+    for (uint32_t i = 0; i < imageViewCount; i++)
+    {
+        key.ImageViews[i] = imageViews[i];
+    }
+
+    lock_guard<mutex> lock(this->frameBufferCacheLock);
+    auto cacheEntry = this->frameBufferCache.find(key);
+
+    if (cacheEntry != this->frameBufferCache.end())
+    {
+        return cacheEntry->second;
+    }
+
+    auto frameBuffer = CreateFramebuffer(this->graphicsDevice, renderPass, imageViews, imageViewCount, width, height);
+    this->frameBufferCache[key] = frameBuffer;
+
+    return frameBuffer;
+}
+
+void VulkanGraphicsService::RemoveCachedFrameBuffers(VkRenderPass renderPass, VkImageView imageView)
+{
+    lock_guard<mutex> lock(this->frameBufferCacheLock);
+
+    for (auto cacheEntry = this->frameBufferCache.begin(); cacheEntry != this->frameBufferCache.end();)
+    {
+        auto& key = cacheEntry->first;
+        bool isMatching = (renderPass != nullptr && key.RenderPass == renderPass);
+
+        for (uint32_t i = 0; i < key.ImageViewCount; i++)
+        {
+            isMatching |= (imageView != nullptr && key.ImageViews[i] == imageView);
+        }
+
+        if (isMatching)
+        {
+            // The frame buffer can still be used by the GPU so the destruction is delayed
+            DeferDelete(VK_OBJECT_TYPE_FRAMEBUFFER, (uint64_t)cacheEntry->second);
+            cacheEntry = this->frameBufferCache.erase(cacheEntry);
+        }
+
+        else
+        {
+            cacheEntry++;
+        }
+    }
+}
+
+void VulkanGraphicsService::DeferDelete(VkObjectType objectType, uint64_t objectHandle)
+{
+    if (objectHandle == 0)
+    {
+        return;
+    }
+
+    VulkanDeferredDelete deferredDelete = {};
+    deferredDelete.ObjectType = objectType;
+    deferredDelete.ObjectHandle = objectHandle;
+
+    // The fence values are written by the submits so they are read under the submit lock, it is
+    // always taken before the deferred deletes lock
+    lock_guard<mutex> submitLockGuard(this->submitLock);
+    lock_guard<mutex> lock(this->deferredDeletesLock);
+
+    for (uint32_t i = 0; i < VulkanMaxCommandQueueCount; i++)
+    {
+        if (this->commandQueues[i] != nullptr)
+        {
+            deferredDelete.FenceValues[i] = this->commandQueues[i]->FenceValue;
+        }
+    }
+
+    this->deferredDeletes.push_back(deferredDelete);
+}
+
+void VulkanGraphicsService::ProcessDeferredDeletes(bool isGpuIdle)
+{
+    lock_guard<mutex> lock(this->deferredDeletesLock);
+
+    if (this->deferredDeletes.size() == 0)
+    {
+        return;
+    }
+
+    uint64_t completedFenceValues[VulkanMaxCommandQueueCount] = {};
+
+    for (uint32_t i = 0; i < VulkanMaxCommandQueueCount; i++)
+    {
+        if (isGpuIdle)
+        {
+            completedFenceValues[i] = UINT64_MAX;
+        }
+
+        else if (this->commandQueues[i] != nullptr)
+        {
+            AssertIfFailed(vkGetSemaphoreCounterValue(this->graphicsDevice, this->commandQueues[i]->TimelineSemaphore, &completedFenceValues[i]));
+        }
+    }
+
+    // Fence values only grow so the deletes are ordered, we can stop at the first one that is still in use
+    uint32_t retiredCount = 0;
+
+    for (; retiredCount < this->deferredDeletes.size(); retiredCount++)
+    {
+        VulkanDeferredDelete& deferredDelete = this->deferredDeletes[retiredCount];
+        bool isCompleted = true;
+
+        for (uint32_t i = 0; i < VulkanMaxCommandQueueCount; i++)
+        {
+            if (deferredDelete.FenceValues[i] > completedFenceValues[i])
+            {
+                isCompleted = false;
+                break;
+            }
+        }
+
+        if (!isCompleted)
+        {
+            break;
+        }
+
+        VulkanDestroyObject(this->graphicsDevice, deferredDelete.ObjectType, deferredDelete.ObjectHandle);
+    }
+
+    this->deferredDeletes.erase(this->deferredDeletes.begin(), this->deferredDeletes.begin() + retiredCount);
+}
+
+void VulkanGraphicsService::AddSubmitSemaphore(VkSemaphore semaphore, uint64_t value)
+{
+    VkSemaphoreSubmitInfoKHR semaphoreInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR };
+    semaphoreInfo.semaphore = semaphore;
+    semaphoreInfo.value = value;
+    semaphoreInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+
+    this->submitSemaphoreInfos.push_back(semaphoreInfo);
+}
+
+void VulkanGraphicsService::MoveOwnershipTransfers(VulkanCommandList* commandList)
+{
+    if (this->renderCommandQueueFamilyIndex == this->computeCommandQueueFamilyIndex && this->renderCommandQueueFamilyIndex == this->copyCommandQueueFamilyIndex)
+    {
+        return;
+    }
+
+    VulkanCommandQueue* commandQueue = commandList->CommandQueue;
+
+    for (auto& resourceState : commandList->ResourceStates)
+    {
+        // The CPU heaps are only read by the host and the present textures stay on the present queue
+        if (!resourceState.IsWritten || (resourceState.GraphicsBuffer != nullptr && resourceState.GraphicsBuffer->GraphicsHeap->Type != GraphicsServiceHeapType::Gpu) || (resourceState.Texture != nullptr && resourceState.Texture->IsPresentTexture))
+        {
+            continue;
+        }
+
+        // The resource is released in the last state it has in the command list
+        VulkanOwnershipTransfer ownershipTransfer = { resourceState.GraphicsBuffer, resourceState.Texture, resourceState.LastState.Stage, resourceState.LastState.Access, resourceState.LastState.Layout };
+        auto& ownershipTransferQueue = GetOwnershipTransferQueue(ownershipTransfer);
+
+        // The content of a resource written again is replaced so the previous release is not needed anymore
+        if (ownershipTransferQueue != nullptr)
+        {
+            RemoveOwnershipTransfer(ownershipTransferQueue, ownershipTransfer.GraphicsBuffer, ownershipTransfer.Texture);
+        }
+
+        ownershipTransferQueue = commandQueue;
+        commandQueue->OwnershipTransfers.push_back(ownershipTransfer);
+    }
+}
+
+void VulkanGraphicsService::RemoveOwnershipTransfer(VulkanCommandQueue* commandQueue, VulkanGraphicsBuffer* graphicsBuffer, VulkanTexture* texture)
+{
+    auto& ownershipTransfers = commandQueue->OwnershipTransfers;
+
+    for (uint32_t i = 0; i < ownershipTransfers.size(); i++)
+    {
+        if (ownershipTransfers[i].GraphicsBuffer == graphicsBuffer && ownershipTransfers[i].Texture == texture)
+        {
+            ownershipTransfers.erase(ownershipTransfers.begin() + i);
+            break;
+        }
+    }
+}
+
+// Releases the resources written by the waited queue to the family of the acquire command list. The release
+// is submitted on the waited queue after its work and the destination queue also waits for it.
+void VulkanGraphicsService::TransferQueueOwnership(VulkanCommandQueue* commandQueueToWait, VulkanCommandList* acquireCommandList)
+{
+    VulkanCommandQueue* commandQueue = acquireCommandList->CommandQueue;
+
+    if (commandQueueToWait == commandQueue || commandQueueToWait->OwnershipTransfers.empty())
+    {
+        return;
+    }
+
+    if (commandQueueToWait->CommandQueueFamilyIndex == commandQueue->CommandQueueFamilyIndex)
+    {
+        // The family already owns the resources, they follow the queue until a queue of another family waits for it
+        for (auto& ownershipTransfer : commandQueueToWait->OwnershipTransfers)
+        {
+            auto& ownershipTransferQueue = GetOwnershipTransferQueue(ownershipTransfer);
+
+            if (ownershipTransferQueue != commandQueue)
+            {
+                ownershipTransferQueue = commandQueue;
+                commandQueue->OwnershipTransfers.push_back(ownershipTransfer);
+            }
+        }
+
+        commandQueueToWait->OwnershipTransfers.clear();
+        return;
+    }
+
+    VulkanCommandList releaseCommandList = {};
+    releaseCommandList.CommandQueue = commandQueueToWait;
+    BeginCommandBuffer(&releaseCommandList);
+
+    if (acquireCommandList->CommandBufferObject == nullptr)
+    {
+        BeginCommandBuffer(acquireCommandList);
+    }
+
+    for (auto& ownershipTransfer : commandQueueToWait->OwnershipTransfers)
+    {
+        GetOwnershipTransferQueue(ownershipTransfer) = nullptr;
+
+        // The release waits for the last accesses of the writing queue and the acquire is waited by all the
+        // commands of the destination queue. The layout doesn't change during the transfer.
+        auto sourceStage = (ownershipTransfer.Stage != VK_PIPELINE_STAGE_2_NONE_KHR) ? ownershipTransfer.Stage : VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+
+        VulkanResourceState sourceState = { sourceStage, ownershipTransfer.Access, ownershipTransfer.Layout, commandQueueToWait };
+        VulkanResourceState transferState = { VK_PIPELINE_STAGE_2_NONE_KHR, VK_ACCESS_2_NONE_KHR, ownershipTransfer.Layout, commandQueue };
+        VulkanResourceState destinationState = { VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR, VK_ACCESS_2_MEMORY_READ_BIT_KHR | VK_ACCESS_2_MEMORY_WRITE_BIT_KHR, ownershipTransfer.Layout, commandQueue };
+
+        if (ownershipTransfer.GraphicsBuffer != nullptr)
+        {
+            VulkanGraphicsBuffer* graphicsBuffer = ownershipTransfer.GraphicsBuffer;
+
+            auto releaseBarrier = CreateBufferTransitionBarrier(graphicsBuffer->BufferObject, graphicsBuffer->SizeInBytes, sourceState, transferState);
+            releaseBarrier.srcQueueFamilyIndex = commandQueueToWait->CommandQueueFamilyIndex;
+            releaseBarrier.dstQueueFamilyIndex = commandQueue->CommandQueueFamilyIndex;
+            releaseCommandList.BufferBarriers.push_back(releaseBarrier);
+
+            auto acquireBarrier = CreateBufferTransitionBarrier(graphicsBuffer->BufferObject, graphicsBuffer->SizeInBytes, transferState, destinationState);
+            acquireBarrier.srcQueueFamilyIndex = commandQueueToWait->CommandQueueFamilyIndex;
+            acquireBarrier.dstQueueFamilyIndex = commandQueue->CommandQueueFamilyIndex;
+            acquireCommandList->BufferBarriers.push_back(acquireBarrier);
+        }
+
+        else
+        {
+            VulkanTexture* texture = ownershipTransfer.Texture;
+            bool isDepthBuffer = texture->Format == VK_FORMAT_D32_SFLOAT;
+
+            auto releaseBarrier = CreateImageTransitionBarrier(texture->TextureObject, sourceState, transferState, isDepthBuffer);
+            releaseBarrier.srcQueueFamilyIndex = commandQueueToWait->CommandQueueFamilyIndex;
+            releaseBarrier.dstQueueFamilyIndex = commandQueue->CommandQueueFamilyIndex;
+            releaseCommandList.TextureBarriers.push_back(releaseBarrier);
+
+            auto acquireBarrier = CreateImageTransitionBarrier(texture->TextureObject, transferState, destinationState, isDepthBuffer);
+            acquireBarrier.srcQueueFamilyIndex = commandQueueToWait->CommandQueueFamilyIndex;
+            acquireBarrier.dstQueueFamilyIndex = commandQueue->CommandQueueFamilyIndex;
+            acquireCommandList->TextureBarriers.push_back(acquireBarrier);
+        }
+    }
+
+    commandQueueToWait->OwnershipTransfers.clear();
+    CommitCommandList(&releaseCommandList);
+
+    const uint64_t signalValue = commandQueueToWait->FenceValue + 1;
+    commandQueueToWait->FenceValue = signalValue;
+    releaseCommandList.CommandPool->FenceValue = signalValue;
+
+    VkCommandBufferSubmitInfoKHR commandBufferInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR };
+    commandBufferInfo.commandBuffer = releaseCommandList.CommandBufferObject;
+
+    VkSemaphoreSubmitInfoKHR signalSemaphoreInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR };
+    signalSemaphoreInfo.semaphore = commandQueueToWait->TimelineSemaphore;
+    signalSemaphoreInfo.value = signalValue;
+    signalSemaphoreInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR;
+
+    VkSubmitInfo2KHR submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR };
+    submitInfo.commandBufferInfoCount = 1;
+    submitInfo.pCommandBufferInfos = &commandBufferInfo;
+    submitInfo.signalSemaphoreInfoCount = 1;
+    submitInfo.pSignalSemaphoreInfos = &signalSemaphoreInfo;
+
+    AssertIfFailed(vkQueueSubmit2KHR(commandQueueToWait->CommandQueueObject, 1, &submitInfo, VK_NULL_HANDLE));
+    AddSubmitSemaphore(commandQueueToWait->TimelineSemaphore, signalValue);
+}
+
+VulkanPipelineState* VulkanGraphicsService::AcquirePipelineState(VulkanShader* shader, GraphicsRenderPassDescriptor* renderPassDescriptor, bool* isNew)
+{
+    VulkanPipelineStateKey key = VulkanCreatePipelineStateKey(shader, renderPassDescriptor);
+    lock_guard<mutex> lock(this->pipelineStateCacheLock);
+
+    auto iterator = this->pipelineStateCache.find(key);
+
+    if (iterator != this->pipelineStateCache.end())
+    {
+        iterator->second->ReferenceCount++;
+        *isNew = false;
+
+        return iterator->second;
+    }
+
+    VulkanPipelineState* pipelineState = new VulkanPipelineState();
+    pipelineState->Key = key;
+    pipelineState->ReferenceCount = 1;
+    pipelineState->ParameterCount = shader->ParameterCount;
+
+    // The layout and the render pass are cheap to create so they are available to BeginRenderPass
+    // and SetPipelineState while the pipeline is compiled on the worker threads
+    if (key.IsComputePipelineState || key.HasRenderPass)
+    {
+        VulkanCachedPipelineLayout* pipelineLayout = AcquirePipelineLayout(pipelineState->ParameterCount);
+
+        pipelineState->PipelineLayoutObject = pipelineLayout->PipelineLayoutObject;
+        pipelineState->DescriptorSetLayouts = pipelineLayout->DescriptorSetLayouts;
+        pipelineState->DescriptorSetLayoutCount = VulkanDescriptorSetLayoutCount;
+    }
+
+    if (key.HasRenderPass)
+    {
+        pipelineState->RenderPass = AcquireRenderPass(key.RenderPassKey);
+    }
+
+    this->pipelineStateCache[key] = pipelineState;
+    *isNew = true;
+
+    return pipelineState;
+}
+
+void VulkanGraphicsService::CompilePipelineState(VulkanPipelineState* pipelineState, VulkanShader* shader, GraphicsRenderPassDescriptor renderPassDescriptor)
+{
+    const VulkanPipelineStateKey& key = pipelineState->Key;
+
+    if (key.IsComputePipelineState)
+    {
+        pipelineState->PipelineStateObject = CreateComputePipeline(this->graphicsDevice, this->pipelineCache, pipelineState->PipelineLayoutObject, shader);
+    }
+
+    else if (key.HasRenderPass)
+    {
+        // Shaders only have mesh shader stages, the render pass is still created so that the
+        // render targets are cleared on devices without mesh shaders
+        if (this->isMeshShaderSupported)
+        {
+            pipelineState->PipelineStateObject = CreateGraphicsPipeline(this->graphicsDevice, this->pipelineCache, pipelineState->RenderPass, pipelineState->PipelineLayoutObject, renderPassDescriptor, shader);
+        }
+    }
+
+    pipelineState->IsReady = true;
+}
+
+// The caller holds the pipeline state cache lock
+VulkanCachedPipelineLayout* VulkanGraphicsService::AcquirePipelineLayout(uint32_t parameterCount)
+{
+    auto iterator = this->pipelineLayoutCache.find(parameterCount);
+
+    if (iterator != this->pipelineLayoutCache.end())
+    {
+        iterator->second.ReferenceCount++;
+        return &iterator->second;
+    }
+
+    // Elements of an unordered_map are never moved so the returned pointer stays valid until the entry is erased
+    VulkanCachedPipelineLayout& pipelineLayout = this->pipelineLayoutCache[parameterCount];
+    pipelineLayout.PipelineLayoutObject = CreateGraphicsPipelineLayout(this->graphicsDevice, parameterCount, pipelineLayout.DescriptorSetLayouts);
+    pipelineLayout.ReferenceCount = 1;
+
+    return &pipelineLayout;
+}
+
+// The caller holds the pipeline state cache lock
+VkRenderPass VulkanGraphicsService::AcquireRenderPass(const VulkanRenderPassKey& renderPassKey)
+{
+    auto iterator = this->renderPassCache.find(renderPassKey);
+
+    if (iterator != this->renderPassCache.end())
+    {
+        iterator->second.ReferenceCount++;
+        return iterator->second.RenderPass;
+    }
+
+    VulkanCachedRenderPass& renderPass = this->renderPassCache[renderPassKey];
+    renderPass.RenderPass = CreateRenderPass(this->graphicsDevice, renderPassKey);
+    renderPass.ReferenceCount = 1;
+
+    return renderPass.RenderPass;
+}
+
+VkRenderPass VulkanGraphicsService::FindRenderPass(const VulkanRenderPassKey& renderPassKey)
+{
+    lock_guard<mutex> lock(this->pipelineStateCacheLock);
+    auto iterator = this->renderPassCache.find(renderPassKey);
+
+    if (iterator == this->renderPassCache.end())
+    {
+        return nullptr;
+    }
+
+    return iterator->second.RenderPass;
+}
+
+void VulkanGraphicsService::DestroyPipelineState(VulkanPipelineState* pipelineState)
+{
+    lock_guard<mutex> lock(this->pipelineStateCacheLock);
+
+    if (pipelineState->RenderPass != nullptr)
+    {
+        auto iterator = this->renderPassCache.find(pipelineState->Key.RenderPassKey);
+        assert(iterator != this->renderPassCache.end());
+
+        if (--iterator->second.ReferenceCount == 0)
+        {
+            RemoveCachedFrameBuffers(pipelineState->RenderPass, nullptr);
+            DeferDelete(VK_OBJECT_TYPE_RENDER_PASS, (uint64_t)pipelineState->RenderPass);
+            this->renderPassCache.erase(iterator);
+        }
+    }
+
+    if (pipelineState->PipelineLayoutObject != nullptr)
+    {
+        auto iterator = this->pipelineLayoutCache.find(pipelineState->ParameterCount);
+        assert(iterator != this->pipelineLayoutCache.end());
+
+        if (--iterator->second.ReferenceCount == 0)
+        {
+            DeferDelete(VK_OBJECT_TYPE_PIPELINE_LAYOUT, (uint64_t)pipelineState->PipelineLayoutObject);
+            this->pipelineLayoutCache.erase(iterator);
+        }
+    }
+
+    if (pipelineState->PipelineStateObject != nullptr)
+    {
+        DeferDelete(VK_OBJECT_TYPE_PIPELINE, (uint64_t)pipelineState->PipelineStateObject);
+    }
+
+    delete pipelineState;
+}
+
+void VulkanGraphicsService::SetShaderModule(VulkanShader* shader, ShaderStage shaderStage, const void* code, uint64_t codeSize, uint64_t codeHash)
+{
+    VkShaderModule shaderModule = nullptr;
+    uint64_t shaderModuleKey = codeHash;
+
+    {
+        lock_guard<mutex> lock(this->shaderModuleCacheLock);
+        auto cacheEntry = this->shaderModuleCache.find(shaderModuleKey);
+
+        // The hash can collide so the code is compared before the module is shared
+        while (cacheEntry != this->shaderModuleCache.end() && (cacheEntry->second.Code.size() != codeSize || memcmp(cacheEntry->second.Code.data(), code, codeSize) != 0))
+        {
+            cacheEntry = this->shaderModuleCache.find(++shaderModuleKey);
+        }
+
+        if (cacheEntry == this->shaderModuleCache.end())
+        {
+            VulkanCachedShaderModule cachedShaderModule = {};
+            cachedShaderModule.ShaderModuleObject = CreateShaderModule(this->graphicsDevice, (void*)code, (int)codeSize);
+            cachedShaderModule.Code.assign((const uint8_t*)code, (const uint8_t*)code + codeSize);
+
+            cacheEntry = this->shaderModuleCache.emplace(shaderModuleKey, move(cachedShaderModule)).first;
+        }
+
+        cacheEntry->second.ReferenceCount++;
+        shaderModule = cacheEntry->second.ShaderModuleObject;
+    }
+
+    VkShaderModule* shaderModules[] { &shader->AmplificationShaderMethod, &shader->MeshShaderMethod, &shader->PixelShaderMethod, &shader->ComputeShaderMethod };
+
+    if (*shaderModules[shaderStage] != nullptr)
+    {
+        ReleaseShaderModule(shader->ShaderModuleHashes[shaderStage]);
+    }
+
+    // The key identifies the code in the pipeline state keys even when the hash collides
+    *shaderModules[shaderStage] = shaderModule;
+    shader->ShaderModuleHashes[shaderStage] = shaderModuleKey;
+}
+
+void VulkanGraphicsService::ReleaseShaderModule(uint64_t shaderModuleKey)
+{
+    lock_guard<mutex> lock(this->shaderModuleCacheLock);
+    auto cacheEntry = this->shaderModuleCache.find(shaderModuleKey);
+    assert(cacheEntry != this->shaderModuleCache.end());
+
+    if (--cacheEntry->second.ReferenceCount == 0)
+    {
+        DeferDelete(VK_OBJECT_TYPE_SHADER_MODULE, (uint64_t)cacheEntry->second.ShaderModuleObject);
+        this->shaderModuleCache.erase(cacheEntry);
+    }
+}
+
+void VulkanGraphicsService::AllocateShaderResourceHeapSets(VulkanShaderResourceHeap* shaderResourceHeap, uint32_t length)
+{
+    if (this->isDescriptorBufferSupported)
+    {
+        // The four resource sets are stored one after the other in the resource descriptor buffer
+        size_t descriptorSizes[]
+        {
+            this->descriptorBufferProperties.storageBufferDescriptorSize,
+            this->descriptorBufferProperties.sampledImageDescriptorSize,
+            this->descriptorBufferProperties.storageBufferDescriptorSize,
+            this->descriptorBufferProperties.storageImageDescriptorSize
+        };
+
+        VkDeviceSize resourceDescriptorBufferSize = 0;
+
+        for (uint32_t i = 0; i < ARRAYSIZE(descriptorSizes); i++)
+        {
+            shaderResourceHeap->DescriptorSetOffsets[i] = resourceDescriptorBufferSize;
+            auto alignment = this->descriptorBufferProperties.descriptorBufferOffsetAlignment;
+            resourceDescriptorBufferSize = (resourceDescriptorBufferSize + this->descriptorBufferBindingOffsets[i] + length * descriptorSizes[i] + alignment - 1) & ~(alignment - 1);
+        }
+
+        VkDeviceSize samplerDescriptorBufferSize = 0;
+        vkGetDescriptorSetLayoutSizeEXT(this->graphicsDevice, GetGlobalSamplerLayout(this->graphicsDevice), &samplerDescriptorBufferSize);
+        shaderResourceHeap->DescriptorSetOffsets[4] = 0;
+
+        void* samplerCpuPointer = nullptr;
+        CreateDescriptorBuffer(resourceDescriptorBufferSize, VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT, &shaderResourceHeap->ResourceDescriptorBuffer, &shaderResourceHeap->ResourceDescriptorMemory, &shaderResourceHeap->ResourceDescriptorAddress, (void**)&shaderResourceHeap->ResourceDescriptorCpuPointer);
+        CreateDescriptorBuffer(samplerDescriptorBufferSize, VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT, &shaderResourceHeap->SamplerDescriptorBuffer, &shaderResourceHeap->SamplerDescriptorMemory, &shaderResourceHeap->SamplerDescriptorAddress, &samplerCpuPointer);
+
+        VkDescriptorGetInfoEXT samplerGetInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT };
+        samplerGetInfo.type = VK_DESCRIPTOR_TYPE_SAMPLER;
+        samplerGetInfo.data.pSampler = &shaderResourceHeap->Sampler;
+
+        vkGetDescriptorEXT(this->graphicsDevice, &samplerGetInfo, this->descriptorBufferProperties.samplerDescriptorSize, (uint8_t*)samplerCpuPointer + this->descriptorBufferBindingOffsets[4]);
+        vkUnmapMemory(this->graphicsDevice, shaderResourceHeap->SamplerDescriptorMemory);
+
+        shaderResourceHeap->Length = length;
+        shaderResourceHeap->Descriptors.resize(length);
+        return;
+    }
+
+    VkDescriptorPoolSize poolSizes[]
+    {
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2 * length},
+        {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, length},
+        {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, length},
+        {VK_DESCRIPTOR_TYPE_SAMPLER, 1 }
+    };
+
+    VkDescriptorPoolCreateInfo createInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+    createInfo.poolSizeCount = ARRAYSIZE(poolSizes);
+    createInfo.pPoolSizes = poolSizes;
+    createInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    createInfo.maxSets = VulkanDescriptorSetLayoutCount;
+
+    AssertIfFailed(vkCreateDescriptorPool(this->graphicsDevice, &createInfo, nullptr, &shaderResourceHeap->DescriptorPool));
+
+    VkDescriptorSetLayout setLayouts[] {
+        GetGlobalBufferLayout(this->graphicsDevice),
+        GetGlobalTextureLayout(this->graphicsDevice),
+        GetGlobalUavBufferLayout(this->graphicsDevice),
+        GetGlobalUavTextureLayout(this->graphicsDevice),
+        GetGlobalSamplerLayout(this->graphicsDevice)
+    };
+
+    uint32_t counts[] { length, length, length, length, 1 };
+
+    VkDescriptorSetVariableDescriptorCountAllocateInfo set_counts = {};
+    set_counts.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
+    set_counts.descriptorSetCount = ARRAYSIZE(counts);
+    set_counts.pDescriptorCounts = counts;
+    
+    VkDescriptorSetAllocateInfo allocateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+    allocateInfo.pSetLayouts = setLayouts;
+    allocateInfo.descriptorSetCount = ARRAYSIZE(setLayouts);
+    allocateInfo.descriptorPool = shaderResourceHeap->DescriptorPool;
+    allocateInfo.pNext = &set_counts;
+
+    AssertIfFailed(vkAllocateDescriptorSets(this->graphicsDevice, &allocateInfo, shaderResourceHeap->DescriptorSets));
+
+    VkDescriptorImageInfo samplerInfo = {};
+    samplerInfo.sampler = shaderResourceHeap->Sampler;
+
+    VkWriteDescriptorSet descriptor = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+    descriptor.dstSet = shaderResourceHeap->DescriptorSets[4];
+    descriptor.dstBinding = 0;
+    descriptor.dstArrayElement = 0;
+    descriptor.descriptorCount = 1;
+    descriptor.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    descriptor.pImageInfo = &samplerInfo;
+
+    vkUpdateDescriptorSets(this->graphicsDevice, 1, &descriptor, 0, nullptr);
+
+    shaderResourceHeap->Length = length;
+    shaderResourceHeap->Descriptors.resize(length);
+}
+
+uint32_t VulkanGraphicsService::GetMemoryTypeIndex(GraphicsServiceHeapType heapType)
+{
+    if (heapType == GraphicsServiceHeapType::Upload)
+    {
+        return this->uploadMemoryTypeIndex;
+    }
+
+    else if (heapType == GraphicsServiceHeapType::ReadBack)
+    {
+        return this->readBackMemoryTypeIndex;
+    }
+
+    else if (heapType == GraphicsServiceHeapType::GpuUpload)
+    {
+        return this->gpuUploadMemoryTypeIndex;
+    }
+
+    return this->gpuMemoryTypeIndex;
+}
+
+VkMappedMemoryRange VulkanGraphicsService::GetMappedMemoryRange(VulkanGraphicsBuffer* graphicsBuffer)
+{
+    // Flushed and invalidated ranges must be aligned on the non coherent atom size
+    auto startOffset = graphicsBuffer->HeapOffset & ~(this->nonCoherentAtomSize - 1);
+    auto endOffset = (graphicsBuffer->HeapOffset + graphicsBuffer->SizeInBytes + this->nonCoherentAtomSize - 1) & ~(this->nonCoherentAtomSize - 1);
+
+    VkMappedMemoryRange memoryRange = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+    memoryRange.memory = graphicsBuffer->GraphicsHeap->DeviceMemory;
+    memoryRange.offset = startOffset;
+    memoryRange.size = endOffset < graphicsBuffer->GraphicsHeap->SizeInBytes ? endOffset - startOffset : VK_WHOLE_SIZE;
+
+    return memoryRange;
+}
+
+GraphicsTimestampCalibration VulkanGraphicsService::EstimateTimestampCalibration(VulkanCommandQueue* commandQueue)
+{
+    GraphicsTimestampCalibration result = {};
+
+    if (commandQueue->IsCopyCommandQueue && !this->isCopyQueueTimestampSupported)
+    {
+        return result;
+    }
+
+    // A timestamp is written on the queue and the host clock is read around the submit and the wait,
+    // the GPU timestamp is matched to the middle of that interval. The CPU waits for the queue so the
+    // calibration should only be requested when a capture starts.
+    VulkanCommandList commandList = {};
+    commandList.CommandQueue = commandQueue;
+
+    BeginCommandBuffer(&commandList);
+    vkCmdResetQueryPool(commandList.CommandBufferObject, this->calibrationQueryPool, 0, 1);
+    vkCmdWriteTimestamp(commandList.CommandBufferObject, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, this->calibrationQueryPool, 0);
+    CommitCommandList(&commandList);
+
+    void* commandLists[] = { &commandList };
+
+    auto startTimestamp = GetHostTimestamp();
+
+    GraphicsFence fence = {};
+    fence.CommandQueuePointer = commandQueue;
+    fence.Value = ExecuteCommandLists(commandQueue, commandLists, 1, nullptr, 0);
+
+    WaitForCommandQueueOnCpu(fence);
+    auto endTimestamp = GetHostTimestamp();
+
+    AssertIfFailed(vkGetQueryPoolResults(this->graphicsDevice, this->calibrationQueryPool, 0, 1, sizeof(uint64_t), &result.GpuTimestamp, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+
+    result.CpuTimestamp = startTimestamp + (endTimestamp - startTimestamp) / 2;
+    result.MaxDeviation = (endTimestamp - startTimestamp) / 2 * 1000000000 / GetHostTimestampFrequency();
+
+    return result;
+}
+
+void VulkanGraphicsService::ReleaseShaderResourceHeapSets(VulkanShaderResourceHeap* shaderResourceHeap)
+{
+    if (this->isDescriptorBufferSupported)
+    {
+        DeferDelete(VK_OBJECT_TYPE_BUFFER, (uint64_t)shaderResourceHeap->ResourceDescriptorBuffer);
+        DeferDelete(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)shaderResourceHeap->ResourceDescriptorMemory);
+        DeferDelete(VK_OBJECT_TYPE_BUFFER, (uint64_t)shaderResourceHeap->SamplerDescriptorBuffer);
+        DeferDelete(VK_OBJECT_TYPE_DEVICE_MEMORY, (uint64_t)shaderResourceHeap->SamplerDescriptorMemory);
+        return;
+    }
+
+    DeferDelete(VK_OBJECT_TYPE_DESCRIPTOR_POOL, (uint64_t)shaderResourceHeap->DescriptorPool);
+}
+
+void VulkanGraphicsService::CreateDescriptorBuffer(VkDeviceSize sizeInBytes, VkBufferUsageFlags usage, VkBuffer* buffer, VkDeviceMemory* deviceMemory, VkDeviceAddress* deviceAddress, void** cpuPointer)
+{
+    VkBufferCreateInfo createInfo = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    createInfo.size = sizeInBytes;
+    createInfo.usage = usage | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    AssertIfFailed(vkCreateBuffer(this->graphicsDevice, &createInfo, nullptr, buffer));
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetBufferMemoryRequirements(this->graphicsDevice, *buffer, &memoryRequirements);
+
+    VkMemoryAllocateFlagsInfo allocateFlagsInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO };
+    allocateFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
+    VkMemoryAllocateInfo allocateInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+    allocateInfo.allocationSize = memoryRequirements.size;
+    allocateInfo.memoryTypeIndex = this->uploadMemoryTypeIndex;
+    allocateInfo.pNext = &allocateFlagsInfo;
+
+    AssertIfFailed(vkAllocateMemory(this->graphicsDevice, &allocateInfo, nullptr, deviceMemory));
+    AssertIfFailed(vkBindBufferMemory(this->graphicsDevice, *buffer, *deviceMemory, 0));
+
+    // The memory stays mapped so that descriptors can be written at any time
+    AssertIfFailed(vkMapMemory(this->graphicsDevice, *deviceMemory, 0, sizeInBytes, 0, cpuPointer));
+
+    VkBufferDeviceAddressInfo addressInfo = { VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
+    addressInfo.buffer = *buffer;
+
+    *deviceAddress = vkGetBufferDeviceAddress(this->graphicsDevice, &addressInfo);
+}
+
+void VulkanGraphicsService::WriteShaderResourceDescriptors(VulkanShaderResourceHeap* shaderResourceHeap, const uint32_t* indexes, uint32_t indexCount)
+{
+    if (this->isDescriptorBufferSupported)
+    {
+        // Descriptors are copied straight into the mapped descriptor buffer, no batching is needed
+        for (uint32_t i = 0; i < indexCount; i++)
+        {
+            auto index = indexes[i];
+            auto& descriptor = shaderResourceHeap->Descriptors[index];
+            uint32_t setIndex = (descriptor.IsTexture ? 1 : 0) + (descriptor.IsWriteable ? 2 : 0);
+
+            VkDescriptorImageInfo imageInfo = {};
+            VkDescriptorAddressInfoEXT addressInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT };
+            VkDescriptorGetInfoEXT getInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT };
+            size_t descriptorSize = 0;
+
+            if (descriptor.IsTexture)
+            {
+                imageInfo = GetShaderResourceImageInfo(descriptor);
+
+                getInfo.type = descriptor.IsWriteable ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+                getInfo.data.pSampledImage = &imageInfo;
+                descriptorSize = descriptor.IsWriteable ? this->descriptorBufferProperties.storageImageDescriptorSize : this->descriptorBufferProperties.sampledImageDescriptorSize;
+            }
+
+            else
+            {
+                VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)descriptor.ResourcePointer;
+
+                addressInfo.address = graphicsBuffer->DeviceAddress;
+                addressInfo.range = graphicsBuffer->SizeInBytes;
+                addressInfo.format = VK_FORMAT_UNDEFINED;
+
+                getInfo.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                getInfo.data.pStorageBuffer = &addressInfo;
+                descriptorSize = this->descriptorBufferProperties.storageBufferDescriptorSize;
+            }
+
+            auto destination = shaderResourceHeap->ResourceDescriptorCpuPointer + shaderResourceHeap->DescriptorSetOffsets[setIndex] + this->descriptorBufferBindingOffsets[setIndex] + index * descriptorSize;
+            vkGetDescriptorEXT(this->graphicsDevice, &getInfo, descriptorSize, destination);
+        }
+
+        return;
+    }
+
+    // Writes are sorted by set and index so that contiguous slots of a set are merged into one write
+    // The order of the sets is buffers, textures, writeable buffers and writeable textures
+    vector<uint64_t> sortKeys(indexCount);
+
+    for (uint32_t i = 0; i < indexCount; i++)
+    {
+        auto& descriptor = shaderResourceHeap->Descriptors[indexes[i]];
+        uint64_t setIndex = (descriptor.IsTexture ? 1 : 0) + (descriptor.IsWriteable ? 2 : 0);
+
+        sortKeys[i] = (setIndex << 32) | indexes[i];
+    }
+
+    sort(sortKeys.begin(), sortKeys.end());
+
+    // The info arrays are never reallocated so that the writes can point into them
+    vector<VkDescriptorImageInfo> imageInfos;
+    vector<VkDescriptorBufferInfo> bufferInfos;
+    vector<VkWriteDescriptorSet> writeDescriptors;
+
+    imageInfos.reserve(indexCount);
+    bufferInfos.reserve(indexCount);
+
+    for (uint32_t i = 0; i < indexCount; i++)
+    {
+        auto setIndex = (uint32_t)(sortKeys[i] >> 32);
+        auto index = (uint32_t)sortKeys[i];
+        auto& descriptor = shaderResourceHeap->Descriptors[index];
+
+        if (writeDescriptors.size() > 0)
+        {
+            auto& previousWriteDescriptor = writeDescriptors.back();
+
+            // The same slot can be written several times in a batch, the last write wins
+            if (previousWriteDescriptor.dstSet == shaderResourceHeap->DescriptorSets[setIndex] && previousWriteDescriptor.dstArrayElement + previousWriteDescriptor.descriptorCount - 1 == index)
+            {
+                continue;
+            }
+        }
+
+        if (descriptor.IsTexture)
+        {
+            imageInfos.push_back(GetShaderResourceImageInfo(descriptor));
+        }
+
+        else
+        {
+            VulkanGraphicsBuffer* graphicsBuffer = (VulkanGraphicsBuffer*)descriptor.ResourcePointer;
+
+            VkDescriptorBufferInfo bufferInfo = {};
+            bufferInfo.buffer = graphicsBuffer->BufferObject;
+            bufferInfo.range = graphicsBuffer->SizeInBytes;
+
+            bufferInfos.push_back(bufferInfo);
+        }
+
+        if (writeDescriptors.size() > 0)
+        {
+            auto& previousWriteDescriptor = writeDescriptors.back();
+
+            if (previousWriteDescriptor.dstSet == shaderResourceHeap->DescriptorSets[setIndex] && previousWriteDescriptor.dstArrayElement + previousWriteDescriptor.descriptorCount == index)
+            {
+                previousWriteDescriptor.descriptorCount++;
+                continue;
+            }
+        }
+
+        VkWriteDescriptorSet writeDescriptor = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        writeDescriptor.dstSet = shaderResourceHeap->DescriptorSets[setIndex];
+        writeDescriptor.dstBinding = 0;
+        writeDescriptor.dstArrayElement = index;
+        writeDescriptor.descriptorCount = 1;
+
+        if (descriptor.IsTexture)
+        {
+            writeDescriptor.descriptorType = descriptor.IsWriteable ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            writeDescriptor.pImageInfo = &imageInfos.back();
+        }
+
+        else
+        {
+            writeDescriptor.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writeDescriptor.pBufferInfo = &bufferInfos.back();
+        }
+
+        writeDescriptors.push_back(writeDescriptor);
+    }
+
+    if (writeDescriptors.size() > 0)
+    {
+        vkUpdateDescriptorSets(this->graphicsDevice, (uint32_t)writeDescriptors.size(), writeDescriptors.data(), 0, nullptr);
+    }
+}
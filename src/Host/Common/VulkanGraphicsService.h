@@ -0,0 +1,681 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
+#include "CoreEngine.h"
+#include "WorkerThreadPool.h"
+#include "ShaderArchive.h"
+#include "GpuZoneProfiler.h"
+
+#ifdef _WIN32
+#define VK_USE_PLATFORM_WIN32_KHR
+#else
+#include <limits.h>
+#include <unistd.h>
+#endif
+
+#define VOLK_VULKAN_H_PATH "../vulkan/vulkan.h"
+#define VOLK_IMPLEMENTATION 
+#include "Libs/Volk/volk.h"
+#include "VulkanDescriptorBuffer.h"
+
+#ifndef AssertIfFailed
+#define AssertIfFailed(result) assert((result) >= 0)
+#endif
+
+#ifndef ARRAYSIZE
+#define ARRAYSIZE(array) (sizeof(array) / sizeof(array[0]))
+#endif
+
+using namespace std;
+
+static const int VulkanMaxFramesInFlightCount = 4;
+static const int VulkanMaxSwapChainImageCount = 8;
+static const int VulkanMaxThreadCount = 32;
+static const int VulkanMaxCommandQueueCount = 16;
+static const int VulkanMaxPipelineCompilerThreadCount = 4;
+static const int VulkanDescriptorSetLayoutCount = 5;
+static const uint32_t VulkanMaxShaderResourceHeapLength = 1000000;
+static const char* VulkanPipelineCacheFileName = "VulkanPipelineCache.bin";
+static const uint32_t VulkanPipelineCacheFileMagic = 0x48435056; // VPCH
+
+// The core statistics bits follow the D3D12_QUERY_DATA_PIPELINE_STATISTICS1 layout, the stride keeps the
+// 3 mesh shader counters of D3D12 so the engine reads both backends the same way
+static const VkQueryPipelineStatisticFlags VulkanPipelineStatisticsFlags = (VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT << 1) - 1;
+static const VkDeviceSize VulkanPipelineStatisticsStride = 14 * sizeof(uint64_t);
+
+// Host clock domain matching GetHostTimestamp
+#ifdef _WIN32
+static const VkTimeDomainEXT VulkanHostTimeDomain = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT;
+#else
+static const VkTimeDomainEXT VulkanHostTimeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+#endif
+
+struct VulkanCommandPool
+{
+    VkCommandPool CommandPoolObject;
+    vector<VkCommandBuffer> CommandBuffers;
+    uint32_t UsedCommandBufferCount;
+    uint64_t FenceValue;
+};
+
+struct VulkanGraphicsBuffer;
+struct VulkanTexture;
+
+// Resources use the exclusive sharing mode so a resource written by a queue is released to the family of the
+// next queue that waits on it. The state is the one left by the writing queue, the barriers must match it.
+struct VulkanOwnershipTransfer
+{
+    VulkanGraphicsBuffer* GraphicsBuffer;
+    VulkanTexture* Texture;
+    VkPipelineStageFlags2KHR Stage;
+    VkAccessFlags2KHR Access;
+    VkImageLayout Layout;
+};
+
+struct VulkanCommandQueue
+{
+    VkQueue CommandQueueObject;
+
+    // Command pools are created on demand by each recording thread for each frame in flight,
+    // a thread only touches its own slots so recording doesn't need any lock
+    VulkanCommandPool* CommandPools[VulkanMaxFramesInFlightCount][VulkanMaxThreadCount];
+    string Label;
+    VkSemaphore TimelineSemaphore;
+    uint64_t FenceValue;
+
+    // Binary semaphore signaled by the last swap chain image acquire, the next submit
+    // on the queue waits for it before touching the back buffer
+    VkSemaphore AcquireSemaphoreToWait;
+    uint32_t QueueIndex;
+    uint32_t CommandQueueFamilyIndex;
+    bool IsCopyCommandQueue;
+    bool IsComputeCommandQueue;
+
+    // Stages that can run shaders on the queue family, none for copy queues
+    VkPipelineStageFlags2KHR ShaderStages;
+
+    // Resources written by the submitted command lists that are still owned by the queue family
+    vector<VulkanOwnershipTransfer> OwnershipTransfers;
+};
+
+// A released object is destroyed once every command queue has reached the fence value
+// it had when the object was released
+struct VulkanDeferredDelete
+{
+    VkObjectType ObjectType;
+    uint64_t ObjectHandle;
+    uint64_t FenceValues[VulkanMaxCommandQueueCount];
+};
+
+struct VulkanFrameBufferKey
+{
+    VkRenderPass RenderPass;
+    VkImageView ImageViews[2];
+    uint32_t ImageViewCount;
+    uint32_t Width;
+    uint32_t Height;
+
+    bool operator==(const VulkanFrameBufferKey& other) const
+    {
+        return RenderPass == other.RenderPass && ImageViews[0] == other.ImageViews[0] && ImageViews[1] == other.ImageViews[1] && 
+               ImageViewCount == other.ImageViewCount && Width == other.Width && Height == other.Height;
+    }
+};
+
+struct VulkanFrameBufferKeyHash
+{
+    size_t operator()(const VulkanFrameBufferKey& key) const
+    {
+        size_t result = hash<void*>()((void*)key.RenderPass);
+        result = result * 31 + hash<void*>()((void*)key.ImageViews[0]);
+        result = result * 31 + hash<void*>()((void*)key.ImageViews[1]);
+        result = result * 31 + ((size_t)key.Width << 16) + key.Height;
+
+        return result;
+    }
+};
+
+// Render passes are shared by all the pipeline states that have the same attachments
+struct VulkanRenderPassKey
+{
+    VkFormat RenderTargetFormat;
+    VkFormat DepthFormat;
+    bool IsRenderTargetCleared;
+    bool IsDepthCleared;
+
+    bool operator==(const VulkanRenderPassKey& other) const
+    {
+        return RenderTargetFormat == other.RenderTargetFormat && DepthFormat == other.DepthFormat && 
+               IsRenderTargetCleared == other.IsRenderTargetCleared && IsDepthCleared == other.IsDepthCleared;
+    }
+};
+
+struct VulkanRenderPassKeyHash
+{
+    size_t operator()(const VulkanRenderPassKey& key) const
+    {
+        size_t result = hash<uint32_t>()(key.RenderTargetFormat);
+        result = result * 31 + hash<uint32_t>()(key.DepthFormat);
+        result = result * 31 + (key.IsRenderTargetCleared ? 1 : 0) + (key.IsDepthCleared ? 2 : 0);
+
+        return result;
+    }
+};
+
+// Shaders are identified by the content hashes of their modules so that shaders created from the same
+// code share their pipeline states. Only the render pass descriptor fields used to build a pipeline are
+// part of the key so that render passes that only differ by their textures share the same pipeline state.
+struct VulkanPipelineStateKey
+{
+    uint64_t ShaderModuleHashes[ShaderStageCount];
+    uint32_t ParameterCount;
+    bool IsComputePipelineState;
+    bool HasRenderPass;
+    VulkanRenderPassKey RenderPassKey;
+    GraphicsBlendOperation BlendOperation;
+    GraphicsDepthBufferOperation DepthBufferOperation;
+    GraphicsPrimitiveType PrimitiveType;
+
+    bool operator==(const VulkanPipelineStateKey& other) const
+    {
+        return memcmp(ShaderModuleHashes, other.ShaderModuleHashes, sizeof(ShaderModuleHashes)) == 0 && ParameterCount == other.ParameterCount && IsComputePipelineState == other.IsComputePipelineState && HasRenderPass == other.HasRenderPass && 
+               RenderPassKey == other.RenderPassKey && BlendOperation == other.BlendOperation && 
+               DepthBufferOperation == other.DepthBufferOperation && PrimitiveType == other.PrimitiveType;
+    }
+};
+
+struct VulkanPipelineStateKeyHash
+{
+    size_t operator()(const VulkanPipelineStateKey& key) const
+    {
+        size_t result = key.ParameterCount;
+
+        for (uint32_t i = 0; i < ShaderStageCount; i++)
+        {
+            result = result * 31 + hash<uint64_t>()(key.ShaderModuleHashes[i]);
+        }
+
+        result = result * 31 + VulkanRenderPassKeyHash()(key.RenderPassKey);
+        result = result * 31 + ((size_t)key.BlendOperation << 8) + ((size_t)key.DepthBufferOperation << 4) + key.PrimitiveType;
+        result = result * 31 + (key.IsComputePipelineState ? 1 : 0) + (key.HasRenderPass ? 2 : 0);
+
+        return result;
+    }
+};
+
+struct VulkanCachedRenderPass
+{
+    VkRenderPass RenderPass;
+    uint32_t ReferenceCount;
+};
+
+// Pipeline layouts are all built from the global set layouts and only differ by their push constants size
+struct VulkanCachedPipelineLayout
+{
+    VkPipelineLayout PipelineLayoutObject;
+    VkDescriptorSetLayout DescriptorSetLayouts[VulkanDescriptorSetLayoutCount];
+    uint32_t ReferenceCount;
+};
+
+// Shader modules are shared by all the shaders that contain the same SPIR-V code. The code is kept to
+// compare it on lookup, a different code with the same hash is stored with the next free key.
+struct VulkanCachedShaderModule
+{
+    VkShaderModule ShaderModuleObject;
+    vector<uint8_t> Code;
+    uint32_t ReferenceCount;
+};
+
+struct VulkanPipelineState;
+struct VulkanShaderResourceHeap;
+struct VulkanShader;
+
+// Accesses of a resource since its last barrier. The state only orders commands of the queue that
+// recorded it, accesses from other queues are already synchronized by the fences between them.
+struct VulkanResourceState
+{
+    VkPipelineStageFlags2KHR Stage;
+    VkAccessFlags2KHR Access;
+    VkImageLayout Layout;
+    VulkanCommandQueue* CommandQueue;
+};
+
+// State of a resource inside one command list. Command lists can be recorded in parallel and submitted in
+// any order so the state before the first use is only known at submit, the barrier to the first state is
+// recorded then and the state of the resource is updated with the last state.
+struct VulkanCommandListResourceState
+{
+    VulkanGraphicsBuffer* GraphicsBuffer;
+    VulkanTexture* Texture;
+    VulkanResourceState FirstState;
+    VulkanResourceState LastState;
+
+    // Set once the command list records its own barrier, the reads that follow don't change the first state
+    bool HasBarrier;
+
+    // Written resources are released to the family of the next queue that waits on the command queue
+    bool IsWritten;
+};
+
+struct VulkanCommandList
+{
+    VkCommandBuffer CommandBufferObject;
+    VulkanCommandQueue* CommandQueue;
+    VulkanCommandPool* CommandPool;
+    GraphicsRenderPassDescriptor RenderPassDescriptor;
+    bool IsRenderPassActive;
+    VkFramebuffer RenderPassFrameBuffer;
+    VulkanPipelineState* CurrentPipelineState;
+    VulkanShaderResourceHeap* CurrentResourceHeap;
+    VulkanShader* CurrentShader;
+
+    // Descriptor buffers bound to the command buffer when VK_EXT_descriptor_buffer is used
+    VkDeviceAddress BoundDescriptorBufferAddress;
+    VkDeviceSize BoundDescriptorSetOffsets[VulkanDescriptorSetLayoutCount];
+
+    GpuZoneStack GpuZones;
+
+    // Transitions are accumulated and flushed in one barrier before the next command that uses them
+    vector<VkBufferMemoryBarrier2KHR> BufferBarriers;
+    vector<VkImageMemoryBarrier2KHR> TextureBarriers;
+
+    // Resources transitioned by the command list, indexed by resource pointer
+    vector<VulkanCommandListResourceState> ResourceStates;
+    unordered_map<void*, uint32_t> ResourceStateIndices;
+};
+
+struct VulkanGraphicsHeap
+{
+    VkDeviceMemory DeviceMemory;
+    GraphicsServiceHeapType Type;
+    VkDeviceSize SizeInBytes;
+
+    // CPU accessible heaps are mapped once for their whole lifetime
+    uint8_t* CpuPointer;
+    bool IsCoherent;
+};
+
+struct VulkanShaderResourceDescriptor
+{
+    void* ResourcePointer;
+    bool IsTexture;
+    bool IsWriteable;
+    uint32_t MipLevel;
+};
+
+struct VulkanShaderResourceHeap
+{
+    VkDescriptorPool DescriptorPool;
+    VkDescriptorSet DescriptorSets[5];
+    VkSampler Sampler;
+    uint32_t Length;
+
+    // Used instead of the descriptor pool when VK_EXT_descriptor_buffer is supported. The resource sets
+    // are stored one after the other in the resource buffer and the sampler set in the sampler buffer
+    VkBuffer ResourceDescriptorBuffer;
+    VkDeviceMemory ResourceDescriptorMemory;
+    VkDeviceAddress ResourceDescriptorAddress;
+    uint8_t* ResourceDescriptorCpuPointer;
+    VkBuffer SamplerDescriptorBuffer;
+    VkDeviceMemory SamplerDescriptorMemory;
+    VkDeviceAddress SamplerDescriptorAddress;
+    VkDeviceSize DescriptorSetOffsets[VulkanDescriptorSetLayoutCount];
+
+    // Live descriptors indexed by slot, they are written again in the new sets when the heap grows
+    vector<VulkanShaderResourceDescriptor> Descriptors;
+};
+
+struct VulkanGraphicsBuffer
+{
+    VkBuffer BufferObject;
+    VkDeviceAddress DeviceAddress;
+    int SizeInBytes;
+    uint64_t HeapOffset;
+    VulkanGraphicsHeap* GraphicsHeap;
+
+    // State left by the last submitted command list, it is only accessed with the submit lock held
+    VulkanResourceState ResourceState;
+    VulkanCommandQueue* OwnershipTransferQueue;
+    VkBuffer IndirectCommandWorkingBuffer;
+    VkDeviceMemory IndirectCommandWorkingDeviceMemory;
+    uint32_t IndirectCommandWorkingBufferSize;
+
+    // Queries resolved on a copy queue are read on the CPU when the buffer is mapped
+    VkQueryPool PendingQueryPool;
+    uint32_t PendingQueryStartIndex;
+    uint32_t PendingQueryCount;
+};
+
+struct VulkanTexture
+{
+    VkImage TextureObject;
+    VkImageView ImageView;
+    vector<VkImageView> ImageViews;
+    VkFormat Format;
+    uint32_t Width;
+    uint32_t Height;
+    bool IsPresentTexture;
+
+    // State left by the last submitted command list, it is only accessed with the submit lock held
+    VulkanResourceState ResourceState;
+    VulkanCommandQueue* OwnershipTransferQueue;
+};
+
+struct VulkanQueryBuffer
+{
+    VkQueryPool QueryPool;
+    GraphicsQueryBufferType QueryBufferType;
+    uint32_t Length;
+};
+
+struct VulkanShader
+{
+    VkShaderModule AmplificationShaderMethod;
+    VkShaderModule MeshShaderMethod;
+    VkShaderModule PixelShaderMethod;
+    VkShaderModule ComputeShaderMethod;
+    uint64_t ShaderModuleHashes[ShaderStageCount];
+    uint32_t ParameterCount;
+    VkIndirectCommandsLayoutNV CommandSignature;
+
+    // Released by DeleteShader and by each pending asynchronous pipeline compilation
+    atomic<uint32_t> ReferenceCount;
+};
+
+// Pipeline states are shared by identical requests, each create call adds a reference that
+// is released by DeletePipelineState
+struct VulkanPipelineState
+{
+    VulkanPipelineStateKey Key;
+    uint32_t ReferenceCount;
+    uint32_t ParameterCount;
+    VkRenderPass RenderPass;
+    VkDescriptorSetLayout* DescriptorSetLayouts;
+    uint32_t DescriptorSetLayoutCount;
+    VkPipelineLayout PipelineLayoutObject;
+    VkPipeline PipelineStateObject;
+
+    // Set once the pipeline compiler thread has created the objects above
+    atomic<bool> IsReady;
+};
+
+struct VulkanSwapChain
+{
+    VkSurfaceKHR WindowSurface;
+    VkSwapchainKHR SwapChainObject;
+    VulkanCommandQueue* CommandQueue;
+    VkFormat Format;
+    uint32_t CurrentImageIndex;
+    uint32_t BackBufferCount;
+    uint32_t RequestedBackBufferCount;
+    VulkanTexture* BackBufferTextures[VulkanMaxSwapChainImageCount];
+    VkPresentModeKHR PresentMode;
+
+    // Acquire semaphores are indexed by frame in flight and present semaphores by image so
+    // that a semaphore is never reused before the GPU work that waits on it has completed
+    VkSemaphore AcquireSemaphores[VulkanMaxFramesInFlightCount];
+    VkSemaphore PresentSemaphores[VulkanMaxSwapChainImageCount];
+
+    // Present queue fence value of each frame in flight, the CPU waits for the oldest one
+    // before starting a new frame
+    uint64_t FrameFenceValues[VulkanMaxFramesInFlightCount];
+    uint32_t CurrentFrameIndex;
+
+    // When no surface can be created (no window and no VK_EXT_headless_surface), the back buffers
+    // are plain images owned by the swap chain and presenting just rotates through them
+    bool IsOffscreen;
+    VkDeviceMemory OffscreenDeviceMemory[VulkanMaxSwapChainImageCount];
+};
+
+// The pipeline cache header written by the driver doesn't contain the driver version so the
+// cache data is saved with our own header to discard it when the driver is updated
+struct VulkanPipelineCacheFileHeader
+{
+    uint32_t Magic;
+    uint32_t VendorId;
+    uint32_t DeviceId;
+    uint32_t DriverVersion;
+    uint8_t PipelineCacheUuid[VK_UUID_SIZE];
+    uint64_t DataSize;
+};
+
+class VulkanGraphicsService
+{
+    public:
+        VulkanGraphicsService();
+        ~VulkanGraphicsService();
+
+        void GetGraphicsAdapterName(char* output);
+        int SetFramesInFlightCount(int framesInFlightCount);
+        
+        GraphicsAllocationInfos GetBufferAllocationInfos(int sizeInBytes);
+        GraphicsAllocationInfos GetTextureAllocationInfos(enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+        struct GraphicsMemoryBudget GetMemoryBudget(enum GraphicsServiceHeapType heapType);
+
+        void* CreateCommandQueue(enum GraphicsServiceCommandType commandQueueType);
+        void SetCommandQueueLabel(void* commandQueuePointer, char* label);
+        void DeleteCommandQueue(void* commandQueuePointer);
+        void ResetCommandQueue(void* commandQueuePointer);
+        unsigned long GetCommandQueueTimestampFrequency(void* commandQueuePointer);
+        struct GraphicsTimestampCalibration GetCommandQueueTimestampCalibration(void* commandQueuePointer);
+        unsigned long ExecuteCommandLists(void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength);
+        void ExecuteCommandListBatches(struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength);
+        void WaitForCommandQueueOnCpu(struct GraphicsFence fenceToWait);
+
+        void* CreateCommandList(void* commandQueuePointer);
+        void SetCommandListLabel(void* commandListPointer, char* label);
+        void DeleteCommandList(void* commandListPointer);
+        void ResetCommandList(void* commandListPointer);
+        void CommitCommandList(void* commandListPointer);
+
+        void* CreateGraphicsHeap(enum GraphicsServiceHeapType type, unsigned long sizeInBytes);
+        void SetGraphicsHeapLabel(void* graphicsHeapPointer, char* label);
+        void DeleteGraphicsHeap(void* graphicsHeapPointer);
+
+        void* CreateShaderResourceHeap(unsigned long length);
+        unsigned long GetShaderResourceHeapLength(void* shaderResourceHeapPointer);
+        void ResizeShaderResourceHeap(void* shaderResourceHeapPointer, unsigned long length);
+        void SetShaderResourceHeapLabel(void* shaderResourceHeapPointer, char* label);
+        void DeleteShaderResourceHeap(void* shaderResourceHeapPointer);
+        void CreateShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel);
+        void DeleteShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index);
+        void CreateShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable);
+        void DeleteShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index);
+        void CreateShaderResources(void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength);
+
+        void* CreateGraphicsBuffer(void* graphicsHeapPointer, unsigned long heapOffset, GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes);
+        void SetGraphicsBufferLabel(void* graphicsBufferPointer, char* label);
+        void DeleteGraphicsBuffer(void* graphicsBufferPointer);
+        void* GetGraphicsBufferCpuPointer(void* graphicsBufferPointer);
+        void ReleaseGraphicsBufferCpuPointer(void* graphicsBufferPointer);
+
+        void* CreateTexture(void* graphicsHeapPointer, unsigned long heapOffset, int isAliasable, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+        void SetTextureLabel(void* texturePointer, char* label);
+        void DeleteTexture(void* texturePointer);
+
+        void* CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount);
+        void DeleteSwapChain(void* swapChainPointer);
+        void ResizeSwapChain(void* swapChainPointer, int width, int height);
+        void* GetSwapChainBackBufferTexture(void* swapChainPointer);
+        unsigned long PresentSwapChain(void* swapChainPointer);
+        void WaitForSwapChainOnCpu(void* swapChainPointer);
+
+        void* CreateQueryBuffer(enum GraphicsQueryBufferType queryBufferType, int length);
+        void ResetQueryBuffer(void* queryBufferPointer);
+        void SetQueryBufferLabel(void* queryBufferPointer, char* label);
+        void DeleteQueryBuffer(void* queryBufferPointer);
+     
+        void* CreateShader(char* computeShaderFunction, void* shaderByteCode, int shaderByteCodeLength);
+        void* CreateShaderFromArchive(void* shaderArchivePointer, char* shaderName);
+        void SetShaderLabel(void* shaderPointer, char* label);
+        void DeleteShader(void* shaderPointer);
+        void* OpenShaderArchive(char* path);
+        void CloseShaderArchive(void* shaderArchivePointer);
+
+        void* CreateComputePipelineState(void* shaderPointer);
+        void* CreatePipelineState(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor);
+        void* CreatePipelineStateAsync(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState);
+        int IsPipelineStateReady(void* pipelineStatePointer, int waitForCompletion);
+        void SetPipelineStateLabel(void* pipelineStatePointer, char* label);
+        void DeletePipelineState(void* pipelineStatePointer);
+
+        void CopyDataToGraphicsBuffer(void* commandListPointer, void* destinationGraphicsBufferPointer, void* sourceGraphicsBufferPointer, unsigned int sizeInBytes, unsigned int destinationOffsetInBytes, unsigned int sourceOffsetInBytes);
+        void CopyDataToTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceGraphicsBufferPointer, enum GraphicsTextureFormat textureFormat, int width, int height, int slice, int mipLevel);
+        void CopyTexture(void* commandListPointer, void* destinationTexturePointer, void* sourceTexturePointer);
+
+        void TransitionGraphicsBufferToState(void* commandListPointer, void* graphicsBufferPointer, enum GraphicsResourceState resourceState);
+
+        void DispatchThreads(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ);
+
+        void BeginRenderPass(void* commandListPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor);
+        void EndRenderPass(void* commandListPointer);
+
+        void SetPipelineState(void* commandListPointer, void* pipelineStatePointer);
+        void SetShaderResourceHeap(void* commandListPointer, void* shaderResourceHeapPointer);
+        void SetShader(void* commandListPointer, void* shaderPointer);
+        void SetShaderParameterValues(void* commandListPointer, unsigned int slot, unsigned int* values, int valuesLength);
+
+        void SetTextureBarrier(void* commandListPointer, void* texturePointer);
+        void SetGraphicsBufferBarrier(void* commandListPointer, void* graphicsBufferPointer);
+
+        void DispatchMesh(void* commandListPointer, unsigned int threadGroupCountX, unsigned int threadGroupCountY, unsigned int threadGroupCountZ);
+        void ExecuteIndirect(void* commandListPointer, unsigned int maxCommandCount, void* commandGraphicsBufferPointer, unsigned int commandBufferOffset);
+
+        void BeginQuery(void* commandListPointer, void* queryBufferPointer, int index);
+        void EndQuery(void* commandListPointer, void* queryBufferPointer, int index);
+        void ResolveQueryData(void* commandListPointer, void* queryBufferPointer, void* destinationBufferPointer, int startIndex, int endIndex);
+        void BeginGpuZone(void* commandListPointer, unsigned int nameId, char* name);
+        void EndGpuZone(void* commandListPointer);
+        int ResolveGpuZones(struct GraphicsGpuZone* gpuZones, int gpuZonesLength);
+
+        void SavePipelineCache();
+
+    private:
+        string deviceName;
+        VkInstance vulkanInstance = nullptr;
+        VkPhysicalDevice graphicsPhysicalDevice = nullptr;
+        VkDevice graphicsDevice = nullptr;
+        VkDebugReportCallbackEXT debugCallback = nullptr;
+        VkPipelineCache pipelineCache = nullptr;
+        string pipelineCacheFileName;
+
+        // NOTE: Only changed by PresentSwapChain, when no command list is being recorded
+        int32_t currentCommandPoolIndex = 0;
+        int32_t framesInFlightCount = 2;
+
+        // GPU zones are read back with vkGetQueryPoolResults when their frame slot is reused
+        GpuZoneProfiler gpuZoneProfiler { VulkanMaxFramesInFlightCount };
+        VkQueryPool gpuZoneQueryPool = nullptr;
+        vector<uint64_t> gpuZoneQueryResults;
+        vector<uint64_t> gpuZoneTimestamps;
+
+        // Used to estimate the calibration when VK_EXT_calibrated_timestamps is not supported
+        VkQueryPool calibrationQueryPool = nullptr;
+
+        // Frame buffers are cached by render pass and attachments, entries are removed when one
+        // of the attachments or the render pass is deleted
+        unordered_map<VulkanFrameBufferKey, VkFramebuffer, VulkanFrameBufferKeyHash> frameBufferCache;
+        mutex frameBufferCacheLock;
+
+        // Scratch arrays reused by each submit, protected by the submit lock that also
+        // provides the external synchronization needed by the queues
+        vector<VkSubmitInfo2KHR> submitInfos;
+        vector<VkCommandBufferSubmitInfoKHR> submitCommandBufferInfos;
+        vector<VkSemaphoreSubmitInfoKHR> submitSemaphoreInfos;
+        vector<VkBufferMemoryBarrier2KHR> submitBufferBarriers;
+        vector<VkImageMemoryBarrier2KHR> submitTextureBarriers;
+        mutex submitLock;
+
+        VulkanCommandQueue* commandQueues[VulkanMaxCommandQueueCount] = {};
+        vector<VulkanDeferredDelete> deferredDeletes;
+        mutex deferredDeletesLock;
+
+        WorkerThreadPool pipelineCompilerThreadPool { VulkanMaxPipelineCompilerThreadCount };
+
+        // Pipeline objects are hash-consed, an entry is destroyed when its last reference is released
+        unordered_map<VulkanPipelineStateKey, VulkanPipelineState*, VulkanPipelineStateKeyHash> pipelineStateCache;
+        unordered_map<VulkanRenderPassKey, VulkanCachedRenderPass, VulkanRenderPassKeyHash> renderPassCache;
+        unordered_map<uint32_t, VulkanCachedPipelineLayout> pipelineLayoutCache;
+        mutex pipelineStateCacheLock;
+
+        unordered_map<uint64_t, VulkanCachedShaderModule> shaderModuleCache;
+        mutex shaderModuleCacheLock;
+
+        uint32_t renderCommandQueueFamilyIndex;
+        uint32_t computeCommandQueueFamilyIndex;
+        uint32_t copyCommandQueueFamilyIndex;
+
+        uint32_t maxShaderResourceHeapLength;
+
+        uint32_t gpuMemoryTypeIndex;
+        uint32_t uploadMemoryTypeIndex;
+        uint32_t readBackMemoryTypeIndex;
+        uint32_t gpuUploadMemoryTypeIndex;
+        VkDeviceSize nonCoherentAtomSize;
+
+        // Used when the memory budget extension is not available
+        VkPhysicalDeviceMemoryProperties deviceMemoryProperties;
+        atomic<VkDeviceSize> memoryHeapUsages[VK_MAX_MEMORY_HEAPS];
+
+        bool isHeadlessSurfaceSupported = false;
+        bool isSwapChainSupported = false;
+        bool isMutableSwapChainFormatSupported = false;
+        bool isMeshShaderSupported = false;
+        bool isDeviceGeneratedCommandsSupported = false;
+        bool isDescriptorBufferSupported = false;
+        bool isMemoryBudgetSupported = false;
+        bool isPipelineStatisticsSupported = false;
+        bool isCopyQueueTimestampSupported = false;
+        bool isCalibratedTimestampsSupported = false;
+
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptorBufferProperties = {};
+        VkDeviceSize descriptorBufferBindingOffsets[VulkanDescriptorSetLayoutCount];
+
+        VkInstance CreateVulkanInstance();
+        VkPhysicalDevice FindGraphicsDevice();
+        VkDevice CreateDevice(VkPhysicalDevice physicalDevice);
+        void RegisterDebugCallback();
+        string GetPipelineCacheFileName();
+        VkPipelineCache CreatePipelineCache();
+        VkSurfaceKHR CreateWindowSurface(void* windowPointer);
+        void CreateSwapChainBackBuffers(VulkanSwapChain* swapChain, VkFormat textureFormat, int width, int height);
+        void CreateOffscreenBackBuffers(VulkanSwapChain* swapChain, VkFormat textureFormat, int width, int height);
+        void DeleteSwapChainBackBuffers(VulkanSwapChain* swapChain);
+        void CreateSwapChainSemaphores(VulkanSwapChain* swapChain);
+        void DeleteSwapChainSemaphores(VulkanSwapChain* swapChain);
+        VulkanCommandPool* GetCurrentThreadCommandPool(VulkanCommandQueue* commandQueue);
+        void BeginCommandBuffer(VulkanCommandList* commandList);
+        VkFramebuffer GetFrameBuffer(VkRenderPass renderPass, VkImageView* imageViews, uint32_t imageViewCount, uint32_t width, uint32_t height);
+        void RemoveCachedFrameBuffers(VkRenderPass renderPass, VkImageView imageView);
+        void DeferDelete(VkObjectType objectType, uint64_t objectHandle);
+        void ProcessDeferredDeletes(bool isGpuIdle);
+        void AddSubmitSemaphore(VkSemaphore semaphore, uint64_t value);
+        void MoveOwnershipTransfers(VulkanCommandList* commandList);
+        void RemoveOwnershipTransfer(VulkanCommandQueue* commandQueue, VulkanGraphicsBuffer* graphicsBuffer, VulkanTexture* texture);
+        void TransferQueueOwnership(VulkanCommandQueue* commandQueueToWait, VulkanCommandList* acquireCommandList);
+        VulkanPipelineState* AcquirePipelineState(VulkanShader* shader, GraphicsRenderPassDescriptor* renderPassDescriptor, bool* isNew);
+        void CompilePipelineState(VulkanPipelineState* pipelineState, VulkanShader* shader, GraphicsRenderPassDescriptor renderPassDescriptor);
+        VulkanCachedPipelineLayout* AcquirePipelineLayout(uint32_t parameterCount);
+        VkRenderPass AcquireRenderPass(const VulkanRenderPassKey& renderPassKey);
+        VkRenderPass FindRenderPass(const VulkanRenderPassKey& renderPassKey);
+        void DestroyPipelineState(VulkanPipelineState* pipelineState);
+        void AllocateShaderResourceHeapSets(VulkanShaderResourceHeap* shaderResourceHeap, uint32_t length);
+        uint32_t GetMemoryTypeIndex(GraphicsServiceHeapType heapType);
+        VkMappedMemoryRange GetMappedMemoryRange(VulkanGraphicsBuffer* graphicsBuffer);
+        GraphicsTimestampCalibration EstimateTimestampCalibration(VulkanCommandQueue* commandQueue);
+        void ReleaseShaderResourceHeapSets(VulkanShaderResourceHeap* shaderResourceHeap);
+        void CreateDescriptorBuffer(VkDeviceSize sizeInBytes, VkBufferUsageFlags usage, VkBuffer* buffer, VkDeviceMemory* deviceMemory, VkDeviceAddress* deviceAddress, void** cpuPointer);
+        void WriteShaderResourceDescriptors(VulkanShaderResourceHeap* shaderResourceHeap, const uint32_t* indexes, uint32_t indexCount);
+        void SetShaderModule(VulkanShader* shader, ShaderStage shaderStage, const void* code, uint64_t codeSize, uint64_t codeHash);
+        void ReleaseShaderModule(uint64_t shaderModuleKey);
+        void ReleaseShader(VulkanShader* shader);
+};
\ No newline at end of file
@@ -0,0 +1,1077 @@
+#pragma once
+#include "VulkanGraphicsService.h"
+
+// Each recording thread gets a small index used to select its command pools, the index is
+// given back when the thread exits so that worker threads recreated by the runtime can reuse it
+static mutex vulkanThreadIndexLock;
+static vector<uint32_t> vulkanFreeThreadIndexes;
+static uint32_t vulkanThreadCount = 0;
+
+struct VulkanThreadIndex
+{
+	uint32_t Value = UINT32_MAX;
+
+	~VulkanThreadIndex()
+	{
+		if (Value != UINT32_MAX)
+		{
+			lock_guard<mutex> lock(vulkanThreadIndexLock);
+			vulkanFreeThreadIndexes.push_back(Value);
+		}
+	}
+};
+
+static thread_local VulkanThreadIndex vulkanThreadIndex;
+
+uint32_t VulkanGetCurrentThreadIndex()
+{
+	if (vulkanThreadIndex.Value == UINT32_MAX)
+	{
+		lock_guard<mutex> lock(vulkanThreadIndexLock);
+
+		if (vulkanFreeThreadIndexes.size() > 0)
+		{
+			vulkanThreadIndex.Value = vulkanFreeThreadIndexes.back();
+			vulkanFreeThreadIndexes.pop_back();
+		}
+
+		else
+		{
+			vulkanThreadIndex.Value = vulkanThreadCount++;
+		}
+
+		// The per thread command pools are a fixed array so running past it must stop the process in all builds
+		if (vulkanThreadIndex.Value >= VulkanMaxThreadCount)
+		{
+			printf("VULKAN ERROR: More than %d threads are recording command lists\n", VulkanMaxThreadCount);
+			fflush(stdout);
+			abort();
+		}
+	}
+
+	return vulkanThreadIndex.Value;
+}
+
+bool VulkanIsExtensionSupported(const vector<VkExtensionProperties>& extensions, const char* extensionName)
+{
+	for (uint32_t i = 0; i < extensions.size(); i++)
+	{
+		if (strcmp(extensions[i].extensionName, extensionName) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+uint32_t VulkanFindMemoryTypeIndex(const VkPhysicalDeviceMemoryProperties& memoryProperties, uint32_t memoryTypeBits, VkMemoryPropertyFlags requiredFlags, VkMemoryPropertyFlags avoidedFlags, VkMemoryPropertyFlags preferredFlags = 0)
+{
+	// Some devices (integrated or software ones) only expose memory types that have all the flags
+	// so we pick the best match instead of requiring an exact combination
+	uint32_t result = UINT32_MAX;
+	int bestScore = -1;
+
+	for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+	{
+		auto memoryPropertyFlags = memoryProperties.memoryTypes[i].propertyFlags;
+
+		if ((memoryTypeBits & (1 << i)) == 0 || (memoryPropertyFlags & requiredFlags) != requiredFlags)
+		{
+			continue;
+		}
+
+		int score = 0;
+
+		if ((memoryPropertyFlags & avoidedFlags) == 0)
+		{
+			score += 2;
+		}
+
+		if ((memoryPropertyFlags & preferredFlags) == preferredFlags)
+		{
+			score += 1;
+		}
+
+		if (score > bestScore)
+		{
+			bestScore = score;
+			result = i;
+		}
+	}
+
+	assert(result != UINT32_MAX);
+	return result;
+}
+
+VkFence VulkanCreateFence(VkDevice device)
+{
+	VkFenceCreateInfo createInfo = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+
+	VkFence fence = nullptr;
+	AssertIfFailed(vkCreateFence(device, &createInfo, 0, &fence));
+
+	return fence;
+}
+
+VkSemaphore VulkanCreateSemaphore(VkDevice device)
+{
+	VkSemaphoreCreateInfo createInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+
+	VkSemaphore semaphore = nullptr;
+	AssertIfFailed(vkCreateSemaphore(device, &createInfo, 0, &semaphore));
+
+	return semaphore;
+}
+
+VkPresentModeKHR VulkanConvertPresentMode(GraphicsPresentMode presentMode)
+{
+	switch (presentMode)
+	{
+	case GraphicsPresentMode::Mailbox:
+		return VK_PRESENT_MODE_MAILBOX_KHR;
+
+	case GraphicsPresentMode::Immediate:
+		return VK_PRESENT_MODE_IMMEDIATE_KHR;
+
+	default:
+		return VK_PRESENT_MODE_FIFO_KHR;
+	}
+}
+
+void VulkanDestroyObject(VkDevice device, VkObjectType objectType, uint64_t objectHandle)
+{
+	switch (objectType)
+	{
+	case VK_OBJECT_TYPE_BUFFER:
+		vkDestroyBuffer(device, (VkBuffer)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_IMAGE:
+		vkDestroyImage(device, (VkImage)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_IMAGE_VIEW:
+		vkDestroyImageView(device, (VkImageView)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_DEVICE_MEMORY:
+		vkFreeMemory(device, (VkDeviceMemory)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_FRAMEBUFFER:
+		vkDestroyFramebuffer(device, (VkFramebuffer)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_RENDER_PASS:
+		vkDestroyRenderPass(device, (VkRenderPass)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_PIPELINE:
+		vkDestroyPipeline(device, (VkPipeline)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_PIPELINE_LAYOUT:
+		vkDestroyPipelineLayout(device, (VkPipelineLayout)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_SHADER_MODULE:
+		vkDestroyShaderModule(device, (VkShaderModule)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_DESCRIPTOR_POOL:
+		vkDestroyDescriptorPool(device, (VkDescriptorPool)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_SAMPLER:
+		vkDestroySampler(device, (VkSampler)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_QUERY_POOL:
+		vkDestroyQueryPool(device, (VkQueryPool)objectHandle, nullptr);
+		break;
+
+	case VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_NV:
+		vkDestroyIndirectCommandsLayoutNV(device, (VkIndirectCommandsLayoutNV)objectHandle, nullptr);
+		break;
+
+	default:
+		assert(false);
+		break;
+	}
+}
+
+VkDeviceQueueCreateInfo CreateDeviceQueueCreateInfo(uint32_t queueFamilyIndex, uint32_t count)
+{
+    static const float queuePriorities[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    assert(count <= ARRAYSIZE(queuePriorities));
+
+    VkDeviceQueueCreateInfo queueCreateInfo = { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+    queueCreateInfo.pQueuePriorities = queuePriorities;
+    queueCreateInfo.queueCount = count;
+    queueCreateInfo.queueFamilyIndex = queueFamilyIndex;
+
+    return queueCreateInfo;
+}
+
+VkFormat VulkanConvertTextureFormat(GraphicsTextureFormat textureFormat, bool noSrgb = false) 
+{
+	switch (textureFormat)
+	{
+		case GraphicsTextureFormat::Bgra8UnormSrgb:
+			return noSrgb ? VK_FORMAT_B8G8R8A8_UNORM : VK_FORMAT_B8G8R8A8_SRGB;
+	
+		case GraphicsTextureFormat::Depth32Float:
+			return VK_FORMAT_D32_SFLOAT;
+		
+		case GraphicsTextureFormat::R32Float:
+			return VK_FORMAT_R32_SFLOAT;
+	
+		case GraphicsTextureFormat::Rgba16Float:
+			return VK_FORMAT_R16G16B16A16_SFLOAT;
+	
+		case GraphicsTextureFormat::R16Float:
+			return VK_FORMAT_R16_SFLOAT;
+	
+		case GraphicsTextureFormat::BC1Srgb:
+			return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+
+		case GraphicsTextureFormat::BC2Srgb:
+			return VK_FORMAT_BC2_SRGB_BLOCK;
+
+		case GraphicsTextureFormat::BC3Srgb:
+			return noSrgb ? VK_FORMAT_BC3_UNORM_BLOCK : VK_FORMAT_BC3_SRGB_BLOCK;
+
+		case GraphicsTextureFormat::BC4:
+			return VK_FORMAT_BC4_UNORM_BLOCK;
+
+		case GraphicsTextureFormat::BC5:
+			return VK_FORMAT_BC5_UNORM_BLOCK;
+
+		case GraphicsTextureFormat::BC6:
+			return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+
+		case GraphicsTextureFormat::BC7Srgb:
+			return VK_FORMAT_BC7_SRGB_BLOCK;
+
+		case GraphicsTextureFormat::Rgba32Float:
+			return VK_FORMAT_R32G32B32A32_SFLOAT;
+
+		case GraphicsTextureFormat::Rgba16Unorm:
+			return VK_FORMAT_R16G16B16A16_UNORM;
+	}
+        
+	return noSrgb ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_SRGB;
+}
+
+VkBuffer VulkanCreateIndirectCommandWorkingBuffer(VkDevice device, VulkanShader* shader, VulkanPipelineState* pipelineState, uint32_t maxCommandCount, uint32_t gpuMemoryIndex, VkDeviceMemory* deviceMemory, uint32_t* workingBufferSize)
+{
+	VkGeneratedCommandsMemoryRequirementsInfoNV info { VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV };
+	info.pipeline = pipelineState->PipelineStateObject;
+	info.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+	info.maxSequencesCount = maxCommandCount;
+	info.indirectCommandsLayout = shader->CommandSignature;
+	
+	VkMemoryRequirements2 memoryRequirements = { VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2 };
+	vkGetGeneratedCommandsMemoryRequirementsNV(device, &info, &memoryRequirements);
+
+	VkBufferCreateInfo createInfo = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+	createInfo.size = memoryRequirements.memoryRequirements.size;
+	createInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+	VkBuffer buffer = nullptr;
+	AssertIfFailed(vkCreateBuffer(device, &createInfo, nullptr, &buffer));
+
+	VkMemoryRequirements bufferMemoryRequirements;
+	vkGetBufferMemoryRequirements(device, buffer, &bufferMemoryRequirements);
+
+	VkMemoryAllocateInfo allocateInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+	allocateInfo.memoryTypeIndex = gpuMemoryIndex;
+	allocateInfo.allocationSize = bufferMemoryRequirements.size;
+
+	vkAllocateMemory(device, &allocateInfo, nullptr, deviceMemory);
+	AssertIfFailed(vkBindBufferMemory(device, buffer, *deviceMemory, 0));
+
+	*workingBufferSize = memoryRequirements.memoryRequirements.size;
+
+	return buffer;
+}
+
+VkImage CreateImage(VkDevice device, enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
+{
+	VkImageCreateInfo createInfo = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+    createInfo.imageType = VK_IMAGE_TYPE_2D;
+    createInfo.format = VulkanConvertTextureFormat(textureFormat, false);
+    createInfo.extent.width = width;
+    createInfo.extent.height = height;
+    createInfo.extent.depth = 1;
+    createInfo.mipLevels = mipLevels;
+    createInfo.arrayLayers = faceCount;
+    createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    if (usage == GraphicsTextureUsage::ShaderRead)
+    {
+        createInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    }
+
+    else if (usage == GraphicsTextureUsage::RenderTarget && textureFormat == GraphicsTextureFormat::Depth32Float)
+    {
+        createInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    }
+
+    else if (usage == GraphicsTextureUsage::RenderTarget)
+    {
+        createInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    }
+	
+	else if (usage == GraphicsTextureUsage::ShaderWrite)
+    {
+        createInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT;
+    }
+
+	VkImage image = nullptr;
+    AssertIfFailed(vkCreateImage(device, &createInfo, nullptr, &image));
+
+	return image;
+}
+
+VkImageView CreateImageView(VkDevice device, VkImage image, VkFormat textureFormat, uint32_t mipLevel, uint32_t mipLevels)
+{
+	VkImageViewCreateInfo createInfo = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+	createInfo.image = image;
+	createInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+	createInfo.format = textureFormat;
+	createInfo.subresourceRange.aspectMask = (textureFormat != VK_FORMAT_D32_SFLOAT) ? VK_IMAGE_ASPECT_COLOR_BIT : VK_IMAGE_ASPECT_DEPTH_BIT;
+	createInfo.subresourceRange.baseMipLevel = mipLevel;
+	createInfo.subresourceRange.levelCount = mipLevels;
+	createInfo.subresourceRange.layerCount = 1;
+
+	VkImageView view = nullptr;
+	AssertIfFailed(vkCreateImageView(device, &createInfo, 0, &view));
+
+	return view;
+}
+
+VkFramebuffer CreateFramebuffer(VkDevice device, VkRenderPass renderPass, VkImageView* imageViews, uint32_t attachmentCount, uint32_t width, uint32_t height)
+{
+	VkFramebufferCreateInfo createInfo = { VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+	createInfo.renderPass = renderPass;
+	createInfo.attachmentCount = attachmentCount;
+	createInfo.pAttachments = imageViews;
+	createInfo.width = width;
+	createInfo.height = height;
+	createInfo.layers = 1;
+
+	VkFramebuffer framebuffer = nullptr;
+	AssertIfFailed(vkCreateFramebuffer(device, &createInfo, 0, &framebuffer));
+
+	return framebuffer;
+}
+
+// TODO: Pass the struct as a pointer
+VulkanRenderPassKey VulkanCreateRenderPassKey(struct GraphicsRenderPassDescriptor renderPassDescriptor)
+{
+	VulkanRenderPassKey key = {};
+	key.RenderTargetFormat = VulkanConvertTextureFormat(renderPassDescriptor.RenderTarget1TextureFormat.Value);
+	key.DepthFormat = VK_FORMAT_UNDEFINED;
+	key.IsRenderTargetCleared = renderPassDescriptor.RenderTarget1ClearColor.HasValue;
+
+	if (renderPassDescriptor.DepthTexturePointer.HasValue)
+	{
+		VulkanTexture* depthTexture = (VulkanTexture*)renderPassDescriptor.DepthTexturePointer.Value;
+		key.DepthFormat = depthTexture->Format;
+		key.IsDepthCleared = (renderPassDescriptor.DepthBufferOperation == GraphicsDepthBufferOperation::ClearWrite);
+	}
+
+	return key;
+}
+
+VulkanPipelineStateKey VulkanCreatePipelineStateKey(VulkanShader* shader, struct GraphicsRenderPassDescriptor* renderPassDescriptor)
+{
+	VulkanPipelineStateKey key = {};
+	memcpy(key.ShaderModuleHashes, shader->ShaderModuleHashes, sizeof(key.ShaderModuleHashes));
+	key.ParameterCount = shader->ParameterCount;
+	key.IsComputePipelineState = (renderPassDescriptor == nullptr);
+
+	if (renderPassDescriptor != nullptr && renderPassDescriptor->RenderTarget1TexturePointer.HasValue)
+	{
+		key.HasRenderPass = true;
+		key.RenderPassKey = VulkanCreateRenderPassKey(*renderPassDescriptor);
+		key.BlendOperation = renderPassDescriptor->RenderTarget1BlendOperation.HasValue ? renderPassDescriptor->RenderTarget1BlendOperation.Value : GraphicsBlendOperation::None;
+		key.DepthBufferOperation = renderPassDescriptor->DepthBufferOperation;
+		key.PrimitiveType = renderPassDescriptor->PrimitiveType;
+	}
+
+	return key;
+}
+
+VkRenderPass CreateRenderPass(VkDevice device, const VulkanRenderPassKey& renderPassKey)
+{
+	// TODO: Rewrite this to handle all cases!
+
+	uint32_t attachmentCount = 1;
+
+	// TODO: Handle the proper amount of attachments
+    VkAttachmentDescription attachments[2] = {};
+
+	// TODO: Handle RT operations defined in the renderPassDescriptor
+	attachments[0].format = renderPassKey.RenderTargetFormat;
+	attachments[0].samples = VK_SAMPLE_COUNT_1_BIT;
+	attachments[0].loadOp = renderPassKey.IsRenderTargetCleared ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD;
+	attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+	attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+	attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	attachments[0].initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+	attachments[0].finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+	if (renderPassKey.DepthFormat != VK_FORMAT_UNDEFINED)
+	{
+		attachmentCount++;
+
+		attachments[1].format = renderPassKey.DepthFormat;
+		attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
+		attachments[1].loadOp = renderPassKey.IsDepthCleared ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD;
+		attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		attachments[1].initialLayout = VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL;
+		attachments[1].finalLayout = VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL;
+	}
+
+	VkAttachmentReference colorAttachments = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
+	VkAttachmentReference depthAttachments = { 1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL };
+
+	VkSubpassDescription subpass = {};
+	subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+	subpass.colorAttachmentCount = 1;
+	subpass.pColorAttachments = &colorAttachments;
+
+	if (renderPassKey.DepthFormat != VK_FORMAT_UNDEFINED)
+	{
+		subpass.pDepthStencilAttachment = &depthAttachments;
+	}
+
+	VkRenderPassCreateInfo createInfo = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
+	createInfo.attachmentCount = attachmentCount;
+	createInfo.pAttachments = attachments;
+	createInfo.subpassCount = 1;
+	createInfo.pSubpasses = &subpass;
+
+	VkRenderPass renderPass = nullptr;
+	AssertIfFailed(vkCreateRenderPass(device, &createInfo, 0, &renderPass));
+	return renderPass;
+}
+
+// Set when the shader resource heaps are stored in descriptor buffers, the global layouts and the pipelines
+// must then be created with the descriptor buffer flags
+bool globalUseDescriptorBuffer = false;
+
+VkDescriptorSetLayout CreateDescriptorSetLayout(VkDevice device, VkDescriptorType descriptorType, uint32_t descriptorCount, bool isPushDescriptor = false)
+{
+	VkDescriptorBindingFlags flags = {};
+	flags = VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+
+	if (globalUseDescriptorBuffer)
+	{
+		// Descriptor buffers are always partially bound and can be updated after bind
+		flags = VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+	}
+
+	VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags{};
+	binding_flags.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+	binding_flags.bindingCount = 1;
+	binding_flags.pBindingFlags = &flags;
+
+	// TODO: To replace with dynamic shader discovery
+	VkDescriptorSetLayoutBinding descriptorBinding = {};
+	descriptorBinding.binding = 0;
+	descriptorBinding.descriptorType = descriptorType;
+	descriptorBinding.descriptorCount = descriptorCount;
+	descriptorBinding.stageFlags = VK_SHADER_STAGE_ALL;
+
+	VkDescriptorSetLayoutCreateInfo descriptorSetCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+	descriptorSetCreateInfo.flags = globalUseDescriptorBuffer ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+	descriptorSetCreateInfo.bindingCount = 1;
+	descriptorSetCreateInfo.pBindings = &descriptorBinding;
+	descriptorSetCreateInfo.pNext = &binding_flags;
+
+	VkDescriptorSetLayout setLayout = nullptr;
+	AssertIfFailed(vkCreateDescriptorSetLayout(device, &descriptorSetCreateInfo, 0, &setLayout));
+
+	return setLayout;
+}
+
+// Upper bound of the variable descriptor count of the global resource layouts
+uint32_t globalResourceDescriptorCount = 2500;
+
+VkDescriptorSetLayout globalBufferLayout = nullptr;
+
+VkDescriptorSetLayout GetGlobalBufferLayout(VkDevice device)
+{
+	if (globalBufferLayout == nullptr)
+	{
+		globalBufferLayout = CreateDescriptorSetLayout(device, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, globalResourceDescriptorCount);
+	}
+
+	return globalBufferLayout;
+}
+
+VkDescriptorSetLayout globalTextureLayout = nullptr;
+
+VkDescriptorSetLayout GetGlobalTextureLayout(VkDevice device)
+{
+	if (globalTextureLayout == nullptr)
+	{
+		globalTextureLayout = CreateDescriptorSetLayout(device, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, globalResourceDescriptorCount);
+	}
+
+	return globalTextureLayout;
+}
+
+VkDescriptorSetLayout globalUavBufferLayout = nullptr;
+
+VkDescriptorSetLayout GetGlobalUavBufferLayout(VkDevice device)
+{
+	if (globalUavBufferLayout == nullptr)
+	{
+		globalUavBufferLayout = CreateDescriptorSetLayout(device, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, globalResourceDescriptorCount);
+	}
+
+	return globalUavBufferLayout;
+}
+
+VkDescriptorSetLayout globalUavTextureLayout = nullptr;
+
+VkDescriptorSetLayout GetGlobalUavTextureLayout(VkDevice device)
+{
+	if (globalUavTextureLayout == nullptr)
+	{
+		globalUavTextureLayout = CreateDescriptorSetLayout(device, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, globalResourceDescriptorCount);
+	}
+
+	return globalUavTextureLayout;
+}
+
+VkDescriptorSetLayout globalSamplerLayout = nullptr;
+
+VkDescriptorSetLayout GetGlobalSamplerLayout(VkDevice device)
+{
+	if (globalSamplerLayout == nullptr)
+	{
+		globalSamplerLayout = CreateDescriptorSetLayout(device, VK_DESCRIPTOR_TYPE_SAMPLER, 1);
+	}
+
+	return globalSamplerLayout;
+}
+
+// The set layouts are written to outputSetLayouts that must have room for VulkanDescriptorSetLayoutCount layouts
+VkPipelineLayout CreateGraphicsPipelineLayout(VkDevice device, uint32_t parameterCount, VkDescriptorSetLayout* outputSetLayouts)
+{
+	// TODO: To replace with dynamic shader discovery
+	outputSetLayouts[0] = GetGlobalBufferLayout(device);
+	outputSetLayouts[1] = GetGlobalTextureLayout(device);
+	outputSetLayouts[2] = GetGlobalUavBufferLayout(device);
+	outputSetLayouts[3] = GetGlobalUavTextureLayout(device);
+	outputSetLayouts[4] = GetGlobalSamplerLayout(device);
+
+	VkPipelineLayoutCreateInfo layoutCreateInfo = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+	layoutCreateInfo.pSetLayouts = outputSetLayouts;
+	layoutCreateInfo.setLayoutCount = VulkanDescriptorSetLayoutCount;
+
+	// TODO: 
+	VkPushConstantRange push_constant;
+	push_constant.offset = 0;
+	push_constant.size = parameterCount * sizeof(uint32_t);
+	push_constant.stageFlags = VK_SHADER_STAGE_ALL;
+
+	layoutCreateInfo.pPushConstantRanges = &push_constant;
+	layoutCreateInfo.pushConstantRangeCount = 1;
+
+	VkPipelineLayout layout = 0;
+	AssertIfFailed(vkCreatePipelineLayout(device, &layoutCreateInfo, 0, &layout));
+
+	return layout;
+}
+
+VkIndirectCommandsLayoutNV CreateIndirectPipelineLayout(VkDevice device, bool isComputeShader, uint32_t parameterCount)
+{
+	// TODO: Skip compute shaders for now
+	if (isComputeShader)
+	{
+		return nullptr;
+	}
+
+	VkIndirectCommandsLayoutTokenNV arguments[2] = {};
+	arguments[0] = { VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV };
+	arguments[0].tokenType = VK_INDIRECT_COMMANDS_TOKEN_TYPE_PUSH_CONSTANT_NV;
+	arguments[0].stream = 0;
+	arguments[0].pushconstantSize = parameterCount * sizeof(uint32_t);
+	arguments[1] = { VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV };
+	arguments[1].tokenType = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_TASKS_NV;
+	arguments[1].stream = 0;
+	arguments[1].offset = parameterCount * sizeof(uint32_t);
+
+	uint32_t strides[1] = {(3 + parameterCount) * sizeof(uint32_t)};
+
+	VkIndirectCommandsLayoutCreateInfoNV createInfo = { VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV };
+    createInfo.flags = VK_INDIRECT_COMMANDS_LAYOUT_USAGE_UNORDERED_SEQUENCES_BIT_NV;
+    createInfo.pipelineBindPoint = isComputeShader ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS;
+    createInfo.tokenCount = ARRAYSIZE(arguments);
+    createInfo.pTokens = arguments;
+	createInfo.streamCount = 1;
+	createInfo.pStreamStrides = strides;
+
+	VkIndirectCommandsLayoutNV layout = nullptr;
+	AssertIfFailed(vkCreateIndirectCommandsLayoutNV(device, &createInfo, nullptr, &layout));
+
+	return layout;
+}
+
+VkPipelineColorBlendAttachmentState VulkanInitBlendState(GraphicsBlendOperation blendOperation)
+{
+	switch (blendOperation)
+	{
+		case GraphicsBlendOperation::AlphaBlending:
+			return {
+				true,
+				VK_BLEND_FACTOR_SRC_ALPHA, VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA, VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_SRC_ALPHA, VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA, VK_BLEND_OP_ADD,
+				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT
+			};
+
+		default:
+			return {
+				false,
+				VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ZERO, VK_BLEND_OP_ADD,
+				VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ZERO, VK_BLEND_OP_ADD,
+				VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT
+			};
+	}
+}
+
+VkDescriptorImageInfo GetShaderResourceImageInfo(const VulkanShaderResourceDescriptor& descriptor)
+{
+	VulkanTexture* texture = (VulkanTexture*)descriptor.ResourcePointer;
+	VkDescriptorImageInfo imageInfo = {};
+
+	if (!descriptor.IsWriteable)
+	{
+		imageInfo.imageView = descriptor.MipLevel == 0 ? texture->ImageView : texture->ImageViews[descriptor.MipLevel];
+		imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	}
+
+	else
+	{
+		assert(descriptor.MipLevel < texture->ImageViews.size());
+
+		imageInfo.imageView = texture->ImageViews[descriptor.MipLevel];
+		imageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+	}
+
+	return imageInfo;
+}
+
+VkPipeline CreateComputePipeline(VkDevice device, VkPipelineCache pipelineCache, VkPipelineLayout layout, VulkanShader* shader)
+{
+	VkComputePipelineCreateInfo createInfo = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+
+	VkPipelineShaderStageCreateInfo stage = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO };
+	stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+	stage.module = shader->ComputeShaderMethod;
+	stage.pName = "ComputeMain";
+
+	createInfo.stage = stage;
+	createInfo.layout = layout;
+	createInfo.flags = globalUseDescriptorBuffer ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
+
+	VkPipeline pipeline = 0;
+	AssertIfFailed(vkCreateComputePipelines(device, pipelineCache, 1, &createInfo, 0, &pipeline));
+
+	return pipeline;
+}
+
+VkPipeline CreateGraphicsPipeline(VkDevice device, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkPipelineLayout layout, GraphicsRenderPassDescriptor renderPassDescriptor, VulkanShader* shader)
+{
+	VkGraphicsPipelineCreateInfo createInfo = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO };
+
+	uint32_t stagesCount = 2;
+
+	VkPipelineShaderStageCreateInfo stages[3] = {};
+	stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[0].stage = VK_SHADER_STAGE_MESH_BIT_NV;
+	stages[0].module = shader->MeshShaderMethod;
+	stages[0].pName = "MeshMain";
+	stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+	stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+	stages[1].module = shader->PixelShaderMethod;
+	stages[1].pName = "PixelMain";
+
+	if (shader->AmplificationShaderMethod)
+	{
+		stages[2].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		stages[2].stage = VK_SHADER_STAGE_TASK_BIT_NV;
+		stages[2].module = shader->AmplificationShaderMethod;
+		stages[2].pName = "AmplificationMain";
+
+		stagesCount++;
+	}
+
+	createInfo.stageCount = stagesCount;
+	createInfo.pStages = stages;
+	createInfo.flags = globalUseDescriptorBuffer ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
+
+	VkPipelineInputAssemblyStateCreateInfo inputAssemblyState = { VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO };
+	inputAssemblyState.topology = renderPassDescriptor.PrimitiveType == GraphicsPrimitiveType::Triangle ? VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST : VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+	createInfo.pInputAssemblyState = &inputAssemblyState;
+
+	VkPipelineViewportStateCreateInfo viewportState = { VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO };
+	viewportState.viewportCount = 1;
+	viewportState.scissorCount = 1;
+	createInfo.pViewportState = &viewportState;
+
+	VkPipelineRasterizationStateCreateInfo rasterizationState = { VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO };
+	rasterizationState.lineWidth = 1.0f;
+	rasterizationState.cullMode = VK_CULL_MODE_BACK_BIT;
+	rasterizationState.frontFace = VK_FRONT_FACE_CLOCKWISE;
+	createInfo.pRasterizationState = &rasterizationState;
+
+	VkPipelineMultisampleStateCreateInfo multisampleState = { VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO };
+	multisampleState.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+	createInfo.pMultisampleState = &multisampleState;
+
+	VkPipelineDepthStencilStateCreateInfo depthStencilState = { VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO };
+
+	if (renderPassDescriptor.DepthBufferOperation != GraphicsDepthBufferOperation::DepthNone)
+	{
+		depthStencilState.depthTestEnable = true;
+
+		if (renderPassDescriptor.DepthBufferOperation == GraphicsDepthBufferOperation::ClearWrite ||
+			renderPassDescriptor.DepthBufferOperation == GraphicsDepthBufferOperation::Write)
+		{
+			depthStencilState.depthWriteEnable = true;
+		}
+
+		if (renderPassDescriptor.DepthBufferOperation == GraphicsDepthBufferOperation::CompareEqual)
+		{
+			depthStencilState.depthCompareOp = VK_COMPARE_OP_EQUAL;
+		}
+
+		else
+		{
+			depthStencilState.depthCompareOp = VK_COMPARE_OP_GREATER;
+		}
+	}
+
+	createInfo.pDepthStencilState = &depthStencilState;
+
+	VkPipelineColorBlendAttachmentState colorAttachmentState = VulkanInitBlendState(GraphicsBlendOperation::None);
+	
+	if (renderPassDescriptor.RenderTarget1BlendOperation.HasValue)
+	{
+		colorAttachmentState = VulkanInitBlendState(renderPassDescriptor.RenderTarget1BlendOperation.Value);
+	}
+
+	VkPipelineColorBlendStateCreateInfo colorBlendState = { VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO };
+	colorBlendState.attachmentCount = 1;
+	colorBlendState.pAttachments = &colorAttachmentState;
+
+	createInfo.pColorBlendState = &colorBlendState;
+
+	VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+
+	VkPipelineDynamicStateCreateInfo dynamicState = { VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO };
+	dynamicState.dynamicStateCount = sizeof(dynamicStates) / sizeof(dynamicStates[0]);
+	dynamicState.pDynamicStates = dynamicStates;
+	createInfo.pDynamicState = &dynamicState;
+
+	createInfo.layout = layout;
+	createInfo.renderPass = renderPass;
+
+	VkPipeline pipeline = 0;
+	AssertIfFailed(vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, 0, &pipeline));
+
+	return pipeline;
+}
+
+VkShaderModule CreateShaderModule(VkDevice device, void* data, int dataLength)
+{
+	VkShaderModuleCreateInfo createInfo = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+	createInfo.codeSize = dataLength;
+	createInfo.pCode = reinterpret_cast<const uint32_t*>(data);
+
+	VkShaderModule shaderModule = nullptr;
+	AssertIfFailed(vkCreateShaderModule(device, &createInfo, 0, &shaderModule));
+
+	return shaderModule;
+}
+
+// Accesses that must be made available before the resource is accessed again
+static const VkAccessFlags2KHR VulkanWriteAccessFlags = VK_ACCESS_2_SHADER_WRITE_BIT_KHR | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT_KHR | VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR | VK_ACCESS_2_HOST_WRITE_BIT_KHR | VK_ACCESS_2_MEMORY_WRITE_BIT_KHR;
+
+VkBufferMemoryBarrier2KHR CreateBufferTransitionBarrier(VkBuffer buffer, uint32_t sizeInBytes, const VulkanResourceState& oldState, const VulkanResourceState& newState)
+{
+	VkBufferMemoryBarrier2KHR result = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR };
+
+	result.srcStageMask = oldState.Stage;
+	result.srcAccessMask = oldState.Access;
+	result.dstStageMask = newState.Stage;
+	result.dstAccessMask = newState.Access;
+	result.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	result.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	result.buffer = buffer;
+	result.offset = 0;
+	result.size = sizeInBytes;
+
+	return result;
+}
+
+VkImageMemoryBarrier2KHR CreateImageTransitionBarrier(VkImage image, const VulkanResourceState& oldState, const VulkanResourceState& newState, bool isDepthBuffer)
+{
+	VkImageMemoryBarrier2KHR result = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR };
+
+	result.srcStageMask = oldState.Stage;
+	result.srcAccessMask = oldState.Access;
+	result.dstStageMask = newState.Stage;
+	result.dstAccessMask = newState.Access;
+	result.oldLayout = oldState.Layout;
+	result.newLayout = newState.Layout;
+	result.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	result.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	result.image = image;
+	result.subresourceRange.aspectMask = isDepthBuffer ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+	result.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+	result.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+
+	return result;
+}
+
+bool IsWriteAccess(VkAccessFlags2KHR sourceAccess, VkAccessFlags2KHR destinationAccess)
+{
+	return ((sourceAccess | destinationAccess) & VulkanWriteAccessFlags) != 0;
+}
+
+// Returns the state of the resource seen by the command list, the accesses of the other queues are ignored
+VulkanResourceState GetResourceState(VulkanCommandList* commandList, const VulkanResourceState& resourceState)
+{
+	if (resourceState.CommandQueue != commandList->CommandQueue)
+	{
+		return { VK_PIPELINE_STAGE_2_NONE_KHR, VK_ACCESS_2_NONE_KHR, resourceState.Layout, commandList->CommandQueue };
+	}
+
+	return resourceState;
+}
+
+VulkanCommandListResourceState* GetCommandListResourceState(VulkanCommandList* commandList, void* resourcePointer)
+{
+	auto iterator = commandList->ResourceStateIndices.find(resourcePointer);
+	return (iterator != commandList->ResourceStateIndices.end()) ? &commandList->ResourceStates[iterator->second] : nullptr;
+}
+
+VulkanCommandListResourceState* AddCommandListResourceState(VulkanCommandList* commandList, VulkanGraphicsBuffer* graphicsBuffer, VulkanTexture* texture, const VulkanResourceState& firstState)
+{
+	void* resourcePointer = (graphicsBuffer != nullptr) ? (void*)graphicsBuffer : (void*)texture;
+	commandList->ResourceStateIndices[resourcePointer] = (uint32_t)commandList->ResourceStates.size();
+	commandList->ResourceStates.push_back({ graphicsBuffer, texture, firstState, firstState, false, (firstState.Access & VulkanWriteAccessFlags) != 0 });
+
+	return &commandList->ResourceStates.back();
+}
+
+// A destination stage of none hands the buffer over to the other queues without a barrier
+void TransitionBufferToState(VulkanCommandList* commandList, VulkanGraphicsBuffer* buffer, VkPipelineStageFlags2KHR destinationStage, VkAccessFlags2KHR destinationAccess)
+{
+	VulkanResourceState destinationState = { destinationStage, destinationAccess, VK_IMAGE_LAYOUT_UNDEFINED, commandList->CommandQueue };
+	auto resourceState = GetCommandListResourceState(commandList, buffer);
+
+	// The barrier from the state left by the previous command lists is recorded at submit
+	if (resourceState == nullptr)
+	{
+		AddCommandListResourceState(commandList, buffer, nullptr, destinationState);
+		return;
+	}
+
+	auto sourceState = resourceState->LastState;
+	VkBufferMemoryBarrier2KHR* pendingBarrier = nullptr;
+
+	for (auto& barrier : commandList->BufferBarriers)
+	{
+		if (barrier.buffer == buffer->BufferObject)
+		{
+			pendingBarrier = &barrier;
+			break;
+		}
+	}
+
+	if (!IsWriteAccess(sourceState.Access, destinationAccess))
+	{
+		// Reads can overlap, their stages are accumulated so that the next write waits for all of them
+		destinationState.Stage |= sourceState.Stage;
+		destinationState.Access |= sourceState.Access;
+
+		if (pendingBarrier != nullptr)
+		{
+			pendingBarrier->dstStageMask |= destinationStage;
+			pendingBarrier->dstAccessMask |= destinationAccess;
+		}
+
+		else if (!resourceState->HasBarrier)
+		{
+			resourceState->FirstState.Stage |= destinationStage;
+			resourceState->FirstState.Access |= destinationAccess;
+		}
+	}
+
+	else
+	{
+		if (pendingBarrier != nullptr)
+		{
+			// The buffer was not used since the pending barrier so it goes directly to the new state
+			pendingBarrier->dstStageMask = destinationStage;
+			pendingBarrier->dstAccessMask = destinationAccess;
+		}
+
+		else if (sourceState.Stage != VK_PIPELINE_STAGE_2_NONE_KHR && destinationStage != VK_PIPELINE_STAGE_2_NONE_KHR)
+		{
+			commandList->BufferBarriers.push_back(CreateBufferTransitionBarrier(buffer->BufferObject, buffer->SizeInBytes, sourceState, destinationState));
+		}
+
+		resourceState->HasBarrier = true;
+	}
+
+	resourceState->LastState = destinationState;
+	resourceState->IsWritten |= (destinationAccess & VulkanWriteAccessFlags) != 0;
+}
+
+void TransitionTextureToState(VulkanCommandList* commandList, VulkanTexture* texture, VkPipelineStageFlags2KHR destinationStage, VkAccessFlags2KHR destinationAccess, VkImageLayout destinationLayout)
+{
+	VulkanResourceState destinationState = { destinationStage, destinationAccess, destinationLayout, commandList->CommandQueue };
+	auto resourceState = GetCommandListResourceState(commandList, texture);
+
+	if (resourceState == nullptr)
+	{
+		AddCommandListResourceState(commandList, nullptr, texture, destinationState);
+		return;
+	}
+
+	auto sourceState = resourceState->LastState;
+	VkImageMemoryBarrier2KHR* pendingBarrier = nullptr;
+
+	for (auto& barrier : commandList->TextureBarriers)
+	{
+		if (barrier.image == texture->TextureObject)
+		{
+			pendingBarrier = &barrier;
+			break;
+		}
+	}
+
+	if (sourceState.Layout == destinationLayout && !IsWriteAccess(sourceState.Access, destinationAccess))
+	{
+		destinationState.Stage |= sourceState.Stage;
+		destinationState.Access |= sourceState.Access;
+
+		if (pendingBarrier != nullptr)
+		{
+			pendingBarrier->dstStageMask |= destinationStage;
+			pendingBarrier->dstAccessMask |= destinationAccess;
+		}
+
+		else if (!resourceState->HasBarrier)
+		{
+			resourceState->FirstState.Stage |= destinationStage;
+			resourceState->FirstState.Access |= destinationAccess;
+		}
+	}
+
+	else
+	{
+		if (pendingBarrier != nullptr)
+		{
+			pendingBarrier->dstStageMask = destinationStage;
+			pendingBarrier->dstAccessMask = destinationAccess;
+			pendingBarrier->newLayout = destinationLayout;
+		}
+
+		else if (sourceState.Layout != destinationLayout || (sourceState.Stage != VK_PIPELINE_STAGE_2_NONE_KHR && destinationStage != VK_PIPELINE_STAGE_2_NONE_KHR))
+		{
+			commandList->TextureBarriers.push_back(CreateImageTransitionBarrier(texture->TextureObject, sourceState, destinationState, texture->Format == VK_FORMAT_D32_SFLOAT));
+		}
+
+		resourceState->HasBarrier = true;
+	}
+
+	resourceState->LastState = destinationState;
+	resourceState->IsWritten |= (destinationAccess & VulkanWriteAccessFlags) != 0;
+}
+
+// Adds the barriers from the state left by the previously submitted command lists to the first state of the resources
+// used by the command list and updates the resource states. It is called in submit order with the submit lock held.
+void ResolveResourceStates(VulkanCommandList* commandList, vector<VkBufferMemoryBarrier2KHR>& bufferBarriers, vector<VkImageMemoryBarrier2KHR>& textureBarriers)
+{
+	for (auto& commandListResourceState : commandList->ResourceStates)
+	{
+		VulkanGraphicsBuffer* graphicsBuffer = commandListResourceState.GraphicsBuffer;
+		VulkanTexture* texture = commandListResourceState.Texture;
+
+		auto& resourceState = (graphicsBuffer != nullptr) ? graphicsBuffer->ResourceState : texture->ResourceState;
+		auto sourceState = GetResourceState(commandList, resourceState);
+		auto firstState = commandListResourceState.FirstState;
+		auto lastState = commandListResourceState.LastState;
+
+		bool isWriteAccess = IsWriteAccess(sourceState.Access, firstState.Access);
+		bool isLayoutChanged = (texture != nullptr && sourceState.Layout != firstState.Layout);
+
+		if (isLayoutChanged || (isWriteAccess && sourceState.Stage != VK_PIPELINE_STAGE_2_NONE_KHR && firstState.Stage != VK_PIPELINE_STAGE_2_NONE_KHR))
+		{
+			if (graphicsBuffer != nullptr)
+			{
+				bufferBarriers.push_back(CreateBufferTransitionBarrier(graphicsBuffer->BufferObject, graphicsBuffer->SizeInBytes, sourceState, firstState));
+			}
+
+			else
+			{
+				textureBarriers.push_back(CreateImageTransitionBarrier(texture->TextureObject, sourceState, firstState, texture->Format == VK_FORMAT_D32_SFLOAT));
+			}
+		}
+
+		else if (!isWriteAccess && !commandListResourceState.HasBarrier)
+		{
+			// The reads of the command list overlap the previous ones so the next write also waits for them
+			lastState.Stage |= sourceState.Stage;
+			lastState.Access |= sourceState.Access;
+		}
+
+		resourceState = lastState;
+	}
+}
+
+VulkanCommandQueue*& GetOwnershipTransferQueue(const VulkanOwnershipTransfer& ownershipTransfer)
+{
+	return (ownershipTransfer.GraphicsBuffer != nullptr) ? ownershipTransfer.GraphicsBuffer->OwnershipTransferQueue : ownershipTransfer.Texture->OwnershipTransferQueue;
+}
+
+// Emits the accumulated transitions in one barrier, it must be called before recording a command that
+// accesses the resources. The optional memory barrier is added to the same batch.
+void FlushBarriers(VulkanCommandList* commandList, const VkMemoryBarrier2KHR* memoryBarrier = nullptr)
+{
+	if (commandList->BufferBarriers.empty() && commandList->TextureBarriers.empty() && memoryBarrier == nullptr)
+	{
+		return;
+	}
+
+	// Render passes have no self dependencies so the transitions are flushed before they begin
+	assert(!commandList->IsRenderPassActive);
+
+	VkDependencyInfoKHR dependencyInfo = { VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR };
+	dependencyInfo.memoryBarrierCount = (memoryBarrier != nullptr) ? 1 : 0;
+	dependencyInfo.pMemoryBarriers = memoryBarrier;
+	dependencyInfo.bufferMemoryBarrierCount = (uint32_t)commandList->BufferBarriers.size();
+	dependencyInfo.pBufferMemoryBarriers = commandList->BufferBarriers.data();
+	dependencyInfo.imageMemoryBarrierCount = (uint32_t)commandList->TextureBarriers.size();
+	dependencyInfo.pImageMemoryBarriers = commandList->TextureBarriers.data();
+
+	vkCmdPipelineBarrier2KHR(commandList->CommandBufferObject, &dependencyInfo);
+
+	commandList->BufferBarriers.clear();
+	commandList->TextureBarriers.clear();
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Small pool of threads used by the graphics services to run long CPU jobs like pipeline
+// compilation without blocking the engine thread
+class WorkerThreadPool
+{
+    public:
+        WorkerThreadPool(uint32_t maxThreadCount);
+        ~WorkerThreadPool();
+
+        void Enqueue(function<void()> work);
+
+        // Waits until the flag is set by a work item, the flag must be set before the work item returns
+        void Wait(const atomic<bool>& isCompleted);
+
+        // Wakes up the waiting threads when a flag was set outside of a work item
+        void Notify();
+
+        // Runs the remaining work items and joins the threads, no work can be enqueued after that
+        void Stop();
+
+    private:
+        vector<thread> threads;
+        deque<function<void()>> workQueue;
+        mutex workQueueLock;
+        condition_variable workAvailableCondition;
+        condition_variable workCompletedCondition;
+        bool isStopping = false;
+
+        void RunWorker();
+};
+
+WorkerThreadPool::WorkerThreadPool(uint32_t maxThreadCount)
+{
+    // One core is left to the engine thread
+    uint32_t threadCount = thread::hardware_concurrency() > 1 ? thread::hardware_concurrency() - 1 : 1;
+    threadCount = threadCount > maxThreadCount ? maxThreadCount : threadCount;
+    threadCount = threadCount > 0 ? threadCount : 1;
+
+    for (uint32_t i = 0; i < threadCount; i++)
+    {
+        this->threads.push_back(thread(&WorkerThreadPool::RunWorker, this));
+    }
+}
+
+WorkerThreadPool::~WorkerThreadPool()
+{
+    Stop();
+}
+
+void WorkerThreadPool::Enqueue(function<void()> work)
+{
+    {
+        lock_guard<mutex> lock(this->workQueueLock);
+        assert(!this->isStopping);
+
+        this->workQueue.push_back(move(work));
+    }
+
+    this->workAvailableCondition.notify_one();
+}
+
+void WorkerThreadPool::Wait(const atomic<bool>& isCompleted)
+{
+    unique_lock<mutex> lock(this->workQueueLock);
+    this->workCompletedCondition.wait(lock, [&isCompleted] { return isCompleted.load(); });
+}
+
+void WorkerThreadPool::Notify()
+{
+    // The lock is taken so that a waiter cannot miss the notification between its check and its wait
+    {
+        lock_guard<mutex> lock(this->workQueueLock);
+    }
+
+    this->workCompletedCondition.notify_all();
+}
+
+void WorkerThreadPool::Stop()
+{
+    {
+        lock_guard<mutex> lock(this->workQueueLock);
+        this->isStopping = true;
+    }
+
+    this->workAvailableCondition.notify_all();
+
+    for (auto& workerThread : this->threads)
+    {
+        workerThread.join();
+    }
+
+    this->threads.clear();
+}
+
+void WorkerThreadPool::RunWorker()
+{
+    while (true)
+    {
+        function<void()> work;
+
+        {
+            unique_lock<mutex> lock(this->workQueueLock);
+            this->workAvailableCondition.wait(lock, [this] { return this->isStopping || !this->workQueue.empty(); });
+
+            if (this->workQueue.empty())
+            {
+                return;
+            }
+
+            work = move(this->workQueue.front());
+            this->workQueue.pop_front();
+        }
+
+        work();
+        Notify();
+    }
+}
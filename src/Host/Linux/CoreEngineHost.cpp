@@ -0,0 +1,35 @@
+#pragma once
+#include "LinuxCommon.h"
+#include "CoreEngineHost.h"
+#include "HostServices/LinuxNativeUIServiceInterop.h"
+#include "../Common/HostServices/VulkanGraphicsServiceInterop.h"
+#include "../Common/HostServices/NullGraphicsServiceInterop.h"
+#include "HostServices/LinuxInputsServiceInterop.h"
+
+using namespace std;
+
+CoreEngineHost::CoreEngineHost(const string assemblyName, const LinuxNativeUIService* nativeUIService, const VulkanGraphicsService* vulkanGraphicsService, const NullGraphicsService* nullGraphicsService, const LinuxInputsService* inputsService) : nativeUIService(nativeUIService), vulkanGraphicsService(vulkanGraphicsService), nullGraphicsService(nullGraphicsService), inputsService(inputsService)
+{
+    NativeHost_LoadEngine(&this->startEnginePointer, assemblyName, false);
+}
+
+void CoreEngineHost::StartEngine()
+{
+    HostPlatform hostPlatform = {};
+
+    InitLinuxNativeUIService(this->nativeUIService, &hostPlatform.NativeUIService);
+
+    if (this->vulkanGraphicsService != nullptr)
+    {
+        InitVulkanGraphicsService(this->vulkanGraphicsService, &hostPlatform.GraphicsService);
+    }
+
+    else
+    {
+        InitNullGraphicsService(this->nullGraphicsService, &hostPlatform.GraphicsService);
+    }
+
+    InitLinuxInputsService(this->inputsService, &hostPlatform.InputsService);
+
+    this->startEnginePointer(hostPlatform);
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "LinuxCommon.h"
+#include "LinuxNativeUIService.h"
+#include "LinuxInputsService.h"
+#include "../Common/VulkanGraphicsService.h"
+#include "../Common/NullGraphicsService.h"
+#include "../Common/CoreEngine.h"
+#include "../Common/NativeHost.cpp"
+
+using namespace std;
+
+class CoreEngineHost
+{
+public:
+    CoreEngineHost(const string assemblyName, const LinuxNativeUIService* nativeUIService, const VulkanGraphicsService* vulkanGraphicsService, const NullGraphicsService* nullGraphicsService, const LinuxInputsService* inputsService);
+
+    void StartEngine();
+
+private:
+    const LinuxNativeUIService* nativeUIService;
+    const VulkanGraphicsService* vulkanGraphicsService;
+    const NullGraphicsService* nullGraphicsService;
+    const LinuxInputsService* inputsService;
+
+    StartEnginePtr startEnginePointer;    
+};
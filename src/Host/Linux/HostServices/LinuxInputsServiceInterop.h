@@ -0,0 +1,28 @@
+#pragma once
+#include "../LinuxInputsService.h"
+
+void LinuxInputsServiceAssociateWindowInterop(void* context, void* windowPointer)
+{
+    auto contextObject = (LinuxInputsService*)context;
+    contextObject->AssociateWindow(windowPointer);
+}
+
+struct InputsState LinuxInputsServiceGetInputsStateInterop(void* context)
+{
+    auto contextObject = (LinuxInputsService*)context;
+    return contextObject->GetInputsState();
+}
+
+void LinuxInputsServiceSendVibrationCommandInterop(void* context, unsigned int playerId, float leftTriggerMotor, float rightTriggerMotor, float leftStickMotor, float rightStickMotor, unsigned int duration10ms)
+{
+    auto contextObject = (LinuxInputsService*)context;
+    contextObject->SendVibrationCommand(playerId, leftTriggerMotor, rightTriggerMotor, leftStickMotor, rightStickMotor, duration10ms);
+}
+
+void InitLinuxInputsService(const LinuxInputsService* context, InputsService* service)
+{
+    service->Context = (void*)context;
+    service->InputsService_AssociateWindow = LinuxInputsServiceAssociateWindowInterop;
+    service->InputsService_GetInputsState = LinuxInputsServiceGetInputsStateInterop;
+    service->InputsService_SendVibrationCommand = LinuxInputsServiceSendVibrationCommandInterop;
+}
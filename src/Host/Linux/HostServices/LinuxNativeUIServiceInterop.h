@@ -0,0 +1,35 @@
+#pragma once
+#include "../LinuxNativeUIService.h"
+
+void* LinuxNativeUIServiceCreateWindowInterop(void* context, char* title, int width, int height, enum NativeWindowState windowState)
+{
+    auto contextObject = (LinuxNativeUIService*)context;
+    return contextObject->CreateWindow(title, width, height, windowState);
+}
+
+void LinuxNativeUIServiceSetWindowTitleInterop(void* context, void* windowPointer, char* title)
+{
+    auto contextObject = (LinuxNativeUIService*)context;
+    contextObject->SetWindowTitle(windowPointer, title);
+}
+
+struct Vector2 LinuxNativeUIServiceGetWindowRenderSizeInterop(void* context, void* windowPointer)
+{
+    auto contextObject = (LinuxNativeUIService*)context;
+    return contextObject->GetWindowRenderSize(windowPointer);
+}
+
+struct NativeAppStatus LinuxNativeUIServiceProcessSystemMessagesInterop(void* context)
+{
+    auto contextObject = (LinuxNativeUIService*)context;
+    return contextObject->ProcessSystemMessages();
+}
+
+void InitLinuxNativeUIService(const LinuxNativeUIService* context, NativeUIService* service)
+{
+    service->Context = (void*)context;
+    service->NativeUIService_CreateWindow = LinuxNativeUIServiceCreateWindowInterop;
+    service->NativeUIService_SetWindowTitle = LinuxNativeUIServiceSetWindowTitleInterop;
+    service->NativeUIService_GetWindowRenderSize = LinuxNativeUIServiceGetWindowRenderSizeInterop;
+    service->NativeUIService_ProcessSystemMessages = LinuxNativeUIServiceProcessSystemMessagesInterop;
+}
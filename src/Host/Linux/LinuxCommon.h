@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include <string>
+
+#include <map>
+#include <vector>
+#include <stack>
+#include <assert.h>
+
+#define FAILED(result) ((int)(result) < 0)
+#define AssertIfFailed(result) assert(!FAILED(result))
+#define ARRAYSIZE(array) (sizeof(array) / sizeof(array[0]))
@@ -0,0 +1,23 @@
+#pragma once
+#include "LinuxCommon.h"
+#include "LinuxInputsService.h"
+
+LinuxInputsService::LinuxInputsService()
+{
+    this->inputState = {};
+}
+
+void LinuxInputsService::AssociateWindow(void* windowPointer)
+{
+
+}
+
+InputsState LinuxInputsService::GetInputsState()
+{
+    return this->inputState;
+}
+
+void LinuxInputsService::SendVibrationCommand(uint32_t playerId, float leftTriggerMotor, float rightTriggerMotor, float leftStickMotor, float rightStickMotor, uint32_t duration10ms)
+{
+
+}
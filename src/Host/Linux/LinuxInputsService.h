@@ -0,0 +1,17 @@
+#pragma once
+#include "LinuxCommon.h"
+#include "../Common/CoreEngine.h"
+
+// Headless implementation of the inputs service, all the inputs stay in their default state.
+class LinuxInputsService
+{
+    public:
+        LinuxInputsService();
+
+        void AssociateWindow(void* windowPointer);
+        struct InputsState GetInputsState();
+        void SendVibrationCommand(uint32_t playerId, float leftTriggerMotor, float rightTriggerMotor, float leftStickMotor, float rightStickMotor, uint32_t duration10ms);
+
+    private:
+        InputsState inputState;
+};
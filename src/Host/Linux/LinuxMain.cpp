@@ -0,0 +1,85 @@
+#include "LinuxCommon.h"
+#include "LinuxNativeUIService.h"
+#include "LinuxInputsService.h"
+#include "../Common/VulkanGraphicsService.h"
+#include "../Common/NullGraphicsService.h"
+#include "CoreEngineHost.h"
+
+bool FileExists(const string& filename) 
+{
+    struct stat buffer;   
+    return (stat(filename.c_str(), &buffer) == 0);
+}
+
+int main(int argc, char** argv)
+{
+    string assemblyName = "CoreEngine";
+    uint32_t maxFrameCount = 0;
+    int windowWidth = 0;
+    int windowHeight = 0;
+    bool useVulkan = false;
+
+    if (argc > 1 && FileExists(string(argv[1]) + ".dll"))
+    {
+        assemblyName = argv[1];
+    }
+
+    for (int i = 1; i < argc; i++)
+    {
+        string parameter = argv[i];
+
+        if (parameter == "--frames" && i + 1 < argc)
+        {
+            maxFrameCount = (uint32_t)atoi(argv[++i]);
+        }
+
+        else if (parameter == "--width" && i + 1 < argc)
+        {
+            windowWidth = atoi(argv[++i]);
+        }
+
+        else if (parameter == "--height" && i + 1 < argc)
+        {
+            windowHeight = atoi(argv[++i]);
+        }
+
+        else if (parameter == "--vulkan")
+        {
+            useVulkan = true;
+        }
+    }
+
+    auto nativeUIService = LinuxNativeUIService(maxFrameCount, windowWidth, windowHeight);
+    auto inputsService = LinuxInputsService();
+
+    VulkanGraphicsService* vulkanGraphicsService = nullptr;
+    NullGraphicsService* nullGraphicsService = nullptr;
+
+    if (useVulkan)
+    {
+        vulkanGraphicsService = new VulkanGraphicsService();
+    }
+
+    else
+    {
+        nullGraphicsService = new NullGraphicsService();
+    }
+
+    auto coreEngineHost = CoreEngineHost(assemblyName, &nativeUIService, vulkanGraphicsService, nullGraphicsService, &inputsService);
+    coreEngineHost.StartEngine();
+
+    nativeUIService.PrintFrameStatistics();
+
+    if (nullGraphicsService != nullptr)
+    {
+        nullGraphicsService->PrintStatistics();
+        delete nullGraphicsService;
+    }
+
+    if (vulkanGraphicsService != nullptr)
+    {
+        delete vulkanGraphicsService;
+    }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include "LinuxCommon.h"
+#include "LinuxNativeUIService.h"
+
+double LinuxGetCurrentTimeInMs()
+{
+    timespec currentTime;
+    clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+    return (double)currentTime.tv_sec * 1000.0 + (double)currentTime.tv_nsec / 1000000.0;
+}
+
+LinuxNativeUIService::LinuxNativeUIService(uint32_t maxFrameCount, int windowWidth, int windowHeight)
+{
+    this->maxFrameCount = maxFrameCount;
+    this->windowWidth = windowWidth;
+    this->windowHeight = windowHeight;
+
+    this->frameCount = 0;
+    this->startTime = LinuxGetCurrentTimeInMs();
+    this->startupDuration = 0.0;
+    this->lastFrameTime = 0.0;
+    this->totalFrameDuration = 0.0;
+    this->minFrameDuration = 0.0;
+    this->maxFrameDuration = 0.0;
+}
+
+LinuxNativeUIService::~LinuxNativeUIService()
+{
+    for (uint32_t i = 0; i < this->windows.size(); i++)
+    {
+        delete this->windows[i];
+    }
+}
+
+void* LinuxNativeUIService::CreateWindow(char* title, int width, int height, enum NativeWindowState windowState)
+{
+    auto window = new LinuxHeadlessWindow();
+    window->Title = title;
+
+    if (windowState == NativeWindowState::Maximized)
+    {
+        width = LinuxHeadlessScreenWidth;
+        height = LinuxHeadlessScreenHeight;
+    }
+
+    window->Width = (this->windowWidth > 0) ? this->windowWidth : width;
+    window->Height = (this->windowHeight > 0) ? this->windowHeight : height;
+
+    this->windows.push_back(window);
+    return window;
+}
+
+void LinuxNativeUIService::SetWindowTitle(void* windowPointer, char* title)
+{
+    auto window = (LinuxHeadlessWindow*)windowPointer;
+    window->Title = title;
+}
+
+Vector2 LinuxNativeUIService::GetWindowRenderSize(void* windowPointer)
+{
+    auto window = (LinuxHeadlessWindow*)windowPointer;
+
+    Vector2 result = {};
+    result.X = (float)window->Width;
+    result.Y = (float)window->Height;
+
+    return result;
+}
+
+NativeAppStatus LinuxNativeUIService::ProcessSystemMessages()
+{
+    auto currentTime = LinuxGetCurrentTimeInMs();
+
+    if (this->frameCount == 0)
+    {
+        this->startupDuration = currentTime - this->startTime;
+    }
+
+    else
+    {
+        auto frameDuration = currentTime - this->lastFrameTime;
+        this->totalFrameDuration += frameDuration;
+
+        if (this->frameCount == 1 || frameDuration < this->minFrameDuration)
+        {
+            this->minFrameDuration = frameDuration;
+        }
+
+        if (frameDuration > this->maxFrameDuration)
+        {
+            this->maxFrameDuration = frameDuration;
+        }
+    }
+
+    this->lastFrameTime = currentTime;
+    this->frameCount++;
+
+    NativeAppStatus status = {};
+    status.IsActive = 1;
+    status.IsRunning = (this->maxFrameCount == 0 || this->frameCount <= this->maxFrameCount) ? 1 : 0;
+
+    return status;
+}
+
+void LinuxNativeUIService::PrintFrameStatistics()
+{
+    printf("Startup: %.2f ms\n", this->startupDuration);
+
+    if (this->frameCount > 1)
+    {
+        auto measuredFrameCount = this->frameCount - 1;
+        printf("Frames: %u, Average: %.3f ms, Min: %.3f ms, Max: %.3f ms\n", measuredFrameCount, this->totalFrameDuration / measuredFrameCount, this->minFrameDuration, this->maxFrameDuration);
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "LinuxCommon.h"
+#include "../Common/CoreEngine.h"
+
+using namespace std;
+
+// Size of the virtual screen used by maximized windows when no size is given on the command line
+static const int LinuxHeadlessScreenWidth = 1920;
+static const int LinuxHeadlessScreenHeight = 1080;
+
+struct LinuxHeadlessWindow
+{
+    string Title;
+    int Width;
+    int Height;
+};
+
+// Headless implementation of the native UI service. No display server is needed: windows are plain
+// memory objects and the message loop is used to count and time the frames rendered by the engine.
+class LinuxNativeUIService
+{
+    public:
+        LinuxNativeUIService(uint32_t maxFrameCount, int windowWidth, int windowHeight);
+        ~LinuxNativeUIService();
+
+        void* CreateWindow(char* title, int width, int height, enum NativeWindowState windowState);
+        void SetWindowTitle(void* windowPointer, char* title);
+        struct Vector2 GetWindowRenderSize(void* windowPointer);
+        struct NativeAppStatus ProcessSystemMessages();
+
+        void PrintFrameStatistics();
+
+    private:
+        vector<LinuxHeadlessWindow*> windows;
+        uint32_t maxFrameCount;
+        int windowWidth;
+        int windowHeight;
+
+        uint32_t frameCount;
+        double startTime;
+        double startupDuration;
+        double lastFrameTime;
+        double totalFrameDuration;
+        double minFrameDuration;
+        double maxFrameDuration;
+};
+
+double LinuxGetCurrentTimeInMs();
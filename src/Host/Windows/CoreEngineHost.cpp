@@ -3,12 +3,13 @@
 #include "CoreEngineHost.h"
 #include "HostServices/WindowsNativeUIServiceInterop.h"
 #include "HostServices/Direct3D12GraphicsServiceInterop.h"
-#include "HostServices/VulkanGraphicsServiceInterop.h"
+#include "../Common/HostServices/VulkanGraphicsServiceInterop.h"
+#include "../Common/HostServices/NullGraphicsServiceInterop.h"
 #include "HostServices/WindowsInputsServiceInterop.h"
 
 using namespace std;
 
-CoreEngineHost::CoreEngineHost(const wstring assemblyName, const WindowsNativeUIService* nativeUIService, const Direct3D12GraphicsService* direct3d12GraphicsService, const VulkanGraphicsService* vulkanGraphicsService, const WindowsInputsService* inputsService) : nativeUIService(nativeUIService), direct3dGraphicsService(direct3d12GraphicsService), vulkanGraphicsService(vulkanGraphicsService), inputsService(inputsService)
+CoreEngineHost::CoreEngineHost(const wstring assemblyName, const WindowsNativeUIService* nativeUIService, const Direct3D12GraphicsService* direct3d12GraphicsService, const VulkanGraphicsService* vulkanGraphicsService, const NullGraphicsService* nullGraphicsService, const WindowsInputsService* inputsService) : nativeUIService(nativeUIService), direct3dGraphicsService(direct3d12GraphicsService), vulkanGraphicsService(vulkanGraphicsService), nullGraphicsService(nullGraphicsService), inputsService(inputsService)
 {
     NativeHost_LoadEngine(&this->startEnginePointer, assemblyName, false);
 }
@@ -24,11 +25,16 @@ void CoreEngineHost::StartEngine()
         InitDirect3D12GraphicsService(this->direct3dGraphicsService, &hostPlatform.GraphicsService);
     }
 
-    else
+    else if (this->vulkanGraphicsService != nullptr)
     {
         InitVulkanGraphicsService(this->vulkanGraphicsService, &hostPlatform.GraphicsService);
     }
 
+    else
+    {
+        InitNullGraphicsService(this->nullGraphicsService, &hostPlatform.GraphicsService);
+    }
+
     InitWindowsInputsService(this->inputsService, &hostPlatform.InputsService);
 
     // TODO: Delete temp memory
@@ -2,7 +2,8 @@
 #include "WindowsCommon.h"
 #include "WindowsNativeUIService.h"
 #include "Direct3D12GraphicsService.h"
-#include "VulkanGraphicsService.h"
+#include "../Common/VulkanGraphicsService.h"
+#include "../Common/NullGraphicsService.h"
 #include "WindowsInputsService.h"
 #include "../Common/CoreEngine.h"
 #include "../Common/NativeHost.cpp"
@@ -12,7 +13,7 @@ using namespace std;
 class CoreEngineHost
 {
 public:
-    CoreEngineHost(const wstring assemblyName, const WindowsNativeUIService* nativeUIService, const Direct3D12GraphicsService* direct3d12GraphicsService, const VulkanGraphicsService* vulkanGraphicsService, const WindowsInputsService* inputsService);
+    CoreEngineHost(const wstring assemblyName, const WindowsNativeUIService* nativeUIService, const Direct3D12GraphicsService* direct3d12GraphicsService, const VulkanGraphicsService* vulkanGraphicsService, const NullGraphicsService* nullGraphicsService, const WindowsInputsService* inputsService);
 
     void StartEngine();
 
@@ -20,6 +21,7 @@ private:
     const WindowsNativeUIService* nativeUIService;
     const Direct3D12GraphicsService* direct3dGraphicsService;
     const VulkanGraphicsService* vulkanGraphicsService;
+    const NullGraphicsService* nullGraphicsService;
     const WindowsInputsService* inputsService;
 
     StartEnginePtr startEnginePointer;    
@@ -34,10 +34,11 @@ Direct3D12GraphicsService::Direct3D12GraphicsService()
 	// this->window = window;
 	AssertIfFailed(CreateDXGIFactory2(createFactoryFlags, IID_PPV_ARGS(this->dxgiFactory.ReleaseAndGetAddressOf())));
 
-	auto graphicsAdapter = FindGraphicsAdapter(dxgiFactory);
-	AssertIfFailed(CreateDevice(dxgiFactory, graphicsAdapter));
+	this->graphicsAdapter = FindGraphicsAdapter(dxgiFactory);
+	AssertIfFailed(CreateDevice(dxgiFactory, this->graphicsAdapter));
 	//AssertIfFailed(CreateOrResizeSwapChain(width, height));
 	AssertIfFailed(CreateHeaps());
+	CreateGpuZoneQueryHeaps();
 
 #ifdef DEBUG
 	EnableDebugLayer();
@@ -46,6 +47,8 @@ Direct3D12GraphicsService::Direct3D12GraphicsService()
 
 Direct3D12GraphicsService::~Direct3D12GraphicsService()
 {
+	this->pipelineCompilerThreadPool.Stop();
+
 	// Ensure that the GPU is no longer referencing resources that are about to be
 	// cleaned up by the destructor.
 	CloseHandle(this->globalFenceEvent);
@@ -60,6 +63,16 @@ void Direct3D12GraphicsService::GetGraphicsAdapterName(char* output)
     this->adapterName.copy((wchar_t*)output, this->adapterName.length());
 }
 
+int Direct3D12GraphicsService::SetFramesInFlightCount(int framesInFlightCount)
+{
+	// NOTE: This must be called before the swap chain is created
+	this->framesInFlightCount = framesInFlightCount < 1 ? 1 : (framesInFlightCount > MaxFramesInFlightCount ? MaxFramesInFlightCount : framesInFlightCount);
+	this->currentAllocatorIndex = 0;
+	this->gpuZoneProfiler.SetFramesInFlightCount(this->framesInFlightCount);
+
+	return this->framesInFlightCount;
+}
+
 GraphicsAllocationInfos Direct3D12GraphicsService::GetBufferAllocationInfos(int sizeInBytes)
 {
 	GraphicsAllocationInfos result = {};
@@ -81,6 +94,24 @@ GraphicsAllocationInfos Direct3D12GraphicsService::GetTextureAllocationInfos(enu
 	return result;
 }
 
+GraphicsMemoryBudget Direct3D12GraphicsService::GetMemoryBudget(enum GraphicsServiceHeapType heapType)
+{
+	DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo = {};
+	AssertIfFailed(this->graphicsAdapter->QueryVideoMemoryInfo(0, heapType == GraphicsServiceHeapType::Gpu ? DXGI_MEMORY_SEGMENT_GROUP_LOCAL : DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL, &memoryInfo));
+
+	// UMA adapters only have a local segment
+	if (memoryInfo.Budget == 0)
+	{
+		AssertIfFailed(this->graphicsAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memoryInfo));
+	}
+
+	GraphicsMemoryBudget result = {};
+	result.BudgetInBytes = memoryInfo.Budget;
+	result.UsageInBytes = memoryInfo.CurrentUsage;
+
+	return result;
+}
+
 void* Direct3D12GraphicsService::CreateCommandQueue(enum GraphicsServiceCommandType commandQueueType)
 {
 	D3D12_COMMAND_QUEUE_DESC commandQueueDesc = {};
@@ -103,11 +134,12 @@ void* Direct3D12GraphicsService::CreateCommandQueue(enum GraphicsServiceCommandT
 	ComPtr<ID3D12Fence1> commandQueueFence;
 	AssertIfFailed(this->graphicsDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(commandQueueFence.ReleaseAndGetAddressOf())));
 
-	auto commandAllocators = new ComPtr<ID3D12CommandAllocator>[CommandAllocatorsCount];
+	auto commandAllocators = new ComPtr<ID3D12CommandAllocator>[MaxFramesInFlightCount];
 
-	// Init command allocators for each frame in flight
+	// Init command allocators for each frame in flight, the max count is allocated so that the
+	// frames in flight count doesn't depend on the creation order of the queues
 	// TODO: For multi threading support we need to allocate on allocator per frame per thread
-	for (int i = 0; i < CommandAllocatorsCount; i++)
+	for (int i = 0; i < MaxFramesInFlightCount; i++)
 	{
 		ComPtr<ID3D12CommandAllocator> commandAllocator;
 		AssertIfFailed(this->graphicsDevice->CreateCommandAllocator(commandQueueDesc.Type, IID_PPV_ARGS(commandAllocator.ReleaseAndGetAddressOf())));
@@ -131,7 +163,7 @@ void Direct3D12GraphicsService::SetCommandQueueLabel(void* commandQueuePointer,
 	commandQueue->CommandQueueObject->SetName(wstring(label, label + strlen(label)).c_str());
 	commandQueue->Fence->SetName((wstring(label, label + strlen(label)) + L"Fence").c_str());
 
-	for (int i = 0; i < CommandAllocatorsCount; i++)
+	for (int i = 0; i < MaxFramesInFlightCount; i++)
 	{
 		wchar_t buffer[64] = {};
   		swprintf(buffer, (wstring(label, label + strlen(label)) + L"Allocator%d").c_str(), i);
@@ -145,7 +177,7 @@ void Direct3D12GraphicsService::DeleteCommandQueue(void* commandQueuePointer)
 
 	if (commandQueue != nullptr && commandQueue->CommandAllocators != nullptr)
 	{
-		for (int i = 0; i < CommandAllocatorsCount; i++)
+		for (int i = 0; i < MaxFramesInFlightCount; i++)
 		{
 			commandQueue->CommandAllocators[i]->Release();
 		}
@@ -172,6 +204,21 @@ unsigned long Direct3D12GraphicsService::GetCommandQueueTimestampFrequency(void*
 	return timestampFrequency;
 }
 
+struct GraphicsTimestampCalibration Direct3D12GraphicsService::GetCommandQueueTimestampCalibration(void* commandQueuePointer)
+{
+	Direct3D12CommandQueue* commandQueue = (Direct3D12CommandQueue*)commandQueuePointer;
+
+	GraphicsTimestampCalibration result = {};
+
+	// The CPU clock returned by the queue is QueryPerformanceCounter, the call duration bounds the error
+	auto startTimestamp = GetHostTimestamp();
+	AssertIfFailed(commandQueue->CommandQueueObject->GetClockCalibration((uint64_t*)&result.GpuTimestamp, (uint64_t*)&result.CpuTimestamp));
+	auto endTimestamp = GetHostTimestamp();
+
+	result.MaxDeviation = (endTimestamp - startTimestamp) * 1000000000 / GetHostTimestampFrequency();
+	return result;
+}
+
 unsigned long Direct3D12GraphicsService::ExecuteCommandLists(void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength)
 {
 	Direct3D12CommandQueue* commandQueue = (Direct3D12CommandQueue*)commandQueuePointer;
@@ -201,6 +248,31 @@ unsigned long Direct3D12GraphicsService::ExecuteCommandLists(void* commandQueueP
 	return fenceValue;
 }
 
+void Direct3D12GraphicsService::ExecuteCommandListBatches(struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength)
+{
+	// D3D12 has no batched submit so the batches are executed in order on their queues
+	assert(fencesLength >= batchesLength);
+
+	for (int i = 0; i < batchesLength; i++)
+	{
+		auto batch = batches[i];
+		Direct3D12CommandQueue* commandQueue = (Direct3D12CommandQueue*)batch.CommandQueuePointer;
+
+		if (batch.BatchIndexToWait >= 0)
+		{
+			assert(batch.BatchIndexToWait < i);
+
+			auto fenceToWait = fences[batch.BatchIndexToWait];
+			Direct3D12CommandQueue* commandQueueToWait = (Direct3D12CommandQueue*)fenceToWait.CommandQueuePointer;
+
+			AssertIfFailed(commandQueue->CommandQueueObject->Wait(commandQueueToWait->Fence.Get(), fenceToWait.Value));
+		}
+
+		fences[i].CommandQueuePointer = commandQueue;
+		fences[i].Value = ExecuteCommandLists(commandQueue, batch.CommandLists, batch.CommandListsLength, batch.FencesToWait, batch.FencesToWaitLength);
+	}
+}
+
 void Direct3D12GraphicsService::WaitForCommandQueueOnCpu(struct GraphicsFence fenceToWait)
 {
 	Direct3D12CommandQueue* commandQueueToWait = (Direct3D12CommandQueue*)fenceToWait.CommandQueuePointer;
@@ -248,6 +320,8 @@ void Direct3D12GraphicsService::ResetCommandList(void* commandListPointer)
 	auto commandAllocator = commandList->CommandQueue->CommandAllocators[this->currentAllocatorIndex];
 
 	commandList->CommandListObject->Reset(commandAllocator.Get(), nullptr);
+	commandList->GpuZones.Depth = 0;
+	commandList->EndedGpuZones.clear();
 }
 
 void Direct3D12GraphicsService::CommitCommandList(void* commandListPointer)
@@ -255,6 +329,14 @@ void Direct3D12GraphicsService::CommitCommandList(void* commandListPointer)
 	this->shaderBound = false;
 
 	Direct3D12CommandList* commandList = (Direct3D12CommandList*)commandListPointer;
+
+	for (auto zoneIndex : commandList->EndedGpuZones)
+	{
+		auto startQueryIndex = this->gpuZoneProfiler.GetStartQueryIndex(zoneIndex);
+		commandList->CommandListObject->ResolveQueryData(GetGpuZoneQueryHeap(commandList), D3D12_QUERY_TYPE_TIMESTAMP, startQueryIndex, 2, this->gpuZoneReadBackBuffer.Get(), startQueryIndex * sizeof(uint64_t));
+	}
+
+	commandList->EndedGpuZones.clear();
 	AssertIfFailed(commandList->CommandListObject->Close());
 }
 
@@ -262,7 +344,8 @@ void* Direct3D12GraphicsService::CreateGraphicsHeap(enum GraphicsServiceHeapType
 {
 	D3D12_HEAP_DESC heapDescriptor = {};
 
-	if (type == GraphicsServiceHeapType::Upload)
+	// GPU upload heaps need a newer Agility SDK so the GPU upload type uses an upload heap for now
+	if (type == GraphicsServiceHeapType::Upload || type == GraphicsServiceHeapType::GpuUpload)
 	{
 		heapDescriptor.Properties.Type = D3D12_HEAP_TYPE_UPLOAD;
 		heapDescriptor.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
@@ -310,22 +393,42 @@ void Direct3D12GraphicsService::DeleteGraphicsHeap(void* graphicsHeapPointer)
 
 void* Direct3D12GraphicsService::CreateShaderResourceHeap(unsigned long length)
 {
-	D3D12_DESCRIPTOR_HEAP_DESC descriptorHeapDesc = {};
-	descriptorHeapDesc.NumDescriptors = length;
-	descriptorHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-	descriptorHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-
-	ComPtr<ID3D12DescriptorHeap> descriptorHeap;
-	AssertIfFailed(this->graphicsDevice->CreateDescriptorHeap(&descriptorHeapDesc, IID_PPV_ARGS(descriptorHeap.ReleaseAndGetAddressOf())));
-	auto handleSize = this->graphicsDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
 	Direct3D12ShaderResourceHeap* descriptorHeapStruct = new Direct3D12ShaderResourceHeap();
-	descriptorHeapStruct->HeapObject = descriptorHeap;
-	descriptorHeapStruct->HandleSize = handleSize;
+	descriptorHeapStruct->HandleSize = this->graphicsDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
+	CreateShaderResourceHeapObject(descriptorHeapStruct, length < MaxShaderResourceHeapLength ? (uint32_t)length : MaxShaderResourceHeapLength);
 	return descriptorHeapStruct;
 }
 
+unsigned long Direct3D12GraphicsService::GetShaderResourceHeapLength(void* shaderResourceHeapPointer)
+{
+	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
+	return descriptorHeap->Length;
+}
+
+void Direct3D12GraphicsService::ResizeShaderResourceHeap(void* shaderResourceHeapPointer, unsigned long length)
+{
+	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
+	auto heapLength = length < MaxShaderResourceHeapLength ? (uint32_t)length : MaxShaderResourceHeapLength;
+
+	if (heapLength <= descriptorHeap->Length)
+	{
+		return;
+	}
+
+	descriptorHeap->RetiredHeapObjects.push_back(descriptorHeap->HeapObject);
+	CreateShaderResourceHeapObject(descriptorHeap, heapLength);
+
+	// The descriptors are written again from the shadow copy, copying from a shader visible heap is slow
+	for (uint32_t i = 0; i < descriptorHeap->Descriptors.size(); i++)
+	{
+		if (descriptorHeap->Descriptors[i].ResourcePointer != nullptr)
+		{
+			WriteShaderResourceDescriptor(descriptorHeap, i);
+		}
+	}
+}
+
 void Direct3D12GraphicsService::SetShaderResourceHeapLabel(void* shaderResourceHeapPointer, char* label)
 {
 	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
@@ -341,91 +444,50 @@ void Direct3D12GraphicsService::DeleteShaderResourceHeap(void* shaderResourceHea
 void Direct3D12GraphicsService::CreateShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel)
 {
 	// TODO: Create also RTV and DSV when appropriate so that we can remove the other global heaps
-
-	// TODO: To remove when SM6.6 is stable
-	int textureOffset = 2500;
-	int uavOffset = 5000;
-	int uavTextureOffset = 7500;
-
 	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
-	Direct3D12Texture* texture = (Direct3D12Texture*)texturePointer;
-
-	if (isWriteable == 0)
-	{
-		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-		srvDesc.Format = ConvertSRVTextureFormat(texture->ResourceDesc.Format);
-		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-		srvDesc.Texture2D.MostDetailedMip = mipLevel;
-		srvDesc.Texture2D.MipLevels = mipLevel == 0 ? texture->ResourceDesc.MipLevels : 1;
-
-		auto descriptorHandle = descriptorHeap->HeapObject->GetCPUDescriptorHandleForHeapStart();
-		descriptorHandle.ptr += (textureOffset + index) * descriptorHeap->HandleSize;
+	assert(index < descriptorHeap->Length);
 
-		this->graphicsDevice->CreateShaderResourceView(texture->TextureObject.Get(), &srvDesc, descriptorHandle);
-	}
-
-	else
-	{
-		D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
-		uavDesc.Format = ConvertSRVTextureFormat(texture->ResourceDesc.Format);
-		uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
-		uavDesc.Texture2D.MipSlice = mipLevel;
-
-		auto descriptorHandle = descriptorHeap->HeapObject->GetCPUDescriptorHandleForHeapStart();
-		descriptorHandle.ptr += (uavTextureOffset + index) * descriptorHeap->HandleSize;
-
-		this->graphicsDevice->CreateUnorderedAccessView(texture->TextureObject.Get(), nullptr, &uavDesc, descriptorHandle);
-	}
+	descriptorHeap->Descriptors[index] = { texturePointer, true, isWriteable != 0, mipLevel };
+	WriteShaderResourceDescriptor(descriptorHeap, index);
 }
 
 void Direct3D12GraphicsService::DeleteShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index)
 {
-	// TODO
+	// The stale descriptor is left in the heap, it is not accessed by the shaders until the slot is reused
+	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
+	descriptorHeap->Descriptors[index] = {};
 }
 
 void Direct3D12GraphicsService::CreateShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable)
 {
 	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
-	Direct3D12GraphicsBuffer* graphicsBuffer = (Direct3D12GraphicsBuffer*)bufferPointer;
+	assert(index < descriptorHeap->Length);
 
-	if (!isWriteable)
-	{
-		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
-		srvDesc.Format = DXGI_FORMAT_R32_TYPELESS;
-		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-		srvDesc.Buffer.NumElements = (UINT)graphicsBuffer->ResourceDesc.Width / 4;
-		srvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_RAW;
+	descriptorHeap->Descriptors[index] = { bufferPointer, false, isWriteable != 0, 0 };
+	WriteShaderResourceDescriptor(descriptorHeap, index);
+}
 
-		auto descriptorHandle = descriptorHeap->HeapObject->GetCPUDescriptorHandleForHeapStart();
-		descriptorHandle.ptr += index * descriptorHeap->HandleSize;
+void Direct3D12GraphicsService::DeleteShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index)
+{
+	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
+	descriptorHeap->Descriptors[index] = {};
+}
 
-		this->graphicsDevice->CreateShaderResourceView(graphicsBuffer->BufferObject.Get(), &srvDesc, descriptorHandle);
-	}
+void Direct3D12GraphicsService::CreateShaderResources(void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength)
+{
+	// D3D12 has no batched view creation, the views are still written in one call from the engine
+	Direct3D12ShaderResourceHeap* descriptorHeap = (Direct3D12ShaderResourceHeap*)shaderResourceHeapPointer;
 
-	else
+	for (int i = 0; i < writesLength; i++)
 	{
-		D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
-		uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
-		uavDesc.Format = DXGI_FORMAT_R32_TYPELESS;
-		uavDesc.Buffer.NumElements = (UINT)graphicsBuffer->ResourceDesc.Width / 4;
-		uavDesc.Buffer.Flags = D3D12_BUFFER_UAV_FLAG_RAW;
+		auto& write = writes[i];
+		assert(write.Index < descriptorHeap->Length);
 
-		int bufferOffset = 5000;
-		
-		auto descriptorHandle = descriptorHeap->HeapObject->GetCPUDescriptorHandleForHeapStart();
-		descriptorHandle.ptr += (bufferOffset + index) * descriptorHeap->HandleSize;
-
-		this->graphicsDevice->CreateUnorderedAccessView(graphicsBuffer->BufferObject.Get(), nullptr, &uavDesc, descriptorHandle);
+		descriptorHeap->Descriptors[write.Index] = { write.ResourcePointer, write.IsTexture != 0, write.IsWriteable != 0, write.MipLevel };
+		WriteShaderResourceDescriptor(descriptorHeap, write.Index);
 	}
 }
 
-void Direct3D12GraphicsService::DeleteShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index)
-{
-	// TODO
-}
-
 void* Direct3D12GraphicsService::CreateGraphicsBuffer(void* graphicsHeapPointer, unsigned long heapOffset, GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes)
 { 
 	Direct3D12GraphicsHeap* graphicsHeap = (Direct3D12GraphicsHeap*)graphicsHeapPointer;
@@ -449,7 +511,7 @@ void* Direct3D12GraphicsService::CreateGraphicsBuffer(void* graphicsHeapPointer,
 
 	auto resourceState = D3D12_RESOURCE_STATE_COPY_DEST;
 
-	if (graphicsHeap->Type == GraphicsServiceHeapType::Upload)
+	if (graphicsHeap->Type == GraphicsServiceHeapType::Upload || graphicsHeap->Type == GraphicsServiceHeapType::GpuUpload)
 	{
 		resourceState = D3D12_RESOURCE_STATE_GENERIC_READ;
 	}
@@ -593,12 +655,16 @@ void Direct3D12GraphicsService::DeleteTexture(void* texturePointer)
 	}
 }
 
-void* Direct3D12GraphicsService::CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat)
+void* Direct3D12GraphicsService::CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount)
 {
 	Direct3D12CommandQueue* commandQueue = (Direct3D12CommandQueue*)commandQueuePointer;
 
+	// 0 lets the backend choose, one back buffer per frame in flight with a minimum of 2
+	backBufferCount = backBufferCount > 0 ? backBufferCount : this->framesInFlightCount;
+	backBufferCount = backBufferCount < 2 ? 2 : (backBufferCount > MaxBackBufferCount ? MaxBackBufferCount : backBufferCount);
+
 	DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
-	swapChainDesc.BufferCount = RenderBuffersCount;
+	swapChainDesc.BufferCount = backBufferCount;
 	swapChainDesc.Width = width;
 	swapChainDesc.Height = height;
 	swapChainDesc.Format = ConvertTextureFormat(textureFormat, true);
@@ -609,23 +675,47 @@ void* Direct3D12GraphicsService::CreateSwapChain(void* windowPointer, void* comm
 	swapChainDesc.SampleDesc = { 1, 0 };
 	swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
 
+	// Mailbox is emulated by presenting without sync interval, the flip model drops the queued frames.
+	// Immediate needs tearing support otherwise it falls back to mailbox.
+	if (presentMode == GraphicsPresentMode::Immediate)
+	{
+		ComPtr<IDXGIFactory5> dxgiFactory5;
+		BOOL isTearingSupported = false;
+
+		if (FAILED(this->dxgiFactory.As(&dxgiFactory5)) || FAILED(dxgiFactory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &isTearingSupported, sizeof(isTearingSupported))) || !isTearingSupported)
+		{
+			presentMode = GraphicsPresentMode::Mailbox;
+		}
+
+		else
+		{
+			swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+		}
+	}
+
 	DXGI_SWAP_CHAIN_FULLSCREEN_DESC swapChainFullScreenDesc = {};
 	swapChainFullScreenDesc.Windowed = true;
 	
 	ComPtr<IDXGISwapChain3> swapChain;
 	AssertIfFailed(dxgiFactory->CreateSwapChainForHwnd(commandQueue->CommandQueueObject.Get(), (HWND)windowPointer, &swapChainDesc, &swapChainFullScreenDesc, nullptr, (IDXGISwapChain1**)swapChain.ReleaseAndGetAddressOf()));
-	swapChain->SetMaximumFrameLatency(1);
+
+	// The frame being recorded is not counted in the latency so the CPU can run one frame
+	// ahead of the queued presents
+	swapChain->SetMaximumFrameLatency(this->framesInFlightCount > 1 ? this->framesInFlightCount - 1 : 1);
 
 	Direct3D12SwapChain* swapChainStructure = new Direct3D12SwapChain();
 	swapChainStructure->SwapChainObject = swapChain;
 	swapChainStructure->CommandQueue = commandQueue;
 	swapChainStructure->WaitHandle = swapChain->GetFrameLatencyWaitableObject();
+	swapChainStructure->BackBufferCount = backBufferCount;
+	swapChainStructure->PresentMode = presentMode;
+	swapChainStructure->Flags = swapChainDesc.Flags;
 
 	D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
 	rtvDesc.Format = ConvertTextureFormat(textureFormat);
 	rtvDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
 
-	for (int i = 0; i < RenderBuffersCount; i++)
+	for (int i = 0; i < backBufferCount; i++)
 	{
 		ComPtr<ID3D12Resource> backBuffer;
 		AssertIfFailed(swapChain->GetBuffer(i, IID_PPV_ARGS(backBuffer.ReleaseAndGetAddressOf())));
@@ -657,7 +747,7 @@ void Direct3D12GraphicsService::DeleteSwapChain(void* swapChainPointer)
 {
 	Direct3D12SwapChain* swapChain = (Direct3D12SwapChain*)swapChainPointer;
 
-	for (int i = 0; i < RenderBuffersCount; i++)
+	for (int i = 0; i < swapChain->BackBufferCount; i++)
 	{
 		DeleteTexture(swapChain->BackBufferTextures[i]);
 	}
@@ -677,7 +767,7 @@ void Direct3D12GraphicsService::ResizeSwapChain(void* swapChainPointer, int widt
 	
 	D3D12_RESOURCE_DESC backBufferDesc;
 
-	for (int i = 0; i < RenderBuffersCount; i++)
+	for (int i = 0; i < swapChain->BackBufferCount; i++)
 	{
 		backBufferDesc = swapChain->BackBufferTextures[i]->ResourceDesc;
 		delete swapChain->BackBufferTextures[i];
@@ -686,13 +776,13 @@ void Direct3D12GraphicsService::ResizeSwapChain(void* swapChainPointer, int widt
 	backBufferDesc.Width = width;
 	backBufferDesc.Height = height;
 
-	AssertIfFailed(swapChain->SwapChainObject->ResizeBuffers(RenderBuffersCount, width, height, DXGI_FORMAT_UNKNOWN, DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT));
+	AssertIfFailed(swapChain->SwapChainObject->ResizeBuffers(swapChain->BackBufferCount, width, height, DXGI_FORMAT_UNKNOWN, swapChain->Flags));
 
 	D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
 	rtvDesc.Format = backBufferDesc.Format;
 	rtvDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
 
-	for (int i = 0; i < RenderBuffersCount; i++)
+	for (int i = 0; i < swapChain->BackBufferCount; i++)
 	{
 		DeleteTexture(swapChain->BackBufferTextures[i]);
 
@@ -729,15 +819,27 @@ void* Direct3D12GraphicsService::GetSwapChainBackBufferTexture(void* swapChainPo
 unsigned long Direct3D12GraphicsService::PresentSwapChain(void* swapChainPointer)
 {
 	Direct3D12SwapChain* swapChain = (Direct3D12SwapChain*)swapChainPointer;
-	AssertIfFailed(swapChain->SwapChainObject->Present(1, 0));
+
+	if (swapChain->PresentMode == GraphicsPresentMode::Immediate)
+	{
+		AssertIfFailed(swapChain->SwapChainObject->Present(0, DXGI_PRESENT_ALLOW_TEARING));
+	}
+
+	else
+	{
+		AssertIfFailed(swapChain->SwapChainObject->Present(swapChain->PresentMode == GraphicsPresentMode::Fifo ? 1 : 0, 0));
+	}
 
 	// TODO: Switch to an atomic increment here for multi threading
 	auto fenceValue = swapChain->CommandQueue->FenceValue;
 	swapChain->CommandQueue->CommandQueueObject->Signal(swapChain->CommandQueue->Fence.Get(), fenceValue);
 	swapChain->CommandQueue->FenceValue = fenceValue + 1;
 
+	swapChain->FrameFenceValues[swapChain->CurrentFrameIndex] = fenceValue;
+	swapChain->CurrentFrameIndex = (swapChain->CurrentFrameIndex + 1) % this->framesInFlightCount;
+
 	// TODO: Do something better here
-	this->currentAllocatorIndex = (this->currentAllocatorIndex + 1) % FramesCount;
+	this->currentAllocatorIndex = (this->currentAllocatorIndex + 1) % this->framesInFlightCount;
 
 	return fenceValue;
 }
@@ -750,6 +852,14 @@ void Direct3D12GraphicsService::WaitForSwapChainOnCpu(void* swapChainPointer)
 	{
 		assert("Wait for SwapChain timeout");
 	}
+
+	// The command allocators of the new frame are reset without waiting so the frame that
+	// used them must be completed
+	GraphicsFence fenceToWait = {};
+	fenceToWait.CommandQueuePointer = swapChain->CommandQueue;
+	fenceToWait.Value = swapChain->FrameFenceValues[swapChain->CurrentFrameIndex];
+
+	this->WaitForCommandQueueOnCpu(fenceToWait);
 }
 
 void* Direct3D12GraphicsService::CreateQueryBuffer(enum GraphicsQueryBufferType queryBufferType, int length)
@@ -829,54 +939,53 @@ void* Direct3D12GraphicsService::CreateShader(char* computeShaderFunction, void*
 		auto entryPointNameLength = (*(int*)currentDataPtr);
 		currentDataPtr += sizeof(int);
 
-		auto entryPointNameTemp = new char[entryPointNameLength + 1];
-		entryPointNameTemp[entryPointNameLength] = '\0';
-
-		memcpy(entryPointNameTemp, (char*)currentDataPtr, entryPointNameLength);
-		auto entryPointName = string(entryPointNameTemp);
+		auto shaderStage = GetShaderStage((char*)currentDataPtr, entryPointNameLength);
 		currentDataPtr += entryPointNameLength;
 
 		auto shaderByteCodeLength = (*(int*)currentDataPtr);
 		currentDataPtr += sizeof(int);
 
-		auto shaderBlob = CreateShaderBlob(currentDataPtr, shaderByteCodeLength);
-		currentDataPtr += shaderByteCodeLength;
-
-		if (entryPointName == "AmplificationMain")
+		if (shaderStage != ShaderStageUnknown)
 		{
-			shader->AmplificationShaderMethod = shaderBlob;
+			SetShaderBlob(shader, shaderStage, currentDataPtr, shaderByteCodeLength, ComputeShaderContentHash(currentDataPtr, shaderByteCodeLength));
 		}
 
-		else if (entryPointName == "MeshMain")
-		{
-			shader->MeshShaderMethod = shaderBlob;
-		}
+		currentDataPtr += shaderByteCodeLength;
+	}
 
-		else if (entryPointName == "PixelMain")
-		{
-			shader->PixelShaderMethod = shaderBlob;
-		}
+	CreateShaderCommandSignature(shader, parameterCount);
 
-		else if (entryPointName == "ComputeMain")
-		{
-			shader->ComputeShaderMethod = shaderBlob;
-		}
+    return shader;
+}
+
+void* Direct3D12GraphicsService::CreateShaderFromArchive(void* shaderArchivePointer, char* shaderName)
+{
+	ShaderArchive* shaderArchive = (ShaderArchive*)shaderArchivePointer;
+	auto archiveShader = FindShaderArchiveShader(shaderArchive, shaderName);
+
+	if (archiveShader == nullptr)
+	{
+		return nullptr;
 	}
 
-	D3D12_INDIRECT_ARGUMENT_DESC arguments[2] = {};
-	arguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
-	arguments[0].Constant.RootParameterIndex = 0;
-	arguments[0].Constant.Num32BitValuesToSet = parameterCount;
-	arguments[1].Type = (shader->ComputeShaderMethod == nullptr) ? D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH : D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH;
+	Direct3D12Shader* shader = new Direct3D12Shader();
 
-	D3D12_COMMAND_SIGNATURE_DESC commandSignatureDesc = {};
-	commandSignatureDesc.pArgumentDescs = arguments;
-	commandSignatureDesc.NumArgumentDescs = ARRAYSIZE(arguments);
-	commandSignatureDesc.ByteStride = (3 + parameterCount) * sizeof(uint32_t);
+	// The root signature is created directly from the mapped pages
+	AssertIfFailed(this->graphicsDevice->CreateRootSignature(0, shaderArchive->Data + archiveShader->RootSignatureOffset, archiveShader->RootSignatureLength, IID_PPV_ARGS(shader->RootSignature.ReleaseAndGetAddressOf())));
 
-	AssertIfFailed(this->graphicsDevice->CreateCommandSignature(&commandSignatureDesc, shader->RootSignature.Get(), IID_PPV_ARGS(shader->CommandSignature.ReleaseAndGetAddressOf())));
+	for (uint32_t i = 0; i < archiveShader->EntryPointCount; i++)
+	{
+		auto& entryPoint = shaderArchive->EntryPoints[archiveShader->FirstEntryPoint + i];
 
-    return shader;
+		if (entryPoint.Stage < ShaderStageCount && entryPoint.DxilLength > 0)
+		{
+			SetShaderBlob(shader, entryPoint.Stage, shaderArchive->Data + entryPoint.DxilOffset, entryPoint.DxilLength, entryPoint.DxilHash);
+		}
+	}
+
+	CreateShaderCommandSignature(shader, archiveShader->ParameterCount);
+
+	return shader;
 }
 
 void Direct3D12GraphicsService::SetShaderLabel(void* shaderPointer, char* label)
@@ -891,9 +1000,31 @@ void Direct3D12GraphicsService::SetShaderLabel(void* shaderPointer, char* label)
 void Direct3D12GraphicsService::DeleteShader(void* shaderPointer)
 { 
 	Direct3D12Shader* shader = (Direct3D12Shader*)shaderPointer;
+
+	ComPtr<ID3DBlob>* shaderBlobs[] { &shader->AmplificationShaderMethod, &shader->MeshShaderMethod, &shader->PixelShaderMethod, &shader->ComputeShaderMethod };
+
+	for (uint32_t i = 0; i < ShaderStageCount; i++)
+	{
+		if (*shaderBlobs[i] != nullptr)
+		{
+			ReleaseShaderBlob(shader->ShaderBlobHashes[i]);
+		}
+	}
+
 	delete shader;
 }
 
+void* Direct3D12GraphicsService::OpenShaderArchive(char* path)
+{
+	return OpenShaderArchiveFile(path);
+}
+
+void Direct3D12GraphicsService::CloseShaderArchive(void* shaderArchivePointer)
+{
+	// Shader blobs own a copy of their byte code so the archive can be closed while its shaders are alive
+	CloseShaderArchiveFile((ShaderArchive*)shaderArchivePointer);
+}
+
 void* Direct3D12GraphicsService::CreateComputePipelineState(void* shaderPointer)
 {
 if (shaderPointer == nullptr)
@@ -913,6 +1044,7 @@ if (shaderPointer == nullptr)
 
 	Direct3D12PipelineState* pipelineStateStruct = new Direct3D12PipelineState();
 	pipelineStateStruct->PipelineStateObject = pipelineState;
+	pipelineStateStruct->IsReady = true;
 
 	return pipelineStateStruct;
 }
@@ -1038,19 +1170,58 @@ void* Direct3D12GraphicsService::CreatePipelineState(void* shaderPointer, struct
 
 	Direct3D12PipelineState* pipelineStateStruct = new Direct3D12PipelineState();
 	pipelineStateStruct->PipelineStateObject = pipelineState;
+	pipelineStateStruct->IsReady = true;
 
     return pipelineStateStruct;
 }
 
+void* Direct3D12GraphicsService::CreatePipelineStateAsync(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState)
+{
+	if (shaderPointer == nullptr)
+	{
+		return nullptr;
+	}
+
+	Direct3D12PipelineState* pipelineState = new Direct3D12PipelineState();
+
+	this->pipelineCompilerThreadPool.Enqueue([this, pipelineState, shaderPointer, renderPassDescriptor, isComputePipelineState]()
+	{
+		Direct3D12PipelineState* compiledPipelineState = (Direct3D12PipelineState*)(isComputePipelineState ? CreateComputePipelineState(shaderPointer) : CreatePipelineState(shaderPointer, renderPassDescriptor));
+
+		pipelineState->PipelineStateObject = compiledPipelineState->PipelineStateObject;
+		delete compiledPipelineState;
+
+		pipelineState->IsReady = true;
+	});
+
+	return pipelineState;
+}
+
+int Direct3D12GraphicsService::IsPipelineStateReady(void* pipelineStatePointer, int waitForCompletion)
+{
+	Direct3D12PipelineState* pipelineState = (Direct3D12PipelineState*)pipelineStatePointer;
+
+	if (!pipelineState->IsReady && waitForCompletion)
+	{
+		this->pipelineCompilerThreadPool.Wait(pipelineState->IsReady);
+	}
+
+	return pipelineState->IsReady;
+}
+
 void Direct3D12GraphicsService::SetPipelineStateLabel(void* pipelineStatePointer, char* label)
 {
 	Direct3D12PipelineState* pipelineState = (Direct3D12PipelineState*)pipelineStatePointer;
+	IsPipelineStateReady(pipelineStatePointer, true);
+
 	pipelineState->PipelineStateObject->SetName(wstring(label, label + strlen(label)).c_str());
 }
 
 void Direct3D12GraphicsService::DeletePipelineState(void* pipelineStatePointer)
 { 
 	Direct3D12PipelineState* pipelineState = (Direct3D12PipelineState*)pipelineStatePointer;
+	IsPipelineStateReady(pipelineStatePointer, true);
+
 	delete pipelineState;
 }
 
@@ -1262,11 +1433,15 @@ void Direct3D12GraphicsService::SetPipelineState(void* commandListPointer, void*
 		return;
 	}
 
+	// A pipeline state created asynchronously that is not ready yet blocks until it is compiled
+	IsPipelineStateReady(pipelineStatePointer, true);
 	commandList->CommandListObject->SetPipelineState(pipelineState->PipelineStateObject.Get());
 }
 
 // TODO: To remove when sm6.6 is stable
-Direct3D12ShaderResourceHeap* currentDescriptorHeap;
+// The heap object and length are captured so that a resize during the recording doesn't change the bound tables
+ID3D12DescriptorHeap* currentDescriptorHeap;
+UINT currentDescriptorHeapStride;
 
 void Direct3D12GraphicsService::SetShaderResourceHeap(void* commandListPointer, void* shaderResourceHeapPointer)
 {
@@ -1277,7 +1452,8 @@ void Direct3D12GraphicsService::SetShaderResourceHeap(void* commandListPointer,
 	commandList->CommandListObject->SetDescriptorHeaps(1, descriptorHeaps);
 
 	// TODO: To remove when sm6.6 is stable
-	currentDescriptorHeap = descriptorHeap;
+	currentDescriptorHeap = descriptorHeap->HeapObject.Get();
+	currentDescriptorHeapStride = descriptorHeap->Length * descriptorHeap->HandleSize;
 }
 
 void Direct3D12GraphicsService::SetShader(void* commandListPointer, void* shaderPointer)
@@ -1305,17 +1481,17 @@ void Direct3D12GraphicsService::SetShader(void* commandListPointer, void* shader
 	{
 		if (commandList->Type == D3D12_COMMAND_LIST_TYPE_DIRECT)
 		{
-			commandList->CommandListObject->SetGraphicsRootDescriptorTable(1, currentDescriptorHeap->HeapObject->GetGPUDescriptorHandleForHeapStart());
+			commandList->CommandListObject->SetGraphicsRootDescriptorTable(1, currentDescriptorHeap->GetGPUDescriptorHandleForHeapStart());
 
-			D3D12_GPU_DESCRIPTOR_HANDLE texturesHandle = currentDescriptorHeap->HeapObject->GetGPUDescriptorHandleForHeapStart();
+			D3D12_GPU_DESCRIPTOR_HANDLE texturesHandle = currentDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
 			
-			texturesHandle.ptr += (2500 * currentDescriptorHeap->HandleSize);
+			texturesHandle.ptr += currentDescriptorHeapStride;
 			commandList->CommandListObject->SetGraphicsRootDescriptorTable(2, texturesHandle);
 
-			texturesHandle.ptr += (2500 * currentDescriptorHeap->HandleSize);
+			texturesHandle.ptr += currentDescriptorHeapStride;
 			commandList->CommandListObject->SetGraphicsRootDescriptorTable(3, texturesHandle);
 
-			texturesHandle.ptr += (2500 * currentDescriptorHeap->HandleSize);
+			texturesHandle.ptr += currentDescriptorHeapStride;
 			commandList->CommandListObject->SetGraphicsRootDescriptorTable(4, texturesHandle);
 			
 			currentDescriptorHeap = nullptr;
@@ -1323,17 +1499,17 @@ void Direct3D12GraphicsService::SetShader(void* commandListPointer, void* shader
 
 		else
 		{
-			commandList->CommandListObject->SetComputeRootDescriptorTable(1, currentDescriptorHeap->HeapObject->GetGPUDescriptorHandleForHeapStart());
+			commandList->CommandListObject->SetComputeRootDescriptorTable(1, currentDescriptorHeap->GetGPUDescriptorHandleForHeapStart());
 
-			D3D12_GPU_DESCRIPTOR_HANDLE texturesHandle = currentDescriptorHeap->HeapObject->GetGPUDescriptorHandleForHeapStart();
+			D3D12_GPU_DESCRIPTOR_HANDLE texturesHandle = currentDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
 
-			texturesHandle.ptr += (2500 * currentDescriptorHeap->HandleSize);
+			texturesHandle.ptr += currentDescriptorHeapStride;
 			commandList->CommandListObject->SetComputeRootDescriptorTable(2, texturesHandle);
 
-			texturesHandle.ptr += (2500 * currentDescriptorHeap->HandleSize);
+			texturesHandle.ptr += currentDescriptorHeapStride;
 			commandList->CommandListObject->SetComputeRootDescriptorTable(3, texturesHandle);
 
-			texturesHandle.ptr += (2500 * currentDescriptorHeap->HandleSize);
+			texturesHandle.ptr += currentDescriptorHeapStride;
 			commandList->CommandListObject->SetComputeRootDescriptorTable(4, texturesHandle);
 
 			currentDescriptorHeap = nullptr;
@@ -1451,6 +1627,50 @@ void Direct3D12GraphicsService::ResolveQueryData(void* commandListPointer, void*
 	commandList->CommandListObject->ResolveQueryData(queryBuffer->QueryBufferObject.Get(), queryType, startIndex, endIndex, destinationBuffer->BufferObject.Get(), 0);
 }
 
+void Direct3D12GraphicsService::BeginGpuZone(void* commandListPointer, unsigned int nameId, char* name)
+{
+	Direct3D12CommandList* commandList = (Direct3D12CommandList*)commandListPointer;
+
+	// Metadata 0 is a null terminated wide string for PIX
+	auto label = wstring(name, name + strlen(name));
+	commandList->CommandListObject->BeginEvent(0, label.c_str(), (UINT)((label.length() + 1) * sizeof(wchar_t)));
+
+	auto zoneIndex = this->gpuZoneProfiler.BeginZone(&commandList->GpuZones, nameId);
+
+	if (zoneIndex != GpuZoneInvalidIndex)
+	{
+		commandList->CommandListObject->EndQuery(GetGpuZoneQueryHeap(commandList), D3D12_QUERY_TYPE_TIMESTAMP, this->gpuZoneProfiler.GetStartQueryIndex(zoneIndex));
+	}
+}
+
+void Direct3D12GraphicsService::EndGpuZone(void* commandListPointer)
+{
+	Direct3D12CommandList* commandList = (Direct3D12CommandList*)commandListPointer;
+	auto zoneIndex = this->gpuZoneProfiler.EndZone(&commandList->GpuZones);
+
+	if (zoneIndex != GpuZoneInvalidIndex)
+	{
+		commandList->CommandListObject->EndQuery(GetGpuZoneQueryHeap(commandList), D3D12_QUERY_TYPE_TIMESTAMP, this->gpuZoneProfiler.GetEndQueryIndex(zoneIndex));
+		commandList->EndedGpuZones.push_back(zoneIndex);
+	}
+
+	commandList->CommandListObject->EndEvent();
+}
+
+int Direct3D12GraphicsService::ResolveGpuZones(struct GraphicsGpuZone* gpuZones, int gpuZonesLength)
+{
+	auto frameIndex = this->gpuZoneProfiler.GetNextFrameIndex();
+	auto frameTimestamps = this->gpuZoneTimestamps + this->gpuZoneProfiler.GetFrameQueryOffset(frameIndex);
+	auto queryCount = this->gpuZoneProfiler.GetFrameZoneCount(frameIndex) * 2;
+
+	auto result = this->gpuZoneProfiler.ResolveZones(frameTimestamps, gpuZones, gpuZonesLength);
+
+	// Zones that were not resolved by the GPU must not read the values of an older frame
+	memset(frameTimestamps, 0, queryCount * sizeof(uint64_t));
+
+	return result;
+}
+
 static void DebugReportCallback(D3D12_MESSAGE_CATEGORY Category, D3D12_MESSAGE_SEVERITY Severity, D3D12_MESSAGE_ID ID, LPCSTR pDescription, void* pContext)
 {
 
@@ -1576,6 +1796,182 @@ bool Direct3D12GraphicsService::CreateHeaps()
 	return true;
 }
 
+void Direct3D12GraphicsService::CreateGpuZoneQueryHeaps()
+{
+	// Copy queues write their timestamps in a separate heap, a zone uses the same query indices in
+	// both heaps so the results share the read back buffer
+	D3D12_QUERY_HEAP_DESC heapDesc = {};
+	heapDesc.Count = this->gpuZoneProfiler.GetQueryCount();
+	heapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+
+	AssertIfFailed(this->graphicsDevice->CreateQueryHeap(&heapDesc, IID_PPV_ARGS(this->gpuZoneQueryHeap.ReleaseAndGetAddressOf())));
+	this->gpuZoneQueryHeap->SetName(L"GpuZoneQueryHeap");
+
+	heapDesc.Type = D3D12_QUERY_HEAP_TYPE_COPY_QUEUE_TIMESTAMP;
+
+	AssertIfFailed(this->graphicsDevice->CreateQueryHeap(&heapDesc, IID_PPV_ARGS(this->gpuZoneCopyQueryHeap.ReleaseAndGetAddressOf())));
+	this->gpuZoneCopyQueryHeap->SetName(L"GpuZoneCopyQueryHeap");
+
+	D3D12_HEAP_PROPERTIES heapProperties = {};
+	heapProperties.Type = D3D12_HEAP_TYPE_READBACK;
+
+	D3D12_RESOURCE_DESC resourceDesc = {};
+	resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+	resourceDesc.Width = heapDesc.Count * sizeof(uint64_t);
+	resourceDesc.Height = 1;
+	resourceDesc.DepthOrArraySize = 1;
+	resourceDesc.MipLevels = 1;
+	resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+	resourceDesc.SampleDesc.Count = 1;
+	resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+	AssertIfFailed(this->graphicsDevice->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(this->gpuZoneReadBackBuffer.ReleaseAndGetAddressOf())));
+	this->gpuZoneReadBackBuffer->SetName(L"GpuZoneReadBackBuffer");
+
+	AssertIfFailed(this->gpuZoneReadBackBuffer->Map(0, nullptr, (void**)&this->gpuZoneTimestamps));
+	memset(this->gpuZoneTimestamps, 0, resourceDesc.Width);
+}
+
+ID3D12QueryHeap* Direct3D12GraphicsService::GetGpuZoneQueryHeap(Direct3D12CommandList* commandList)
+{
+	return commandList->Type == D3D12_COMMAND_LIST_TYPE_COPY ? this->gpuZoneCopyQueryHeap.Get() : this->gpuZoneQueryHeap.Get();
+}
+
+void Direct3D12GraphicsService::CreateShaderCommandSignature(Direct3D12Shader* shader, uint32_t parameterCount)
+{
+	D3D12_INDIRECT_ARGUMENT_DESC arguments[2] = {};
+	arguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+	arguments[0].Constant.RootParameterIndex = 0;
+	arguments[0].Constant.Num32BitValuesToSet = parameterCount;
+	arguments[1].Type = (shader->ComputeShaderMethod == nullptr) ? D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH : D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH;
+
+	D3D12_COMMAND_SIGNATURE_DESC commandSignatureDesc = {};
+	commandSignatureDesc.pArgumentDescs = arguments;
+	commandSignatureDesc.NumArgumentDescs = ARRAYSIZE(arguments);
+	commandSignatureDesc.ByteStride = (3 + parameterCount) * sizeof(uint32_t);
+
+	AssertIfFailed(this->graphicsDevice->CreateCommandSignature(&commandSignatureDesc, shader->RootSignature.Get(), IID_PPV_ARGS(shader->CommandSignature.ReleaseAndGetAddressOf())));
+}
+
+void Direct3D12GraphicsService::SetShaderBlob(Direct3D12Shader* shader, ShaderStage shaderStage, const void* byteCode, uint64_t byteCodeLength, uint64_t byteCodeHash)
+{
+	auto cacheEntry = this->shaderBlobCache.find(byteCodeHash);
+
+	if (cacheEntry == this->shaderBlobCache.end())
+	{
+		// Pipeline states are compiled after the archive may have been closed so the byte code is copied once per unique blob
+		Direct3D12CachedShaderBlob cachedShaderBlob = {};
+		cachedShaderBlob.ShaderBlob = CreateShaderBlob((void*)byteCode, (int)byteCodeLength);
+
+		cacheEntry = this->shaderBlobCache.emplace(byteCodeHash, cachedShaderBlob).first;
+	}
+
+	assert(cacheEntry->second.ShaderBlob->GetBufferSize() == byteCodeLength);
+	cacheEntry->second.ReferenceCount++;
+
+	ComPtr<ID3DBlob>* shaderBlobs[] { &shader->AmplificationShaderMethod, &shader->MeshShaderMethod, &shader->PixelShaderMethod, &shader->ComputeShaderMethod };
+
+	if (*shaderBlobs[shaderStage] != nullptr)
+	{
+		ReleaseShaderBlob(shader->ShaderBlobHashes[shaderStage]);
+	}
+
+	*shaderBlobs[shaderStage] = cacheEntry->second.ShaderBlob;
+	shader->ShaderBlobHashes[shaderStage] = byteCodeHash;
+}
+
+void Direct3D12GraphicsService::ReleaseShaderBlob(uint64_t byteCodeHash)
+{
+	auto cacheEntry = this->shaderBlobCache.find(byteCodeHash);
+	assert(cacheEntry != this->shaderBlobCache.end());
+
+	// Pipeline states keep their own copy of the byte code so the blob can be released right away
+	if (--cacheEntry->second.ReferenceCount == 0)
+	{
+		this->shaderBlobCache.erase(cacheEntry);
+	}
+}
+
+void Direct3D12GraphicsService::CreateShaderResourceHeapObject(Direct3D12ShaderResourceHeap* shaderResourceHeap, uint32_t length)
+{
+	// Buffer SRVs, texture SRVs, buffer UAVs and texture UAVs each use a region of length descriptors
+	D3D12_DESCRIPTOR_HEAP_DESC descriptorHeapDesc = {};
+	descriptorHeapDesc.NumDescriptors = 4 * length;
+	descriptorHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+	descriptorHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+
+	AssertIfFailed(this->graphicsDevice->CreateDescriptorHeap(&descriptorHeapDesc, IID_PPV_ARGS(shaderResourceHeap->HeapObject.ReleaseAndGetAddressOf())));
+
+	shaderResourceHeap->Length = length;
+	shaderResourceHeap->Descriptors.resize(length);
+}
+
+void Direct3D12GraphicsService::WriteShaderResourceDescriptor(Direct3D12ShaderResourceHeap* shaderResourceHeap, uint32_t index)
+{
+	auto& descriptor = shaderResourceHeap->Descriptors[index];
+
+	auto descriptorHandle = shaderResourceHeap->HeapObject->GetCPUDescriptorHandleForHeapStart();
+	descriptorHandle.ptr += index * shaderResourceHeap->HandleSize;
+
+	if (descriptor.IsTexture)
+	{
+		Direct3D12Texture* texture = (Direct3D12Texture*)descriptor.ResourcePointer;
+
+		if (!descriptor.IsWriteable)
+		{
+			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+			srvDesc.Format = ConvertSRVTextureFormat(texture->ResourceDesc.Format);
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+			srvDesc.Texture2D.MostDetailedMip = descriptor.MipLevel;
+			srvDesc.Texture2D.MipLevels = descriptor.MipLevel == 0 ? texture->ResourceDesc.MipLevels : 1;
+
+			descriptorHandle.ptr += (SIZE_T)shaderResourceHeap->Length * shaderResourceHeap->HandleSize;
+			this->graphicsDevice->CreateShaderResourceView(texture->TextureObject.Get(), &srvDesc, descriptorHandle);
+		}
+
+		else
+		{
+			D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
+			uavDesc.Format = ConvertSRVTextureFormat(texture->ResourceDesc.Format);
+			uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
+			uavDesc.Texture2D.MipSlice = descriptor.MipLevel;
+
+			descriptorHandle.ptr += (SIZE_T)3 * shaderResourceHeap->Length * shaderResourceHeap->HandleSize;
+			this->graphicsDevice->CreateUnorderedAccessView(texture->TextureObject.Get(), nullptr, &uavDesc, descriptorHandle);
+		}
+	}
+
+	else
+	{
+		Direct3D12GraphicsBuffer* graphicsBuffer = (Direct3D12GraphicsBuffer*)descriptor.ResourcePointer;
+
+		if (!descriptor.IsWriteable)
+		{
+			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
+			srvDesc.Format = DXGI_FORMAT_R32_TYPELESS;
+			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+			srvDesc.Buffer.NumElements = (UINT)graphicsBuffer->ResourceDesc.Width / 4;
+			srvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_RAW;
+
+			this->graphicsDevice->CreateShaderResourceView(graphicsBuffer->BufferObject.Get(), &srvDesc, descriptorHandle);
+		}
+
+		else
+		{
+			D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
+			uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
+			uavDesc.Format = DXGI_FORMAT_R32_TYPELESS;
+			uavDesc.Buffer.NumElements = (UINT)graphicsBuffer->ResourceDesc.Width / 4;
+			uavDesc.Buffer.Flags = D3D12_BUFFER_UAV_FLAG_RAW;
+
+			descriptorHandle.ptr += (SIZE_T)2 * shaderResourceHeap->Length * shaderResourceHeap->HandleSize;
+			this->graphicsDevice->CreateUnorderedAccessView(graphicsBuffer->BufferObject.Get(), nullptr, &uavDesc, descriptorHandle);
+		}
+	}
+}
+
 // TODO: Make it generic to all resource types
 void Direct3D12GraphicsService::TransitionTextureToState(Direct3D12CommandList* commandList, Direct3D12Texture* texture, D3D12_RESOURCE_STATES destinationState)
 {
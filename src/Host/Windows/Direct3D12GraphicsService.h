@@ -1,6 +1,9 @@
 #pragma once
 #include "WindowsCommon.h"
 #include "../Common/CoreEngine.h"
+#include "../Common/WorkerThreadPool.h"
+#include "../Common/ShaderArchive.h"
+#include "../Common/GpuZoneProfiler.h"
 
 using namespace std;
 using namespace Microsoft::WRL;
@@ -8,10 +11,13 @@ using namespace Microsoft::WRL;
 extern "C" { _declspec(dllexport) extern const UINT D3D12SDKVersion = 4;}
 extern "C" { _declspec(dllexport) extern const char* D3D12SDKPath = u8".\\D3D12\\"; }
 
-static const int RenderBuffersCount = 2;
-static const int FramesCount = 2;
-static const int CommandAllocatorsCount = 2;
+static const int MaxFramesInFlightCount = 4;
+static const int MaxBackBufferCount = 8;
 static const int QueryHeapMaxSize = 1000;
+static const int MaxPipelineCompilerThreadCount = 4;
+
+// Each descriptor type uses one region of the heap, shader visible heaps are limited to 1000000 descriptors
+static const int MaxShaderResourceHeapLength = 250000;
 
 struct Direct3D12CommandQueue
 {
@@ -28,6 +34,10 @@ struct Direct3D12CommandList
     D3D12_COMMAND_LIST_TYPE Type;
     Direct3D12CommandQueue* CommandQueue;
     GraphicsRenderPassDescriptor RenderPassDescriptor;
+
+    // Ended zones are resolved when the command list is committed, outside of the render passes
+    GpuZoneStack GpuZones;
+    vector<uint32_t> EndedGpuZones;
 };
 
 struct Direct3D12GraphicsHeap
@@ -36,10 +46,23 @@ struct Direct3D12GraphicsHeap
     GraphicsServiceHeapType Type;
 };
 
+struct Direct3D12ShaderResourceDescriptor
+{
+    void* ResourcePointer;
+    bool IsTexture;
+    bool IsWriteable;
+    uint32_t MipLevel;
+};
+
 struct Direct3D12ShaderResourceHeap
 {
     ComPtr<ID3D12DescriptorHeap> HeapObject;
     UINT HandleSize;
+    uint32_t Length;
+    vector<Direct3D12ShaderResourceDescriptor> Descriptors;
+
+    // Command lists recorded before a resize can still reference the previous heaps
+    vector<ComPtr<ID3D12DescriptorHeap>> RetiredHeapObjects;
 };
 
 struct Direct3D12GraphicsBuffer
@@ -71,12 +94,20 @@ struct Direct3D12CommandBuffer
 {
 };
 
+// Shader blobs are shared by all the shaders that contain the same DXIL code
+struct Direct3D12CachedShaderBlob
+{
+    ComPtr<ID3DBlob> ShaderBlob;
+    uint32_t ReferenceCount;
+};
+
 struct Direct3D12Shader
 {
     ComPtr<ID3DBlob> AmplificationShaderMethod;
     ComPtr<ID3DBlob> MeshShaderMethod;
     ComPtr<ID3DBlob> PixelShaderMethod;
     ComPtr<ID3DBlob> ComputeShaderMethod;
+    uint64_t ShaderBlobHashes[ShaderStageCount];
     ComPtr<ID3D12RootSignature> RootSignature;
     ComPtr<ID3D12CommandSignature> CommandSignature;
 };
@@ -84,6 +115,9 @@ struct Direct3D12Shader
 struct Direct3D12PipelineState
 {
     ComPtr<ID3D12PipelineState> PipelineStateObject;
+
+    // Set once the pipeline compiler thread has created the pipeline state object
+    atomic<bool> IsReady;
 };
 
 struct Direct3D12SwapChain
@@ -91,7 +125,15 @@ struct Direct3D12SwapChain
     ComPtr<IDXGISwapChain3> SwapChainObject;
     Direct3D12CommandQueue* CommandQueue;
     void* WaitHandle;
-    Direct3D12Texture* BackBufferTextures[RenderBuffersCount];
+    Direct3D12Texture* BackBufferTextures[MaxBackBufferCount];
+    int BackBufferCount;
+    GraphicsPresentMode PresentMode;
+    UINT Flags;
+
+    // Present queue fence value of each frame in flight, the CPU waits for the oldest one
+    // before starting a new frame
+    uint64_t FrameFenceValues[MaxFramesInFlightCount];
+    int CurrentFrameIndex;
 };
 
 class Direct3D12GraphicsService
@@ -101,15 +143,19 @@ class Direct3D12GraphicsService
         ~Direct3D12GraphicsService();
 
         void GetGraphicsAdapterName(char* output);
+        int SetFramesInFlightCount(int framesInFlightCount);
         GraphicsAllocationInfos GetBufferAllocationInfos(int sizeInBytes);
         GraphicsAllocationInfos GetTextureAllocationInfos(enum GraphicsTextureFormat textureFormat, enum GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount);
+        struct GraphicsMemoryBudget GetMemoryBudget(enum GraphicsServiceHeapType heapType);
 
         void* CreateCommandQueue(enum GraphicsServiceCommandType commandQueueType);
         void SetCommandQueueLabel(void* commandQueuePointer, char* label);
         void DeleteCommandQueue(void* commandQueuePointer);
         void ResetCommandQueue(void* commandQueuePointer);
         unsigned long GetCommandQueueTimestampFrequency(void* commandQueuePointer);
+        struct GraphicsTimestampCalibration GetCommandQueueTimestampCalibration(void* commandQueuePointer);
         unsigned long ExecuteCommandLists(void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength);
+        void ExecuteCommandListBatches(struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength);
         void WaitForCommandQueueOnCpu(struct GraphicsFence fenceToWait);
 
         void* CreateCommandList(void* commandQueuePointer);
@@ -123,12 +169,15 @@ class Direct3D12GraphicsService
         void DeleteGraphicsHeap(void* graphicsHeapPointer);
 
         void* CreateShaderResourceHeap(unsigned long length);
+        unsigned long GetShaderResourceHeapLength(void* shaderResourceHeapPointer);
+        void ResizeShaderResourceHeap(void* shaderResourceHeapPointer, unsigned long length);
         void SetShaderResourceHeapLabel(void* shaderResourceHeapPointer, char* label);
         void DeleteShaderResourceHeap(void* shaderResourceHeapPointer);
         void CreateShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index, void* texturePointer, int isWriteable, unsigned int mipLevel);
         void DeleteShaderResourceTexture(void* shaderResourceHeapPointer, unsigned int index);
         void CreateShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index, void* bufferPointer, int isWriteable);
         void DeleteShaderResourceBuffer(void* shaderResourceHeapPointer, unsigned int index);
+        void CreateShaderResources(void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength);
 
         void* CreateGraphicsBuffer(void* graphicsHeapPointer, unsigned long heapOffset, GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes);
         void SetGraphicsBufferLabel(void* graphicsBufferPointer, char* label);
@@ -140,7 +189,7 @@ class Direct3D12GraphicsService
         void SetTextureLabel(void* texturePointer, char* label);
         void DeleteTexture(void* texturePointer);
 
-        void* CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat);
+        void* CreateSwapChain(void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount);
         void DeleteSwapChain(void* swapChainPointer);
         void ResizeSwapChain(void* swapChainPointer, int width, int height);
         void* GetSwapChainBackBufferTexture(void* swapChainPointer);
@@ -153,11 +202,16 @@ class Direct3D12GraphicsService
         void DeleteQueryBuffer(void* queryBufferPointer);
 
         void* CreateShader(char* computeShaderFunction, void* shaderByteCode, int shaderByteCodeLength);
+        void* CreateShaderFromArchive(void* shaderArchivePointer, char* shaderName);
         void SetShaderLabel(void* shaderPointer, char* label);
         void DeleteShader(void* shaderPointer);
+        void* OpenShaderArchive(char* path);
+        void CloseShaderArchive(void* shaderArchivePointer);
 
         void* CreateComputePipelineState(void* shaderPointer);
         void* CreatePipelineState(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor);
+        void* CreatePipelineStateAsync(void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState);
+        int IsPipelineStateReady(void* pipelineStatePointer, int waitForCompletion);
         void SetPipelineStateLabel(void* pipelineStatePointer, char* label);
         void DeletePipelineState(void* pipelineStatePointer);
 
@@ -186,11 +240,15 @@ class Direct3D12GraphicsService
         void BeginQuery(void* commandListPointer, void* queryBufferPointer, int index);
         void EndQuery(void* commandListPointer, void* queryBufferPointer, int index);
         void ResolveQueryData(void* commandListPointer, void* queryBufferPointer, void* destinationBufferPointer, int startIndex, int endIndex);
+        void BeginGpuZone(void* commandListPointer, unsigned int nameId, char* name);
+        void EndGpuZone(void* commandListPointer);
+        int ResolveGpuZones(struct GraphicsGpuZone* gpuZones, int gpuZonesLength);
 
     private:
         // Device objects
         wstring adapterName;
         ComPtr<IDXGIFactory4> dxgiFactory; 
+        ComPtr<IDXGIAdapter4> graphicsAdapter;
         ComPtr<ID3D12Device9> graphicsDevice;
         ComPtr<ID3D12Debug5> debugController;
         ComPtr<ID3D12InfoQueue1> debugInfoQueue;
@@ -198,6 +256,18 @@ class Direct3D12GraphicsService
         
         // Command Objects
         int32_t currentAllocatorIndex = 0;
+        int32_t framesInFlightCount = 2;
+
+        // GPU zones are resolved in a persistently mapped read back buffer that is read when the
+        // frame slot is reused
+        GpuZoneProfiler gpuZoneProfiler { MaxFramesInFlightCount };
+        ComPtr<ID3D12QueryHeap> gpuZoneQueryHeap;
+        ComPtr<ID3D12QueryHeap> gpuZoneCopyQueryHeap;
+        ComPtr<ID3D12Resource> gpuZoneReadBackBuffer;
+        uint64_t* gpuZoneTimestamps;
+
+        // Pipeline objects
+        WorkerThreadPool pipelineCompilerThreadPool { MaxPipelineCompilerThreadCount };
 
         // Synchronization objects
         HANDLE globalFenceEvent;
@@ -214,11 +284,20 @@ class Direct3D12GraphicsService
 
         // Shaders
         Direct3D12Shader* shaderBound;
+        unordered_map<uint64_t, Direct3D12CachedShaderBlob> shaderBlobCache;
 
         void EnableDebugLayer();
         ComPtr<IDXGIAdapter4> FindGraphicsAdapter(const ComPtr<IDXGIFactory4> dxgiFactory);
         bool CreateDevice(const ComPtr<IDXGIFactory4> dxgiFactory, const ComPtr<IDXGIAdapter4> graphicsAdapter);
         bool CreateHeaps();
+        void CreateGpuZoneQueryHeaps();
+        ID3D12QueryHeap* GetGpuZoneQueryHeap(Direct3D12CommandList* commandList);
+        void CreateShaderCommandSignature(Direct3D12Shader* shader, uint32_t parameterCount);
+        void SetShaderBlob(Direct3D12Shader* shader, ShaderStage shaderStage, const void* byteCode, uint64_t byteCodeLength, uint64_t byteCodeHash);
+        void ReleaseShaderBlob(uint64_t byteCodeHash);
+
+        void CreateShaderResourceHeapObject(Direct3D12ShaderResourceHeap* shaderResourceHeap, uint32_t length);
+        void WriteShaderResourceDescriptor(Direct3D12ShaderResourceHeap* shaderResourceHeap, uint32_t index);
 
         void TransitionTextureToState(Direct3D12CommandList* commandList, Direct3D12Texture* texture, D3D12_RESOURCE_STATES destinationState);
         void TransitionBufferToState(Direct3D12CommandList* commandList, Direct3D12GraphicsBuffer* graphicsBuffer, D3D12_RESOURCE_STATES destinationState);
@@ -7,6 +7,12 @@ void Direct3D12GraphicsServiceGetGraphicsAdapterNameInterop(void* context, char*
     contextObject->GetGraphicsAdapterName(output);
 }
 
+int Direct3D12GraphicsServiceSetFramesInFlightCountInterop(void* context, int framesInFlightCount)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->SetFramesInFlightCount(framesInFlightCount);
+}
+
 struct GraphicsAllocationInfos Direct3D12GraphicsServiceGetBufferAllocationInfosInterop(void* context, int sizeInBytes)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -19,6 +25,12 @@ struct GraphicsAllocationInfos Direct3D12GraphicsServiceGetTextureAllocationInfo
     return contextObject->GetTextureAllocationInfos(textureFormat, usage, width, height, faceCount, mipLevels, multisampleCount);
 }
 
+struct GraphicsMemoryBudget Direct3D12GraphicsServiceGetMemoryBudgetInterop(void* context, enum GraphicsServiceHeapType heapType)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->GetMemoryBudget(heapType);
+}
+
 void* Direct3D12GraphicsServiceCreateCommandQueueInterop(void* context, enum GraphicsServiceCommandType commandQueueType)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -49,12 +61,24 @@ unsigned long Direct3D12GraphicsServiceGetCommandQueueTimestampFrequencyInterop(
     return contextObject->GetCommandQueueTimestampFrequency(commandQueuePointer);
 }
 
+struct GraphicsTimestampCalibration Direct3D12GraphicsServiceGetCommandQueueTimestampCalibrationInterop(void* context, void* commandQueuePointer)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->GetCommandQueueTimestampCalibration(commandQueuePointer);
+}
+
 unsigned long Direct3D12GraphicsServiceExecuteCommandListsInterop(void* context, void* commandQueuePointer, void** commandLists, int commandListsLength, struct GraphicsFence* fencesToWait, int fencesToWaitLength)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
     return contextObject->ExecuteCommandLists(commandQueuePointer, commandLists, commandListsLength, fencesToWait, fencesToWaitLength);
 }
 
+void Direct3D12GraphicsServiceExecuteCommandListBatchesInterop(void* context, struct GraphicsCommandListBatch* batches, int batchesLength, struct GraphicsFence* fences, int fencesLength)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    contextObject->ExecuteCommandListBatches(batches, batchesLength, fences, fencesLength);
+}
+
 void Direct3D12GraphicsServiceWaitForCommandQueueOnCpuInterop(void* context, struct GraphicsFence fenceToWait)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -115,6 +139,18 @@ void* Direct3D12GraphicsServiceCreateShaderResourceHeapInterop(void* context, un
     return contextObject->CreateShaderResourceHeap(length);
 }
 
+unsigned long Direct3D12GraphicsServiceGetShaderResourceHeapLengthInterop(void* context, void* shaderResourceHeapPointer)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->GetShaderResourceHeapLength(shaderResourceHeapPointer);
+}
+
+void Direct3D12GraphicsServiceResizeShaderResourceHeapInterop(void* context, void* shaderResourceHeapPointer, unsigned long length)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    contextObject->ResizeShaderResourceHeap(shaderResourceHeapPointer, length);
+}
+
 void Direct3D12GraphicsServiceSetShaderResourceHeapLabelInterop(void* context, void* shaderResourceHeapPointer, char* label)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -151,6 +187,12 @@ void Direct3D12GraphicsServiceDeleteShaderResourceBufferInterop(void* context, v
     contextObject->DeleteShaderResourceBuffer(shaderResourceHeapPointer, index);
 }
 
+void Direct3D12GraphicsServiceCreateShaderResourcesInterop(void* context, void* shaderResourceHeapPointer, struct GraphicsShaderResourceWrite* writes, int writesLength)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    contextObject->CreateShaderResources(shaderResourceHeapPointer, writes, writesLength);
+}
+
 void* Direct3D12GraphicsServiceCreateGraphicsBufferInterop(void* context, void* graphicsHeapPointer, unsigned long heapOffset, enum GraphicsBufferUsage graphicsBufferUsage, int sizeInBytes)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -199,10 +241,10 @@ void Direct3D12GraphicsServiceDeleteTextureInterop(void* context, void* textureP
     contextObject->DeleteTexture(texturePointer);
 }
 
-void* Direct3D12GraphicsServiceCreateSwapChainInterop(void* context, void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat)
+void* Direct3D12GraphicsServiceCreateSwapChainInterop(void* context, void* windowPointer, void* commandQueuePointer, int width, int height, enum GraphicsTextureFormat textureFormat, enum GraphicsPresentMode presentMode, int backBufferCount)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
-    return contextObject->CreateSwapChain(windowPointer, commandQueuePointer, width, height, textureFormat);
+    return contextObject->CreateSwapChain(windowPointer, commandQueuePointer, width, height, textureFormat, presentMode, backBufferCount);
 }
 
 void Direct3D12GraphicsServiceDeleteSwapChainInterop(void* context, void* swapChainPointer)
@@ -265,6 +307,12 @@ void* Direct3D12GraphicsServiceCreateShaderInterop(void* context, char* computeS
     return contextObject->CreateShader(computeShaderFunction, shaderByteCode, shaderByteCodeLength);
 }
 
+void* Direct3D12GraphicsServiceCreateShaderFromArchiveInterop(void* context, void* shaderArchivePointer, char* shaderName)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->CreateShaderFromArchive(shaderArchivePointer, shaderName);
+}
+
 void Direct3D12GraphicsServiceSetShaderLabelInterop(void* context, void* shaderPointer, char* label)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -277,6 +325,18 @@ void Direct3D12GraphicsServiceDeleteShaderInterop(void* context, void* shaderPoi
     contextObject->DeleteShader(shaderPointer);
 }
 
+void* Direct3D12GraphicsServiceOpenShaderArchiveInterop(void* context, char* path)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->OpenShaderArchive(path);
+}
+
+void Direct3D12GraphicsServiceCloseShaderArchiveInterop(void* context, void* shaderArchivePointer)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    contextObject->CloseShaderArchive(shaderArchivePointer);
+}
+
 void* Direct3D12GraphicsServiceCreateComputePipelineStateInterop(void* context, void* shaderPointer)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -289,6 +349,18 @@ void* Direct3D12GraphicsServiceCreatePipelineStateInterop(void* context, void* s
     return contextObject->CreatePipelineState(shaderPointer, renderPassDescriptor);
 }
 
+void* Direct3D12GraphicsServiceCreatePipelineStateAsyncInterop(void* context, void* shaderPointer, struct GraphicsRenderPassDescriptor renderPassDescriptor, int isComputePipelineState)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->CreatePipelineStateAsync(shaderPointer, renderPassDescriptor, isComputePipelineState);
+}
+
+int Direct3D12GraphicsServiceIsPipelineStateReadyInterop(void* context, void* pipelineStatePointer, int waitForCompletion)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->IsPipelineStateReady(pipelineStatePointer, waitForCompletion);
+}
+
 void Direct3D12GraphicsServiceSetPipelineStateLabelInterop(void* context, void* pipelineStatePointer, char* label)
 {
     auto contextObject = (Direct3D12GraphicsService*)context;
@@ -409,18 +481,40 @@ void Direct3D12GraphicsServiceResolveQueryDataInterop(void* context, void* comma
     contextObject->ResolveQueryData(commandListPointer, queryBufferPointer, destinationBufferPointer, startIndex, endIndex);
 }
 
+void Direct3D12GraphicsServiceBeginGpuZoneInterop(void* context, void* commandListPointer, unsigned int nameId, char* name)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    contextObject->BeginGpuZone(commandListPointer, nameId, name);
+}
+
+void Direct3D12GraphicsServiceEndGpuZoneInterop(void* context, void* commandListPointer)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    contextObject->EndGpuZone(commandListPointer);
+}
+
+int Direct3D12GraphicsServiceResolveGpuZonesInterop(void* context, struct GraphicsGpuZone* gpuZones, int gpuZonesLength)
+{
+    auto contextObject = (Direct3D12GraphicsService*)context;
+    return contextObject->ResolveGpuZones(gpuZones, gpuZonesLength);
+}
+
 void InitDirect3D12GraphicsService(const Direct3D12GraphicsService* context, GraphicsService* service)
 {
     service->Context = (void*)context;
     service->GraphicsService_GetGraphicsAdapterName = Direct3D12GraphicsServiceGetGraphicsAdapterNameInterop;
+    service->GraphicsService_SetFramesInFlightCount = Direct3D12GraphicsServiceSetFramesInFlightCountInterop;
     service->GraphicsService_GetBufferAllocationInfos = Direct3D12GraphicsServiceGetBufferAllocationInfosInterop;
     service->GraphicsService_GetTextureAllocationInfos = Direct3D12GraphicsServiceGetTextureAllocationInfosInterop;
+    service->GraphicsService_GetMemoryBudget = Direct3D12GraphicsServiceGetMemoryBudgetInterop;
     service->GraphicsService_CreateCommandQueue = Direct3D12GraphicsServiceCreateCommandQueueInterop;
     service->GraphicsService_SetCommandQueueLabel = Direct3D12GraphicsServiceSetCommandQueueLabelInterop;
     service->GraphicsService_DeleteCommandQueue = Direct3D12GraphicsServiceDeleteCommandQueueInterop;
     service->GraphicsService_ResetCommandQueue = Direct3D12GraphicsServiceResetCommandQueueInterop;
     service->GraphicsService_GetCommandQueueTimestampFrequency = Direct3D12GraphicsServiceGetCommandQueueTimestampFrequencyInterop;
+    service->GraphicsService_GetCommandQueueTimestampCalibration = Direct3D12GraphicsServiceGetCommandQueueTimestampCalibrationInterop;
     service->GraphicsService_ExecuteCommandLists = Direct3D12GraphicsServiceExecuteCommandListsInterop;
+    service->GraphicsService_ExecuteCommandListBatches = Direct3D12GraphicsServiceExecuteCommandListBatchesInterop;
     service->GraphicsService_WaitForCommandQueueOnCpu = Direct3D12GraphicsServiceWaitForCommandQueueOnCpuInterop;
     service->GraphicsService_CreateCommandList = Direct3D12GraphicsServiceCreateCommandListInterop;
     service->GraphicsService_SetCommandListLabel = Direct3D12GraphicsServiceSetCommandListLabelInterop;
@@ -431,12 +525,15 @@ void InitDirect3D12GraphicsService(const Direct3D12GraphicsService* context, Gra
     service->GraphicsService_SetGraphicsHeapLabel = Direct3D12GraphicsServiceSetGraphicsHeapLabelInterop;
     service->GraphicsService_DeleteGraphicsHeap = Direct3D12GraphicsServiceDeleteGraphicsHeapInterop;
     service->GraphicsService_CreateShaderResourceHeap = Direct3D12GraphicsServiceCreateShaderResourceHeapInterop;
+    service->GraphicsService_GetShaderResourceHeapLength = Direct3D12GraphicsServiceGetShaderResourceHeapLengthInterop;
+    service->GraphicsService_ResizeShaderResourceHeap = Direct3D12GraphicsServiceResizeShaderResourceHeapInterop;
     service->GraphicsService_SetShaderResourceHeapLabel = Direct3D12GraphicsServiceSetShaderResourceHeapLabelInterop;
     service->GraphicsService_DeleteShaderResourceHeap = Direct3D12GraphicsServiceDeleteShaderResourceHeapInterop;
     service->GraphicsService_CreateShaderResourceTexture = Direct3D12GraphicsServiceCreateShaderResourceTextureInterop;
     service->GraphicsService_DeleteShaderResourceTexture = Direct3D12GraphicsServiceDeleteShaderResourceTextureInterop;
     service->GraphicsService_CreateShaderResourceBuffer = Direct3D12GraphicsServiceCreateShaderResourceBufferInterop;
     service->GraphicsService_DeleteShaderResourceBuffer = Direct3D12GraphicsServiceDeleteShaderResourceBufferInterop;
+    service->GraphicsService_CreateShaderResources = Direct3D12GraphicsServiceCreateShaderResourcesInterop;
     service->GraphicsService_CreateGraphicsBuffer = Direct3D12GraphicsServiceCreateGraphicsBufferInterop;
     service->GraphicsService_SetGraphicsBufferLabel = Direct3D12GraphicsServiceSetGraphicsBufferLabelInterop;
     service->GraphicsService_DeleteGraphicsBuffer = Direct3D12GraphicsServiceDeleteGraphicsBufferInterop;
@@ -456,10 +553,15 @@ void InitDirect3D12GraphicsService(const Direct3D12GraphicsService* context, Gra
     service->GraphicsService_SetQueryBufferLabel = Direct3D12GraphicsServiceSetQueryBufferLabelInterop;
     service->GraphicsService_DeleteQueryBuffer = Direct3D12GraphicsServiceDeleteQueryBufferInterop;
     service->GraphicsService_CreateShader = Direct3D12GraphicsServiceCreateShaderInterop;
+    service->GraphicsService_CreateShaderFromArchive = Direct3D12GraphicsServiceCreateShaderFromArchiveInterop;
     service->GraphicsService_SetShaderLabel = Direct3D12GraphicsServiceSetShaderLabelInterop;
     service->GraphicsService_DeleteShader = Direct3D12GraphicsServiceDeleteShaderInterop;
+    service->GraphicsService_OpenShaderArchive = Direct3D12GraphicsServiceOpenShaderArchiveInterop;
+    service->GraphicsService_CloseShaderArchive = Direct3D12GraphicsServiceCloseShaderArchiveInterop;
     service->GraphicsService_CreateComputePipelineState = Direct3D12GraphicsServiceCreateComputePipelineStateInterop;
     service->GraphicsService_CreatePipelineState = Direct3D12GraphicsServiceCreatePipelineStateInterop;
+    service->GraphicsService_CreatePipelineStateAsync = Direct3D12GraphicsServiceCreatePipelineStateAsyncInterop;
+    service->GraphicsService_IsPipelineStateReady = Direct3D12GraphicsServiceIsPipelineStateReadyInterop;
     service->GraphicsService_SetPipelineStateLabel = Direct3D12GraphicsServiceSetPipelineStateLabelInterop;
     service->GraphicsService_DeletePipelineState = Direct3D12GraphicsServiceDeletePipelineStateInterop;
     service->GraphicsService_CopyDataToGraphicsBuffer = Direct3D12GraphicsServiceCopyDataToGraphicsBufferInterop;
@@ -480,4 +582,7 @@ void InitDirect3D12GraphicsService(const Direct3D12GraphicsService* context, Gra
     service->GraphicsService_BeginQuery = Direct3D12GraphicsServiceBeginQueryInterop;
     service->GraphicsService_EndQuery = Direct3D12GraphicsServiceEndQueryInterop;
     service->GraphicsService_ResolveQueryData = Direct3D12GraphicsServiceResolveQueryDataInterop;
+    service->GraphicsService_BeginGpuZone = Direct3D12GraphicsServiceBeginGpuZoneInterop;
+    service->GraphicsService_EndGpuZone = Direct3D12GraphicsServiceEndGpuZoneInterop;
+    service->GraphicsService_ResolveGpuZones = Direct3D12GraphicsServiceResolveGpuZonesInterop;
 }
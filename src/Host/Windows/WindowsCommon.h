@@ -8,6 +8,7 @@
 #include <string>
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <stack>
 #include <assert.h>
@@ -1,7 +1,7 @@
 #include "WindowsCommon.h"
 #include <stdio.h>
 #include "Direct3D12GraphicsService.h"
-#include "VulkanGraphicsService.h"
+#include "../Common/VulkanGraphicsService.h"
 #include "WindowsInputsService.h"
 #include "CoreEngineHost.h"
 #include "WindowsNativeUIServiceUtils.h"
@@ -65,6 +65,7 @@ int CALLBACK wWinMain(HINSTANCE applicationInstance, HINSTANCE, LPWSTR fullComma
 
     wstring assemblyName = L"CoreEngine";
     bool useVulkan = false;
+    bool useNullGraphics = false;
 
     if (!arguments.empty())
     {
@@ -96,6 +97,11 @@ int CALLBACK wWinMain(HINSTANCE applicationInstance, HINSTANCE, LPWSTR fullComma
             {
                 useVulkan = true;
             }
+
+            else if (parameter == L"--null")
+            {
+                useNullGraphics = true;
+            }
         }
     }
 
@@ -103,8 +109,14 @@ int CALLBACK wWinMain(HINSTANCE applicationInstance, HINSTANCE, LPWSTR fullComma
 
     Direct3D12GraphicsService* direct3dGraphicsService = nullptr;
     VulkanGraphicsService* vulkanGraphicsService = nullptr;
+    NullGraphicsService* nullGraphicsService = nullptr;
 
-    if (!useVulkan)
+    if (useNullGraphics)
+    {
+        nullGraphicsService = new NullGraphicsService();
+    }
+
+    else if (!useVulkan)
     {
         direct3dGraphicsService = new Direct3D12GraphicsService();
 
@@ -117,7 +129,7 @@ int CALLBACK wWinMain(HINSTANCE applicationInstance, HINSTANCE, LPWSTR fullComma
 
     auto inputsService = WindowsInputsService();
 
-    auto coreEngineHost = CoreEngineHost(assemblyName, &nativeUIService, direct3dGraphicsService, vulkanGraphicsService, &inputsService);
+    auto coreEngineHost = CoreEngineHost(assemblyName, &nativeUIService, direct3dGraphicsService, vulkanGraphicsService, nullGraphicsService, &inputsService);
     coreEngineHost.StartEngine();
 
     if (direct3dGraphicsService != nullptr)
@@ -129,4 +141,10 @@ int CALLBACK wWinMain(HINSTANCE applicationInstance, HINSTANCE, LPWSTR fullComma
     {
         delete vulkanGraphicsService;
     }
+
+    if (nullGraphicsService != nullptr)
+    {
+        nullGraphicsService->PrintStatistics();
+        delete nullGraphicsService;
+    }
 }
\ No newline at end of file
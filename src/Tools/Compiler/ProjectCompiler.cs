@@ -2,6 +2,7 @@ using System.IO;
 using System.Threading.Tasks;
 using Microsoft.CodeAnalysis.MSBuild;
 using CoreEngine.Diagnostics;
+using CoreEngine.Graphics;
 using System;
 using Microsoft.CodeAnalysis;
 using System.Linq;
@@ -85,6 +86,13 @@ namespace CoreEngine.Tools.Compiler
             // TODO: Remove deleted files from file tracker
             CleanupOutputDirectory(outputDirectory, remainingDestinationFiles);
             fileTracker.WriteFile(fileTrackerPath);
+
+            var archivedShaderCount = ShaderArchiveWriter.WriteShaderArchive(outputDirectory, Path.Combine(outputDirectory, ShaderArchiveWriter.FileName));
+
+            if (archivedShaderCount > 0)
+            {
+                Logger.WriteMessage($"Packed {archivedShaderCount} shader(s) into '{ShaderArchiveWriter.FileName}'.");
+            }
         }
 
         private async static Task<int> BuildDotnet(string projectPath, string outputDirectory, FileTracker fileTracker, IList<string> remainingDestinationFiles)
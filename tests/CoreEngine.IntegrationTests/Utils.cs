@@ -38,12 +38,18 @@ namespace CoreEngine.IntegrationTests
         private Dictionary<IntPtr, TestGraphicsBuffer> graphicsBuffers { get; } = new Dictionary<IntPtr, TestGraphicsBuffer>();
 
         public string GetGraphicsAdapterName() { return "TestAdapter"; }
+        public int SetFramesInFlightCount(int framesInFlightCount) { return framesInFlightCount; }
         
         public GraphicsAllocationInfos GetTextureAllocationInfos(GraphicsTextureFormat textureFormat, GraphicsTextureUsage usage, int width, int height, int faceCount, int mipLevels, int multisampleCount)
         {
             return new GraphicsAllocationInfos(1024, 64);
         }
 
+        public GraphicsMemoryBudget GetMemoryBudget(GraphicsServiceHeapType heapType)
+        {
+            return new GraphicsMemoryBudget(ulong.MaxValue, 0);
+        }
+
         public IntPtr CreateCommandQueue(GraphicsServiceCommandType commandQueueType)
         {
             return new IntPtr(1);
@@ -57,11 +63,18 @@ namespace CoreEngine.IntegrationTests
             return 1;
         }
 
+        public GraphicsTimestampCalibration GetCommandQueueTimestampCalibration(IntPtr commandQueuePointer)
+        {
+            return new GraphicsTimestampCalibration();
+        }
+
         public ulong ExecuteCommandLists(IntPtr commandQueuePointer, ReadOnlySpan<IntPtr> commandLists, bool isAwaitable) 
         {
             return 1;
         }
 
+        public void ExecuteCommandListBatches(ReadOnlySpan<GraphicsCommandListBatch> batches, Span<GraphicsFence> fences) {}
+
         public void WaitForCommandQueue(IntPtr commandQueuePointer, IntPtr commandQueueToWaitPointer, ulong fenceValue) {}
         public void WaitForCommandQueueOnCpu(IntPtr commandQueueToWaitPointer, ulong fenceValue) {}
  
@@ -88,12 +101,20 @@ namespace CoreEngine.IntegrationTests
             return new IntPtr(1); 
         }
 
+        public ulong GetShaderResourceHeapLength(IntPtr shaderResourceHeapPointer)
+        {
+            return 4096;
+        }
+
+        public void ResizeShaderResourceHeap(IntPtr shaderResourceHeapPointer, ulong length) {}
+
         public void SetShaderResourceHeapLabel(IntPtr shaderResourceHeapPointer, string label) {}
         public void DeleteShaderResourceHeap(IntPtr shaderResourceHeapPointer) {}
         public void CreateShaderResourceTexture(IntPtr shaderResourceHeapPointer, uint index, IntPtr texturePointer) {}
         public void DeleteShaderResourceTexture(IntPtr shaderResourceHeapPointer, uint index) {}
         public void CreateShaderResourceBuffer(IntPtr shaderResourceHeapPointer, uint index, IntPtr bufferPointer) {}
         public void DeleteShaderResourceBuffer(IntPtr shaderResourceHeapPointer, uint index) {}
+        public void CreateShaderResources(IntPtr shaderResourceHeapPointer, ReadOnlySpan<GraphicsShaderResourceWrite> writes) {}
 
         public IntPtr CreateGraphicsBuffer(IntPtr graphicsHeapPointer, ulong heapOffset, bool isAliasable, int sizeInBytes) 
         {
@@ -127,7 +148,7 @@ namespace CoreEngine.IntegrationTests
         public void SetTextureLabel(IntPtr texturePointer, string label) {}
         public void DeleteTexture(IntPtr texturePointer) {}
 
-        public IntPtr CreateSwapChain(IntPtr windowPointer, IntPtr commandQueuePointer, int width, int height, GraphicsTextureFormat textureFormat) 
+        public IntPtr CreateSwapChain(IntPtr windowPointer, IntPtr commandQueuePointer, int width, int height, GraphicsTextureFormat textureFormat, GraphicsPresentMode presentMode, int backBufferCount) 
         {
             return new IntPtr(1);
         }
@@ -154,13 +175,27 @@ namespace CoreEngine.IntegrationTests
         {
             return new IntPtr(1);
         }
+        public IntPtr CreateShaderFromArchive(IntPtr shaderArchivePointer, string shaderName) 
+        {
+            return IntPtr.Zero;
+        }
         public void SetShaderLabel(IntPtr shaderPointer, string label) {}
         public void DeleteShader(IntPtr shaderPointer) {}
+        public IntPtr OpenShaderArchive(string path) 
+        {
+            return IntPtr.Zero;
+        }
+        public void CloseShaderArchive(IntPtr shaderArchivePointer) {}
 
         public IntPtr CreatePipelineState(IntPtr shaderPointer, GraphicsRenderPassDescriptor renderPassDescriptor) 
         {
             return new IntPtr(1);
         }
+        public IntPtr CreatePipelineStateAsync(IntPtr shaderPointer, GraphicsRenderPassDescriptor renderPassDescriptor, bool isComputePipelineState) 
+        {
+            return new IntPtr(1);
+        }
+        public bool IsPipelineStateReady(IntPtr pipelineStatePointer, bool waitForCompletion) { return true; }
         public void SetPipelineStateLabel(IntPtr pipelineStatePointer, string label) {}
         public void DeletePipelineState(IntPtr pipelineStatePointer) {}
 
@@ -203,6 +238,9 @@ namespace CoreEngine.IntegrationTests
 
         public void QueryTimestamp(IntPtr commandListPointer, IntPtr queryBufferPointer, int index) {}
         public void ResolveQueryData(IntPtr commandListPointer, IntPtr queryBufferPointer, IntPtr destinationBufferPointer, int startIndex, int endIndex) {}
+        public void BeginGpuZone(IntPtr commandListPointer, uint nameId, string name) {}
+        public void EndGpuZone(IntPtr commandListPointer) {}
+        public int ResolveGpuZones(Span<GraphicsGpuZone> gpuZones) { return 0; }
     }
 
     public static class Utils
@@ -0,0 +1,103 @@
+using System;
+using System.Runtime.InteropServices;
+using CoreEngine.Graphics;
+using CoreEngine.HostServices;
+using CoreEngine.Resources;
+using Moq;
+using Xunit;
+
+namespace CoreEngine.UnitTests
+{
+    public class BlockGraphicsMemoryAllocatorTests : IDisposable
+    {
+        private const ulong blockSizeInBytes = 1024;
+        private const int allocationSizeInBytes = 600;
+
+        private readonly IntPtr cpuMemory;
+        private readonly GraphicsManager graphicsManager;
+
+        public BlockGraphicsMemoryAllocatorTests()
+        {
+            this.cpuMemory = Marshal.AllocHGlobal(1024);
+
+            var graphicsHeapCount = 0;
+            var graphicsServiceMock = new Mock<IGraphicsService>();
+
+            graphicsServiceMock.Setup(x => x.GetGraphicsAdapterName()).Returns("TestAdapter");
+            graphicsServiceMock.Setup(x => x.CreateGraphicsHeap(It.IsAny<GraphicsServiceHeapType>(), It.IsAny<ulong>())).Returns(() => new IntPtr(++graphicsHeapCount));
+            graphicsServiceMock.Setup(x => x.GetBufferAllocationInfos(It.IsAny<int>())).Returns(new GraphicsAllocationInfos(64, 64));
+            graphicsServiceMock.Setup(x => x.CreateGraphicsBuffer(It.IsAny<IntPtr>(), It.IsAny<ulong>(), It.IsAny<HostServices.GraphicsBufferUsage>(), It.IsAny<int>())).Returns(new IntPtr(1));
+            graphicsServiceMock.Setup(x => x.GetGraphicsBufferCpuPointer(It.IsAny<IntPtr>())).Returns(this.cpuMemory);
+
+            this.graphicsManager = new GraphicsManager(graphicsServiceMock.Object, new ResourcesManager());
+        }
+
+        public void Dispose()
+        {
+            Marshal.FreeHGlobal(this.cpuMemory);
+        }
+
+        [Fact]
+        public void Trim_EmptyBlock_FreesOnlyEmptyBlock()
+        {
+            // Arrange
+            using var allocator = new BlockGraphicsMemoryAllocator(this.graphicsManager, GraphicsHeapType.Gpu, blockSizeInBytes, "TestHeap");
+
+            allocator.AllocateMemory(allocationSizeInBytes, 1);
+            var secondAllocation = allocator.AllocateMemory(allocationSizeInBytes, 1);
+            var thirdAllocation = allocator.AllocateMemory(allocationSizeInBytes, 1);
+
+            allocator.FreeMemory(secondAllocation);
+
+            // Act
+            var releasedMemory = allocator.Trim();
+
+            // Assert
+            Assert.Equal(blockSizeInBytes, releasedMemory);
+            Assert.Equal(2 * blockSizeInBytes, allocator.TotalMemory);
+            Assert.Equal(2 * (ulong)allocationSizeInBytes, allocator.AllocatedMemory);
+
+            // The third block is still used for new allocations once it is empty
+            allocator.FreeMemory(thirdAllocation);
+            var newAllocation = allocator.AllocateMemory(allocationSizeInBytes, 1);
+
+            Assert.Equal(thirdAllocation.GraphicsHeap.NativePointer, newAllocation.GraphicsHeap.NativePointer);
+            Assert.Equal(2 * blockSizeInBytes, allocator.TotalMemory);
+        }
+
+        [Fact]
+        public void Trim_NoEmptyBlock_FreesNothing()
+        {
+            // Arrange
+            using var allocator = new BlockGraphicsMemoryAllocator(this.graphicsManager, GraphicsHeapType.Gpu, blockSizeInBytes, "TestHeap");
+
+            allocator.AllocateMemory(allocationSizeInBytes, 1);
+            allocator.AllocateMemory(allocationSizeInBytes, 1);
+
+            // Act
+            var releasedMemory = allocator.Trim();
+
+            // Assert
+            Assert.Equal(0ul, releasedMemory);
+            Assert.Equal(2 * blockSizeInBytes, allocator.TotalMemory);
+        }
+
+        [Fact]
+        public void Trim_EmptyFirstBlock_KeepsFirstBlock()
+        {
+            // Arrange
+            using var allocator = new BlockGraphicsMemoryAllocator(this.graphicsManager, GraphicsHeapType.Gpu, blockSizeInBytes, "TestHeap");
+
+            var allocation = allocator.AllocateMemory(allocationSizeInBytes, 1);
+            allocator.FreeMemory(allocation);
+
+            // Act
+            var releasedMemory = allocator.Trim();
+
+            // Assert
+            Assert.Equal(0ul, releasedMemory);
+            Assert.Equal(blockSizeInBytes, allocator.TotalMemory);
+            Assert.Equal(0ul, allocator.AllocatedMemory);
+        }
+    }
+}
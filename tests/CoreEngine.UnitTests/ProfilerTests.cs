@@ -0,0 +1,177 @@
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Text.Json;
+using System.Threading;
+using CoreEngine.Diagnostics;
+using Xunit;
+
+namespace CoreEngine.UnitTests
+{
+    public class ProfilerTests : IDisposable
+    {
+        private readonly string tracePath;
+
+        public ProfilerTests()
+        {
+            this.tracePath = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName() + ".json");
+        }
+
+        public void Dispose()
+        {
+            File.Delete(this.tracePath);
+        }
+
+        [Fact]
+        public void EndCapture_GpuZones_WritesCompleteEvents()
+        {
+            // Arrange
+            Profiler.BeginCapture();
+
+            var startTimestamp = Profiler.CaptureStartTimestamp + Stopwatch.Frequency / 1000;
+            var endTimestamp = startTimestamp + Stopwatch.Frequency / 500;
+
+            Profiler.AddGpuZone("RenderQueue", "Render", startTimestamp, endTimestamp);
+            Profiler.AddGpuZone("ComputeQueue", "Compute", startTimestamp, endTimestamp);
+
+            // Act
+            Profiler.EndCapture(this.tracePath);
+
+            // Assert
+            using var document = JsonDocument.Parse(File.ReadAllText(this.tracePath));
+            var root = document.RootElement;
+
+            Assert.Equal("ms", root.GetProperty("displayTimeUnit").GetString());
+
+            var traceEvents = root.GetProperty("traceEvents").EnumerateArray().ToArray();
+            var completeEvents = traceEvents.Where(item => item.GetProperty("ph").GetString() == "X").ToArray();
+
+            Assert.Equal(2, completeEvents.Length);
+
+            var renderEvent = completeEvents[0];
+
+            Assert.Equal("Render", renderEvent.GetProperty("name").GetString());
+            Assert.Equal("gpu", renderEvent.GetProperty("cat").GetString());
+            Assert.Equal(2, renderEvent.GetProperty("pid").GetInt32());
+            Assert.Equal(1, renderEvent.GetProperty("tid").GetInt32());
+            Assert.Equal(1000.0, renderEvent.GetProperty("ts").GetDouble(), 3);
+            Assert.Equal(2000.0, renderEvent.GetProperty("dur").GetDouble(), 3);
+
+            // Each GPU queue gets its own track
+            Assert.Equal(2, completeEvents[1].GetProperty("tid").GetInt32());
+
+            var metadataEvents = traceEvents.Where(item => item.GetProperty("ph").GetString() == "M").ToArray();
+
+            Assert.Contains(metadataEvents, item => IsMetadataEvent(item, "process_name", 1, 0, "CPU"));
+            Assert.Contains(metadataEvents, item => IsMetadataEvent(item, "process_name", 2, 0, "GPU"));
+            Assert.Contains(metadataEvents, item => IsMetadataEvent(item, "thread_name", 2, 1, "RenderQueue"));
+            Assert.Contains(metadataEvents, item => IsMetadataEvent(item, "thread_name", 2, 2, "ComputeQueue"));
+        }
+
+        [Fact]
+        public void EndCapture_GpuZoneBeforeCapture_SkipsZone()
+        {
+            // Arrange
+            Profiler.BeginCapture();
+
+            var startTimestamp = Profiler.CaptureStartTimestamp - Stopwatch.Frequency;
+            Profiler.AddGpuZone("RenderQueue", "Render", startTimestamp, Profiler.CaptureStartTimestamp);
+
+            // Act
+            Profiler.EndCapture(this.tracePath);
+
+            // Assert
+            using var document = JsonDocument.Parse(File.ReadAllText(this.tracePath));
+            var traceEvents = document.RootElement.GetProperty("traceEvents").EnumerateArray();
+
+            Assert.DoesNotContain(traceEvents, item => item.GetProperty("ph").GetString() == "X");
+            Assert.False(Profiler.IsCapturing);
+        }
+
+        [Fact]
+        public void EndCapture_CpuZones_WritesZonesOfCapturingThread()
+        {
+            // Arrange
+            Profiler.BeginCapture();
+
+            var thread = new Thread(() =>
+            {
+                Profiler.BeginCpuZone("Outer");
+                Profiler.BeginCpuZone("Inner");
+                Thread.Sleep(1);
+                Profiler.EndCpuZone();
+                Profiler.EndCpuZone();
+
+                // Unbalanced end calls are ignored
+                Profiler.EndCpuZone();
+            });
+
+            thread.Name = "TestThread";
+            thread.Start();
+            thread.Join();
+
+            // Act
+            Profiler.EndCapture(this.tracePath);
+
+            // Assert
+            using var document = JsonDocument.Parse(File.ReadAllText(this.tracePath));
+            var traceEvents = document.RootElement.GetProperty("traceEvents").EnumerateArray().ToArray();
+            var completeEvents = traceEvents.Where(item => item.GetProperty("ph").GetString() == "X").ToArray();
+
+            Assert.Equal(2, completeEvents.Length);
+
+            // Zones are written when they end so the inner zone comes first
+            var innerEvent = completeEvents[0];
+            var outerEvent = completeEvents[1];
+
+            Assert.Equal("Inner", innerEvent.GetProperty("name").GetString());
+            Assert.Equal("Outer", outerEvent.GetProperty("name").GetString());
+            Assert.Equal("cpu", innerEvent.GetProperty("cat").GetString());
+            Assert.Equal(1, innerEvent.GetProperty("pid").GetInt32());
+            Assert.Equal(thread.ManagedThreadId, innerEvent.GetProperty("tid").GetInt32());
+
+            var innerStart = innerEvent.GetProperty("ts").GetDouble();
+            var innerEnd = innerStart + innerEvent.GetProperty("dur").GetDouble();
+            var outerStart = outerEvent.GetProperty("ts").GetDouble();
+            var outerEnd = outerStart + outerEvent.GetProperty("dur").GetDouble();
+
+            Assert.True(outerStart >= 0.0);
+            Assert.True(innerStart >= outerStart);
+            Assert.True(innerEnd <= outerEnd);
+            Assert.True(innerEvent.GetProperty("dur").GetDouble() >= 1000.0);
+
+            Assert.Contains(traceEvents, item => IsMetadataEvent(item, "thread_name", 1, thread.ManagedThreadId, "TestThread"));
+        }
+
+        [Fact]
+        public void AddGpuZone_NotCapturing_DoesNotRecordZone()
+        {
+            // Arrange
+            Profiler.BeginCapture();
+            Profiler.EndCapture(this.tracePath);
+
+            var startTimestamp = Stopwatch.GetTimestamp();
+            Profiler.AddGpuZone("RenderQueue", "Render", startTimestamp, startTimestamp + 1);
+
+            // Act
+            Profiler.BeginCapture();
+            Profiler.EndCapture(this.tracePath);
+
+            // Assert
+            using var document = JsonDocument.Parse(File.ReadAllText(this.tracePath));
+            var traceEvents = document.RootElement.GetProperty("traceEvents").EnumerateArray().ToArray();
+
+            Assert.DoesNotContain(traceEvents, item => item.GetProperty("ph").GetString() == "X");
+            Assert.Equal(2, traceEvents.Length);
+        }
+
+        private static bool IsMetadataEvent(JsonElement traceEvent, string name, int processId, int threadId, string value)
+        {
+            return traceEvent.GetProperty("name").GetString() == name &&
+                   traceEvent.GetProperty("pid").GetInt32() == processId &&
+                   traceEvent.GetProperty("tid").GetInt32() == threadId &&
+                   traceEvent.GetProperty("args").GetProperty("name").GetString() == value;
+        }
+    }
+}
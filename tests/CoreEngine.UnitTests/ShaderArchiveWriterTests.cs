@@ -0,0 +1,229 @@
+using System;
+using System.IO;
+using System.Text;
+using CoreEngine.Graphics;
+using Xunit;
+
+namespace CoreEngine.UnitTests
+{
+    public class ShaderArchiveWriterTests : IDisposable
+    {
+        private readonly string resourceDirectory;
+        private readonly string archivePath;
+
+        public ShaderArchiveWriterTests()
+        {
+            this.resourceDirectory = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName());
+            this.archivePath = Path.Combine(this.resourceDirectory, ShaderArchiveWriter.FileName);
+
+            Directory.CreateDirectory(Path.Combine(this.resourceDirectory, "Shaders"));
+        }
+
+        public void Dispose()
+        {
+            Directory.Delete(this.resourceDirectory, true);
+        }
+
+        [Fact]
+        public void WriteShaderArchive_ValidShaders_RoundTripsByteCode()
+        {
+            // Arrange
+            var meshCode = new byte[] { 1, 2, 3, 4, 5 };
+            var pixelCode = new byte[] { 6, 7, 8 };
+
+            WriteShaderFile("Shaders/Render.shader", CreateShaderFile(3, ("MeshMain", meshCode), ("PixelMain", pixelCode)));
+            WriteShaderFile("Shaders/Compute.shader", CreateShaderFile(1, ("ComputeMain", pixelCode)));
+
+            // Act
+            var shaderCount = ShaderArchiveWriter.WriteShaderArchive(this.resourceDirectory, this.archivePath);
+
+            // Assert
+            Assert.Equal(2, shaderCount);
+
+            var archive = File.ReadAllBytes(this.archivePath);
+            using var reader = new BinaryReader(new MemoryStream(archive));
+
+            Assert.Equal(0x4B504853u, reader.ReadUInt32());
+            Assert.Equal(1u, reader.ReadUInt32());
+            Assert.Equal(2u, reader.ReadUInt32());
+            Assert.Equal(3u, reader.ReadUInt32());
+
+            // Shaders are sorted by path
+            var computeShader = ReadShaderEntry(reader, archive);
+            var renderShader = ReadShaderEntry(reader, archive);
+
+            Assert.Equal("/Shaders/Compute.shader", computeShader.Name);
+            Assert.Equal(1u, computeShader.ParameterCount);
+            Assert.Equal(0u, computeShader.FirstEntryPoint);
+            Assert.Equal(1u, computeShader.EntryPointCount);
+
+            Assert.Equal("/Shaders/Render.shader", renderShader.Name);
+            Assert.Equal(3u, renderShader.ParameterCount);
+            Assert.Equal(1u, renderShader.FirstEntryPoint);
+            Assert.Equal(2u, renderShader.EntryPointCount);
+
+            var computeEntryPoint = ReadEntryPoint(reader);
+            var meshEntryPoint = ReadEntryPoint(reader);
+            var pixelEntryPoint = ReadEntryPoint(reader);
+
+            Assert.Equal(3u, computeEntryPoint.Stage);
+            Assert.Equal(1u, meshEntryPoint.Stage);
+            Assert.Equal(2u, pixelEntryPoint.Stage);
+
+            Assert.Equal(pixelCode, ReadRange(archive, computeEntryPoint.Offset, computeEntryPoint.Length));
+            Assert.Equal(meshCode, ReadRange(archive, meshEntryPoint.Offset, meshEntryPoint.Length));
+            Assert.Equal(pixelCode, ReadRange(archive, pixelEntryPoint.Offset, pixelEntryPoint.Length));
+
+            Assert.Equal(ShaderArchiveWriter.ComputeContentHash(meshCode), meshEntryPoint.Hash);
+            Assert.Equal(ShaderArchiveWriter.ComputeContentHash(pixelCode), pixelEntryPoint.Hash);
+
+            // Identical byte code is stored once
+            Assert.Equal(pixelEntryPoint.Offset, computeEntryPoint.Offset);
+            Assert.Equal(0ul, meshEntryPoint.Offset % 8);
+            Assert.Equal(0ul, pixelEntryPoint.Offset % 8);
+        }
+
+        [Fact]
+        public void WriteShaderArchive_NoShaderFile_DoesNotWriteArchive()
+        {
+            // Act
+            var shaderCount = ShaderArchiveWriter.WriteShaderArchive(this.resourceDirectory, this.archivePath);
+
+            // Assert
+            Assert.Equal(0, shaderCount);
+            Assert.False(File.Exists(this.archivePath));
+        }
+
+        [Theory]
+        [InlineData(100, 0, 5)]
+        [InlineData(-1, 0, 5)]
+        [InlineData(0, 100, 5)]
+        [InlineData(0, -4, 5)]
+        [InlineData(0, 0, 100)]
+        [InlineData(0, 0, -1)]
+        public void WriteShaderArchive_InvalidRanges_SkipsShader(int byteCodeLengthDelta, int spirvOffset, int entryPointCodeLength)
+        {
+            // Arrange
+            var validCode = new byte[] { 1, 2, 3, 4 };
+            var invalidCode = new byte[] { 9, 9, 9, 9, 9 };
+
+            WriteShaderFile("Shaders/Valid.shader", CreateShaderFile(1, ("MeshMain", validCode)));
+            WriteShaderFile("Shaders/Invalid.shader", CreateShaderFile(1, byteCodeLengthDelta, spirvOffset, entryPointCodeLength, ("MeshMain", invalidCode)));
+
+            // Act
+            var shaderCount = ShaderArchiveWriter.WriteShaderArchive(this.resourceDirectory, this.archivePath);
+
+            // Assert
+            Assert.Equal(1, shaderCount);
+
+            var archive = File.ReadAllBytes(this.archivePath);
+            using var reader = new BinaryReader(new MemoryStream(archive));
+            reader.BaseStream.Position = 8;
+
+            Assert.Equal(1u, reader.ReadUInt32());
+            Assert.Equal(1u, reader.ReadUInt32());
+
+            var shader = ReadShaderEntry(reader, archive);
+            var entryPoint = ReadEntryPoint(reader);
+
+            Assert.Equal("/Shaders/Valid.shader", shader.Name);
+            Assert.Equal(validCode, ReadRange(archive, entryPoint.Offset, entryPoint.Length));
+
+            // The byte code of the rejected file is not kept in the archive
+            Assert.Equal((long)(entryPoint.Offset + 8), archive.Length);
+        }
+
+        [Fact]
+        public void WriteShaderArchive_TruncatedFile_SkipsShader()
+        {
+            // Arrange
+            var shaderFile = CreateShaderFile(1, ("MeshMain", new byte[] { 1, 2, 3, 4 }));
+            WriteShaderFile("Shaders/Truncated.shader", shaderFile.AsSpan(0, 12).ToArray());
+
+            // Act
+            var shaderCount = ShaderArchiveWriter.WriteShaderArchive(this.resourceDirectory, this.archivePath);
+
+            // Assert
+            Assert.Equal(0, shaderCount);
+            Assert.False(File.Exists(this.archivePath));
+        }
+
+        private readonly record struct ShaderEntry(string Name, uint ParameterCount, uint FirstEntryPoint, uint EntryPointCount);
+        private readonly record struct EntryPointEntry(uint Stage, ulong Offset, uint Length, ulong Hash);
+
+        private void WriteShaderFile(string path, byte[] data)
+        {
+            File.WriteAllBytes(Path.Combine(this.resourceDirectory, path), data);
+        }
+
+        private static byte[] CreateShaderFile(uint parameterCount, params (string Name, byte[] Code)[] entryPoints)
+        {
+            return CreateShaderFile(parameterCount, 0, 0, null, entryPoints);
+        }
+
+        // Writes a .shader file with only a SPIR-V part, the deltas are used to build invalid ranges
+        private static byte[] CreateShaderFile(uint parameterCount, int byteCodeLengthDelta, int spirvOffset, int? entryPointCodeLength, params (string Name, byte[] Code)[] entryPoints)
+        {
+            using var byteCodeStream = new MemoryStream();
+            using var byteCodeWriter = new BinaryWriter(byteCodeStream);
+
+            byteCodeWriter.Write(spirvOffset);
+            byteCodeWriter.Write(parameterCount);
+            byteCodeWriter.Write(entryPoints.Length);
+
+            foreach (var entryPoint in entryPoints)
+            {
+                var nameData = Encoding.UTF8.GetBytes(entryPoint.Name);
+
+                byteCodeWriter.Write(nameData.Length);
+                byteCodeWriter.Write(nameData);
+                byteCodeWriter.Write(entryPointCodeLength ?? entryPoint.Code.Length);
+                byteCodeWriter.Write(entryPoint.Code);
+            }
+
+            using var fileStream = new MemoryStream();
+            using var fileWriter = new BinaryWriter(fileStream);
+
+            fileWriter.Write("SHADER".ToCharArray());
+            fileWriter.Write(1);
+            fileWriter.Write(byteCodeLengthDelta < 0 ? byteCodeLengthDelta : (int)byteCodeStream.Length + byteCodeLengthDelta);
+            fileWriter.Write(byteCodeStream.ToArray());
+
+            return fileStream.ToArray();
+        }
+
+        private static ShaderEntry ReadShaderEntry(BinaryReader reader, byte[] archive)
+        {
+            var nameHash = reader.ReadUInt64();
+            var nameOffset = reader.ReadUInt32();
+            var nameLength = reader.ReadUInt32();
+            var parameterCount = reader.ReadUInt32();
+            var firstEntryPoint = reader.ReadUInt32();
+            var entryPointCount = reader.ReadUInt32();
+            reader.ReadUInt32();
+            reader.ReadUInt64();
+
+            var nameData = ReadRange(archive, nameOffset, nameLength);
+            Assert.Equal(ShaderArchiveWriter.ComputeContentHash(nameData), nameHash);
+
+            return new ShaderEntry(Encoding.UTF8.GetString(nameData), parameterCount, firstEntryPoint, entryPointCount);
+        }
+
+        private static EntryPointEntry ReadEntryPoint(BinaryReader reader)
+        {
+            var stage = reader.ReadUInt32();
+            var spirvLength = reader.ReadUInt32();
+            var spirvOffset = reader.ReadUInt64();
+            var spirvHash = reader.ReadUInt64();
+            reader.ReadBytes(24);
+
+            return new EntryPointEntry(stage, spirvOffset, spirvLength, spirvHash);
+        }
+
+        private static byte[] ReadRange(byte[] archive, ulong offset, uint length)
+        {
+            Assert.True(offset + length <= (ulong)archive.Length);
+            return archive.AsSpan((int)offset, (int)length).ToArray();
+        }
+    }
+}